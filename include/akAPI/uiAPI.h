@@ -15,6 +15,8 @@
 // C++ header
 #include <vector>						// vector<>
 #include <map>							// map<>
+#include <functional>					// function<>
+#include <memory>						// shared_ptr<>
 
 // Qt header
 #include <qstring.h>					// QString
@@ -26,6 +28,7 @@
 // AK header
 #include <akCore/akCore.h>
 #include <akCore/globalDataTypes.h>
+#include <akCore/aSettingsCache.h>
 
 #include <akGui/aColor.h>
 #include <akGui/aApplication.h>
@@ -49,6 +52,9 @@ namespace ak {
 	class aNotifier;
 	class aUidManager;
 	class aFile;
+	class aHash;
+	class aHttpClient;
+	class aLogBuffer;
 	class aPaintable;
 	class aObjectManager;
 	class aColorStyle;
@@ -112,6 +118,8 @@ namespace ak {
 
 			QSettings * settings(void) const { return m_settings; }
 
+			aSettingsCache * settingsCache(void) const { return m_settingsCache; }
+
 		protected:
 			aApplication *				m_app;							//! The core application
 			bool						m_appIsRunning;				//! True if the core application is already running
@@ -121,6 +129,7 @@ namespace ak {
 			QString						m_companyName;
 			QString						m_applicationName;
 			QSettings *					m_settings;
+			aSettingsCache *			m_settingsCache;				//! The in-memory settings, written to m_settings in batches
 
 			bool						m_isInitialized;				//! If true, then the API was initialized
 
@@ -191,6 +200,23 @@ namespace ak {
 			const std::string &					_applicationVersion
 		);
 
+		//! @brief Will create and return a binary snapshot representing the UI
+		//! The snapshot is smaller and faster to restore than the JSON string created by saveStateWindow
+		//! @param _applicationVersion The application version to store
+		//! @param _compress If true the snapshot payload will be compressed
+		UICORE_API_EXPORT std::string saveStateWindowBinary(
+			const std::string &					_applicationVersion,
+			bool								_compress = true
+		);
+
+		//! @brief Will setup the UI with the settings provided in the binary snapshot
+		//! Settings of objects that do not exist yet are applied as soon as an object with the matching alias is set
+		//! @param _data The binary snapshot created with saveStateWindowBinary
+		UICORE_API_EXPORT settingsRestoreErrorCode restoreStateWindowBinary(
+			const std::string &					_data,
+			const std::string &					_applicationVersion
+		);
+
 		//! @brief Will restore tthe color style from the settings JSON string
 		//! @param _json The JSON string containing the settings
 		UICORE_API_EXPORT settingsRestoreErrorCode restoreStateColorStyle(
@@ -469,6 +495,16 @@ namespace ak {
 			const QString &						_password = QString()
 		);
 
+		//! @brief Will create a new LogView and return its UID
+		//! Use the LogView for live output consoles, text can be appended from any thread
+		//! @param _creatorUid The UID of the creator who creates this object
+		//! @param _maximumLineCount The maximum number of lines to keep, 0 for unlimited
+		//! @throw ak::Exception if the provided UID is invalid or the API is not initialized
+		UICORE_API_EXPORT UID createLogView(
+			UID									_creatorUid,
+			int									_maximumLineCount = 10000
+		);
+
 		//! @brief Will create a nice line edit
 		//! @param _initialText The initial text of the edit field
 		//! @param _infoLabelText The initial text of the information label
@@ -529,6 +565,18 @@ namespace ak {
 			int									_columns
 		);
 
+		//! @brief Will create a new model backed TableView and return its UID
+		//! Use the TableView instead of the Table for large data sets
+		//! @param _creatorUid The UID of the creator who creates this object
+		//! @param _rows The initial row count of the TableView
+		//! @param _columns The initial column count of the TableView
+		//! @throw ak::Exception if the provided UID is invalid or the API is not initialized
+		UICORE_API_EXPORT UID createTableView(
+			UID									_creatorUid,
+			int									_rows,
+			int									_columns
+		);
+
 		//! @brief Will create a new TabToolBar subcountainer and return its UID
 		//! @param _creatorUid The UID of the creator who creates this object
 		//! @param _parentUid The UID of the parent TabToolBar object (may be a uiManager, TabToolBarPage or TabToolBarGroup)
@@ -540,6 +588,18 @@ namespace ak {
 			const QString &						_text = QString("")
 		);
 
+		//! @brief Will create the TabToolBar pages, groups and subgroups described in the layout and add the objects to them in a single pass
+		//! @param _creatorUid The UID of the creator who creates the containers
+		//! @param _windowUid The UID of the window (uiManager) to build the TabToolBar at
+		//! @param _layout The layout to apply
+		//! @param _deferHiddenPages If true, pages that are not visible are built when they are shown for the first time
+		UICORE_API_EXPORT void buildTabToolBar(
+			UID									_creatorUid,
+			UID									_windowUid,
+			const aTtbLayout &					_layout,
+			bool								_deferHiddenPages = true
+		);
+
 		//! @brief Will create a new TextEdit and return its UID
 		//! @param _creatorUid The UID of the creator who creates this object
 		//! @param _initialText The initial text of the TextEdit
@@ -892,6 +952,21 @@ namespace ak {
 				bool						_isEnbaled
 			);
 
+			//! @brief Will return the number of watched docks that are currently visible.
+			//! The visible state is tracked by the watcher, the docks are not queried
+			//! @param _dockWatcherUid The UID of the dock watcher
+			UICORE_API_EXPORT int visibleDockCount(
+				ak::UID						_dockWatcherUid
+			);
+
+			//! @brief Will return the visible state of the dock tracked by the watcher
+			//! @param _dockWatcherUid The UID of the dock watcher
+			//! @param _dockUid The UID of the watched dock
+			UICORE_API_EXPORT bool isDockVisible(
+				ak::UID						_dockWatcherUid,
+				ak::UID						_dockUid
+			);
+
 		}
 
 		// ###############################################################################################################################################
@@ -1120,6 +1195,51 @@ namespace ak {
 
 		// ###############################################################################################################################################
 
+		// Log view
+
+		namespace logView {
+
+			//! @brief Will append the text at the end of the log view.
+			//! The text is inserted with the next flush (one frame later)
+			//! @param _logViewUID The UID of the log view
+			//! @param _text The text to append
+			UICORE_API_EXPORT void appendText(
+				UID							_logViewUID,
+				const QString &				_text
+			);
+
+			//! @brief Will remove all text, including the text that was not inserted yet
+			//! @param _logViewUID The UID of the log view
+			UICORE_API_EXPORT void clear(
+				UID							_logViewUID
+			);
+
+			//! @brief Will set the maximum number of lines to keep, the oldest lines are removed
+			//! @param _logViewUID The UID of the log view
+			//! @param _maximumLineCount The maximum number of lines, 0 for unlimited
+			UICORE_API_EXPORT void setMaximumLineCount(
+				UID							_logViewUID,
+				int							_maximumLineCount
+			);
+
+			//! @brief Will return the maximum number of lines to keep
+			//! @param _logViewUID The UID of the log view
+			UICORE_API_EXPORT int maximumLineCount(
+				UID							_logViewUID
+			);
+
+			//! @brief Will return the buffer of the log view.
+			//! Worker threads append their text to the buffer (aLogBuffer::append), the buffer may outlive the log view.
+			//! This function must be called from the UI thread
+			//! @param _logViewUID The UID of the log view
+			UICORE_API_EXPORT std::shared_ptr<aLogBuffer> buffer(
+				UID							_logViewUID
+			);
+
+		} // namespace logView
+
+		// ###############################################################################################################################################
+
 		// Nice line edit
 
 		namespace niceLineEdit {
@@ -1800,6 +1920,8 @@ namespace ak {
 				bool			_repaint = true
 			);
 
+			//! @brief Will block the repaint of the special tab bar.
+			//! Repaints are coalesced and performed once per frame, blocking is not required to batch color changes
 			UICORE_API_EXPORT void setRepaintBlocked(
 				UID			_specialTabBarUID,
 				bool			_blocked = true
@@ -1855,6 +1977,29 @@ namespace ak {
 				const QIcon &		_icon
 			);
 
+			//! @brief Will add a tab whose content is created when the tab is activated for the first time
+			//! @param _tabWidgetUID The UID of the tab widget
+			//! @param _factory Creates the tab content and returns its UID (e.g. by calling createTree)
+			//! @param _title The title of the tab
+			//! @param _icon The icon of the tab
+			//! @param _unloadable If true the content may be destroyed again if the limit of loaded tabs is exceeded (see setMaximumLoadedLazyTabs)
+			UICORE_API_EXPORT ID addLazyTab(
+				UID								_tabWidgetUID,
+				const std::function<UID(void)> &	_factory,
+				const QString &					_title,
+				const QIcon &					_icon = QIcon(),
+				bool							_unloadable = false
+			);
+
+			//! @brief Will set the maximum number of unloadable lazy tabs that may be loaded at the same time
+			//! If the limit is exceeded the tabs that were not visited for the longest time are unloaded
+			//! @param _tabWidgetUID The UID of the tab widget
+			//! @param _count The maximum count, 0 for unlimited
+			UICORE_API_EXPORT void setMaximumLoadedLazyTabs(
+				UID								_tabWidgetUID,
+				int								_count
+			);
+
 			//! @brief Will close all tabs of the specified tabWidget
 			UICORE_API_EXPORT void closeAllTabs(
 				UID				_tabWidgetUID
@@ -1944,15 +2089,124 @@ namespace ak {
 			);
 
 			//! @brief Will return the ID of the first tab with the specified name
+			//! The lookup uses a text index and does not iterate over the tabs
 			UICORE_API_EXPORT ID getTabIDByText(
 				UID							_tabWidgetUID,
 				const QString & _tabText
 			);
 
+			//! @brief Will set the case sensitivity used by hasTab and getTabIDByText
+			UICORE_API_EXPORT void setTextLookupCaseSensitive(
+				UID							_tabWidgetUID,
+				bool						_caseSensitive = true
+			);
+
 		}
 
 		// ###############################################################################################################################################
 
+		// TableView
+
+		namespace tableView {
+
+			//! @brief Will set the row and column count of the table view, all data will be removed
+			UICORE_API_EXPORT void setDimensions(
+				UID							_tableViewUID,
+				int							_rows,
+				int							_columns
+			);
+
+			//! @brief Will set the texts of a column in one batch. Rows are added if required
+			//! @param _tableViewUID The UID of the table view
+			//! @param _column The column to set the texts at
+			//! @param _values The texts, one per row
+			//! @param _count The number of texts
+			//! @param _firstRow The row to set the first text at
+			UICORE_API_EXPORT void setColumn(
+				UID							_tableViewUID,
+				int							_column,
+				const QString *				_values,
+				int							_count,
+				int							_firstRow = 0
+			);
+
+			//! @brief Will set the texts of multiple rows in one batch. Rows are added if required
+			//! @param _tableViewUID The UID of the table view
+			//! @param _firstRow The row to set the first text at
+			//! @param _values The texts in row major order (_rowCount * _columnCount texts)
+			//! @param _rowCount The number of rows provided
+			//! @param _columnCount The number of texts per row
+			UICORE_API_EXPORT void setRows(
+				UID							_tableViewUID,
+				int							_firstRow,
+				const QString *				_values,
+				int							_rowCount,
+				int							_columnCount
+			);
+
+			UICORE_API_EXPORT void setCellText(
+				UID							_tableViewUID,
+				int							_row,
+				int							_column,
+				const QString &				_text
+			);
+
+			UICORE_API_EXPORT QString getCellText(
+				UID							_tableViewUID,
+				int							_row,
+				int							_column
+			);
+
+			UICORE_API_EXPORT void setCellForecolor(
+				UID							_tableViewUID,
+				int							_row,
+				int							_column,
+				const QColor &				_color
+			);
+
+			UICORE_API_EXPORT void setCellBackcolor(
+				UID							_tableViewUID,
+				int							_row,
+				int							_column,
+				const QColor &				_color
+			);
+
+			UICORE_API_EXPORT void setCellEditable(
+				UID							_tableViewUID,
+				int							_row,
+				int							_column,
+				bool						_editable = true
+			);
+
+			//! @brief Will set the editable flag for all cells without an explicit flag
+			UICORE_API_EXPORT void setCellsEditable(
+				UID							_tableViewUID,
+				bool						_editable = true
+			);
+
+			UICORE_API_EXPORT void setColumnHeader(
+				UID							_tableViewUID,
+				int							_column,
+				const QString &				_text
+			);
+
+			//! @brief Will remove all rows, the columns are kept
+			UICORE_API_EXPORT void clear(
+				UID							_tableViewUID
+			);
+
+			UICORE_API_EXPORT int rowCount(
+				UID							_tableViewUID
+			);
+
+			UICORE_API_EXPORT int columnCount(
+				UID							_tableViewUID
+			);
+
+		} // namespace tableView
+
+		// ###############################################################################################################################################
+
 		// TextEdit
 
 		namespace textEdit {
@@ -2704,6 +2958,59 @@ namespace ak {
 				HashAlgorithm			_algorithm
 			);
 
+			//! @brief Will return the hash of the data as a hex string
+			//! @param _data The data to hash
+			//! @param _algorithm The algorithm to use
+			UICORE_API_EXPORT QString hashData(
+				const QByteArray &		_data,
+				HashAlgorithm			_algorithm
+			);
+
+			//! @brief Will return the hash of the file content as a hex string, an empty string is returned if the file could not be read
+			//! @param _filePath The path of the file
+			//! @param _algorithm The algorithm to use
+			UICORE_API_EXPORT QString hashFile(
+				const QString &			_filePath,
+				HashAlgorithm			_algorithm
+			);
+
+			//! @brief Will return the hash of every string as a hex string, large batches are hashed on multiple threads
+			//! @param _strings The strings to hash
+			//! @param _algorithm The algorithm to use
+			UICORE_API_EXPORT std::vector<QString> hashBatch(
+				const QStringList &		_strings,
+				HashAlgorithm			_algorithm
+			);
+
+			//! @brief Will return the hash of every file as a hex string, the files are hashed on multiple threads
+			//! @param _filePaths The paths of the files
+			//! @param _algorithm The algorithm to use
+			UICORE_API_EXPORT std::vector<QString> hashFiles(
+				const QStringList &		_filePaths,
+				HashAlgorithm			_algorithm
+			);
+
+			//! @brief Will create an incremental hash, the caller takes ownership
+			//! @param _algorithm The algorithm to use
+			UICORE_API_EXPORT aHash * createHash(
+				HashAlgorithm			_algorithm
+			);
+
+		}
+
+		// ###############################################################################################################################################
+
+		// Net
+
+		namespace net {
+
+			//! @brief Will create a HTTP client using the API messenger and a new UID, the caller takes ownership
+			//! Finished requests are reported with the client UID as sender (see aHttpClient)
+			//! @param _parent The parent object of the client
+			UICORE_API_EXPORT aHttpClient * createHttpClient(
+				QObject *				_parent = (QObject *) nullptr
+			);
+
 		}
 
 		// ###############################################################################################################################################
@@ -2834,6 +3141,34 @@ namespace ak {
 				bool					_value
 			);
 
+			//! @brief Will write all changed settings to the settings file
+			//! Changed settings are written automatically after the flush interval and when the API is destroyed
+			UICORE_API_EXPORT void flush(void);
+
+			//! @brief Will set the time in milliseconds after a change until the changed settings are written
+			//! If the interval is 0 the settings are only written on flush() or when the API is destroyed
+			UICORE_API_EXPORT void setFlushInterval(
+				int						_interval
+			);
+
+			//! @brief Will return the UID used as sender for the setting change notifications (etChanged, info1 = key ID)
+			UICORE_API_EXPORT UID uid(void);
+
+			//! @brief Will return the name of the setting with the provided key ID
+			//! @param _keyId The key ID received with the change notification
+			UICORE_API_EXPORT QString keyName(
+				int						_keyId
+			);
+
+			//! @brief Will return the settings cache
+			UICORE_API_EXPORT aSettingsCache * cache(void);
+
+			//! @brief Will return the value of the typed setting
+			template <class T> T get(const aSettingsKey<T> & _key) { return cache()->value(_key); }
+
+			//! @brief Will set the value of the typed setting
+			template <class T> void set(const aSettingsKey<T> & _key, const T & _value) { cache()->setValue(_key, _value); }
+
 		}
 
 		// ###############################################################################################################################################
@@ -25,26 +25,48 @@
 
 namespace ak {
 
+	//! @brief A date stored as the number of days since 01.01.1970.
+	//! The class is trivially copyable, day and month values out of range are carried over to the next month or year
 	class UICORE_API_EXPORT aDate {
 	public:
-		aDate();
-		aDate(int _d, int _m, int _y);
+		//! @brief The maximum number of characters written by format()
+		static const size_t maxStringLength = 17;
+
+		//! @brief Default constructor, the date is 01.01.1900
+		constexpr aDate() : m_days(daysFromCivil(1900, 1, 1)) {}
+		constexpr aDate(int _d, int _m, int _y) : m_days(daysFromCivil(_y, _m, _d)) {}
 		aDate(const QDate & _date);
-		aDate(const aDate & _other);
-		virtual ~aDate();
+
+		//! @brief Will create a date from the number of days since 01.01.1970
+		static constexpr aDate fromDaysSinceEpoch(int _days) { return aDate(_days, 0); }
 
 		// ############################################################################################################
 
 		// Getter
 
 		//! @brief Will return the year
-		int year(void) const { return m_y; }
+		constexpr int year(void) const { int d{ 0 }, m{ 0 }, y{ 0 }; civilFromDays(m_days, y, m, d); return y; }
 
 		//! @brief Will return the month
-		int month(void) const { return m_m; }
+		constexpr int month(void) const { int d{ 0 }, m{ 0 }, y{ 0 }; civilFromDays(m_days, y, m, d); return m; }
 
 		//! @brief Will return the day
-		int day(void) const { return m_d; }
+		constexpr int day(void) const { int d{ 0 }, m{ 0 }, y{ 0 }; civilFromDays(m_days, y, m, d); return d; }
+
+		//! @brief Will write the day, month and year (cheaper than calling the single getters)
+		constexpr void get(int & _d, int & _m, int & _y) const { civilFromDays(m_days, _y, _m, _d); }
+
+		//! @brief Will return the number of days since 01.01.1970
+		constexpr int daysSinceEpoch(void) const { return m_days; }
+
+		//! @brief Will return the day of the week (1 = Monday, 7 = Sunday)
+		constexpr int dayOfWeek(void) const { return (m_days >= -3 ? (m_days + 3) % 7 : (m_days + 4) % 7 + 6) + 1; }
+
+		//! @brief Will return the number of days from this date to the other date
+		constexpr int daysTo(const aDate & _other) const { return _other.m_days - m_days; }
+
+		//! @brief Will return a copy of this date with the days added
+		constexpr aDate addDays(int _days) const { return aDate(m_days + _days, 0); }
 
 		//! @brief Will return a String representation of this date
 		//! @param _delimiter The delimiter that is used to seperate the day, month and year
@@ -70,21 +92,21 @@ namespace ak {
 
 		//! @brief Will set the year
 		//! @param _y The year to set
-		void setYear(int _y) { m_y = _y; }
+		constexpr void setYear(int _y) { int d{ 0 }, m{ 0 }, y{ 0 }; get(d, m, y); set(d, m, _y); }
 
 		//! @brief Will set the month
 		//! @param _m The month to set
-		void setMonth(int _m) { m_m = _m; }
+		constexpr void setMonth(int _m) { int d{ 0 }, m{ 0 }, y{ 0 }; get(d, m, y); set(d, _m, y); }
 
 		//! @brief Will set the day
 		//! @param _d The day to set
-		void setDay(int _d) { m_d = _d; }
+		constexpr void setDay(int _d) { int d{ 0 }, m{ 0 }, y{ 0 }; get(d, m, y); set(_d, m, y); }
 
 		//! @brief Will set the current date
 		//! @param _y The year to set
 		//! @param _m The month to set
 		//! @param _d The day to set
-		void set(int _d, int _m, int _y);
+		constexpr void set(int _d, int _m, int _y) { m_days = daysFromCivil(_y, _m, _d); }
 
 		//! @brief Will set the current date
 		//! @param _date The date to set
@@ -121,38 +143,142 @@ namespace ak {
 
 		// ############################################################################################################
 
+		// Allocation free conversion
+
+		//! @brief Will write the date to the buffer and return the number of characters written (no terminating zero)
+		//! @param _buffer The buffer to write to, must provide at least maxStringLength characters
+		//! @param _delimiter The delimiter that is used to seperate the day, month and year
+		//! @param _dateFormat The dateFormat of the created string
+		size_t format(char * _buffer, char _delimiter = '-', dateFormat _dateFormat = dfDDMMYYYY) const;
+
+		//! @brief Will write the date to the buffer and return the number of characters written (no terminating zero)
+		//! @param _buffer The buffer to write to, must provide at least maxStringLength characters
+		//! @param _delimiter The delimiter that is used to seperate the day, month and year
+		//! @param _dateFormat The dateFormat of the created string
+		size_t format(char16_t * _buffer, char16_t _delimiter = u'-', dateFormat _dateFormat = dfDDMMYYYY) const;
+
+		//! @brief Will parse the provided characters. Returns false if the input is not three numbers seperated by the delimiter
+		//! @param _string The input characters (not required to be zero terminated)
+		//! @param _length The number of characters
+		//! @param _result The parsed date will be written here
+		//! @param _delimiter The delimiter that seperates the day, month and year
+		//! @param _dateFormat The dateFormat of the input
+		static bool parse(const char * _string, size_t _length, aDate & _result, char _delimiter = '-', dateFormat _dateFormat = dfDDMMYYYY);
+
+		//! @brief Will parse the provided characters. Returns false if the input is not three numbers seperated by the delimiter
+		//! @param _string The input characters (not required to be zero terminated)
+		//! @param _length The number of characters
+		//! @param _result The parsed date will be written here
+		//! @param _delimiter The delimiter that seperates the day, month and year
+		//! @param _dateFormat The dateFormat of the input
+		static bool parse(const char16_t * _string, size_t _length, aDate & _result, char16_t _delimiter = u'-', dateFormat _dateFormat = dfDDMMYYYY);
+
+		//! @brief Will parse multiple strings. Invalid entries are set to the default date
+		//! @param _strings The input strings
+		//! @param _lengths The length of every input string
+		//! @param _count The number of strings
+		//! @param _results The array to write the dates to, must provide _count entries
+		//! @return The number of strings that were parsed successfully
+		static size_t parseBatch(const char * const * _strings, const size_t * _lengths, size_t _count, aDate * _results, char _delimiter = '-', dateFormat _dateFormat = dfDDMMYYYY);
+
+		//! @brief Will parse fixed width records (two digit day and month, four digit year, one character delimiters).
+		//! Invalid entries are set to the default date
+		//! @param _buffer The buffer containing the records
+		//! @param _stride The distance between the start of two records in characters (at least 10)
+		//! @param _count The number of records
+		//! @param _results The array to write the dates to, must provide _count entries
+		//! @return The number of records that were parsed successfully
+		static size_t parseFixedBatch(const char * _buffer, size_t _stride, size_t _count, aDate * _results, char _delimiter = '-', dateFormat _dateFormat = dfDDMMYYYY);
+
+		//! @brief Will parse fixed width records (two digit day and month, four digit year, one character delimiters).
+		//! Invalid entries are set to the default date
+		//! @param _buffer The buffer containing the records
+		//! @param _stride The distance between the start of two records in characters (at least 10)
+		//! @param _count The number of records
+		//! @param _results The array to write the dates to, must provide _count entries
+		//! @return The number of records that were parsed successfully
+		static size_t parseFixedBatch(const char16_t * _buffer, size_t _stride, size_t _count, aDate * _results, char16_t _delimiter = u'-', dateFormat _dateFormat = dfDDMMYYYY);
+
+		//! @brief Will write multiple dates as records with a fixed distance. The year is written with four digits so the
+		//! records can be read back with parseFixedBatch. Unused characters of a record are not touched
+		//! @param _dates The dates to write
+		//! @param _count The number of dates
+		//! @param _buffer The buffer to write to, must provide _count * _stride characters
+		//! @param _stride The distance between the start of two records (10 for years 0 to 9999, maxStringLength for any date)
+		static void formatBatch(const aDate * _dates, size_t _count, char * _buffer, size_t _stride, char _delimiter = '-', dateFormat _dateFormat = dfDDMMYYYY);
+
+		// ############################################################################################################
+
 		// Operators
 
-		aDate & operator = (const aDate & _other);
 		aDate & operator = (const QDate & _other);
 
+		constexpr aDate & operator += (int _days) { m_days += _days; return *this; }
+		constexpr aDate & operator -= (int _days) { m_days -= _days; return *this; }
+
 	private:
-		int		m_y;		//! The year value
-		int		m_m;		//! The month value
-		int		m_d;		//! The day value
+		constexpr aDate(int _days, int) : m_days(_days) {}
+
+		static constexpr int floorDiv(int _value, int _base) { return (_value >= 0 ? _value / _base : -((-_value + _base - 1) / _base)); }
+
+		//! @brief Will return the days since 01.01.1970 for the provided date (proleptic gregorian calendar)
+		static constexpr int daysFromCivil(int _y, int _m, int _d) {
+			// Carry the month into the year first, the day is added linearly
+			const int carry = floorDiv(_m - 1, 12);
+			_y += carry;
+			_m -= carry * 12;
+			_y -= (_m <= 2 ? 1 : 0);
+			const int era = (_y >= 0 ? _y : _y - 399) / 400;
+			const int yoe = _y - era * 400;
+			const int doy = (153 * (_m > 2 ? _m - 3 : _m + 9) + 2) / 5 + _d - 1;
+			const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+			return era * 146097 + doe - 719468;
+		}
+
+		//! @brief Will calculate the date for the provided days since 01.01.1970
+		static constexpr void civilFromDays(int _days, int & _y, int & _m, int & _d) {
+			_days += 719468;
+			const int era = (_days >= 0 ? _days : _days - 146096) / 146097;
+			const int doe = _days - era * 146097;
+			const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+			const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+			const int mp = (5 * doy + 2) / 153;
+			_d = doy - (153 * mp + 2) / 5 + 1;
+			_m = (mp < 10 ? mp + 3 : mp - 9);
+			_y = yoe + era * 400 + (_m <= 2 ? 1 : 0);
+		}
+
+		int		m_days;		//! The days since 01.01.1970
 	};
 
-	UICORE_API_EXPORT bool operator == (const aDate & _lhv, const aDate & _rhv);
+	constexpr bool operator == (const aDate & _lhv, const aDate & _rhv) { return _lhv.daysSinceEpoch() == _rhv.daysSinceEpoch(); }
+	constexpr bool operator != (const aDate & _lhv, const aDate & _rhv) { return _lhv.daysSinceEpoch() != _rhv.daysSinceEpoch(); }
+	constexpr bool operator < (const aDate & _lhv, const aDate & _rhv) { return _lhv.daysSinceEpoch() < _rhv.daysSinceEpoch(); }
+	constexpr bool operator > (const aDate & _lhv, const aDate & _rhv) { return _lhv.daysSinceEpoch() > _rhv.daysSinceEpoch(); }
+	constexpr bool operator <= (const aDate & _lhv, const aDate & _rhv) { return _lhv.daysSinceEpoch() <= _rhv.daysSinceEpoch(); }
+	constexpr bool operator >= (const aDate & _lhv, const aDate & _rhv) { return _lhv.daysSinceEpoch() >= _rhv.daysSinceEpoch(); }
+
+	constexpr aDate operator + (const aDate & _lhv, int _days) { return _lhv.addDays(_days); }
+	constexpr aDate operator - (const aDate & _lhv, int _days) { return _lhv.addDays(-_days); }
+
+	//! @brief Will return the number of days between the dates
+	constexpr int operator - (const aDate & _lhv, const aDate & _rhv) { return _rhv.daysTo(_lhv); }
+
 	UICORE_API_EXPORT bool operator == (const aDate & _lhv, const QDate & _rhv);
 	UICORE_API_EXPORT bool operator == (const QDate & _lhv, const aDate & _rhv);
 
-	UICORE_API_EXPORT bool operator != (const aDate & _lhv, const aDate & _rhv);
 	UICORE_API_EXPORT bool operator != (const aDate & _lhv, const QDate & _rhv);
 	UICORE_API_EXPORT bool operator != (const QDate & _lhv, const aDate & _rhv);
 	
-	UICORE_API_EXPORT bool operator < (const aDate & _lhv, const aDate & _rhv);
 	UICORE_API_EXPORT bool operator < (const aDate & _lhv, const QDate & _rhv);
 	UICORE_API_EXPORT bool operator < (const QDate & _lhv, const aDate & _rhv);
 	
-	UICORE_API_EXPORT bool operator > (const aDate & _lhv, const aDate & _rhv);
 	UICORE_API_EXPORT bool operator > (const aDate & _lhv, const QDate & _rhv);
 	UICORE_API_EXPORT bool operator > (const QDate & _lhv, const aDate & _rhv);
 	
-	UICORE_API_EXPORT bool operator <= (const aDate & _lhv, const aDate & _rhv);
 	UICORE_API_EXPORT bool operator <= (const aDate & _lhv, const QDate & _rhv);
 	UICORE_API_EXPORT bool operator <= (const QDate & _lhv, const aDate & _rhv);
 	
-	UICORE_API_EXPORT bool operator >= (const aDate & _lhv, const aDate & _rhv);
 	UICORE_API_EXPORT bool operator >= (const aDate & _lhv, const QDate & _rhv);
 	UICORE_API_EXPORT bool operator >= (const QDate & _lhv, const aDate & _rhv);
 
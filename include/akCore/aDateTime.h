@@ -0,0 +1,122 @@
+/*
+ *	File:		aDateTime.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// uiCore header
+#include <akCore/akCore.h>
+#include <akCore/globalDataTypes.h>
+#include <akCore/aDate.h>
+#include <akCore/aTime.h>
+
+// QT header
+#include <qstring.h>
+#include <qdatetime.h>
+
+// C++ header
+#include <string>
+
+namespace ak {
+
+	//! @brief A date and time stored as the number of milliseconds since 01.01.1970 00:00.
+	//! The value is a wall clock time without time zone information
+	class UICORE_API_EXPORT aDateTime {
+	public:
+		//! @brief Default constructor, the date time is 01.01.1900 00:00
+		constexpr aDateTime() : m_msecs(static_cast<long long>(aDate().daysSinceEpoch()) * 86400000) {}
+		constexpr aDateTime(const aDate & _date, const aTime & _time = aTime())
+			: m_msecs(static_cast<long long>(_date.daysSinceEpoch()) * 86400000 + _time.msecsSinceMidnight()) {}
+		aDateTime(const QDateTime & _dateTime);
+
+		//! @brief Will create a date time from the number of milliseconds since 01.01.1970 00:00
+		static constexpr aDateTime fromMSecsSinceEpoch(long long _msecs) { return aDateTime(_msecs, 0); }
+
+		// ############################################################################################################
+
+		// Getter
+
+		//! @brief Will return the date
+		constexpr aDate date(void) const { return aDate::fromDaysSinceEpoch(static_cast<int>(days())); }
+
+		//! @brief Will return the time
+		constexpr aTime time(void) const { return aTime::fromMSecsSinceMidnight(static_cast<int>(m_msecs - days() * 86400000)); }
+
+		//! @brief Will return the number of milliseconds since 01.01.1970 00:00
+		constexpr long long msecsSinceEpoch(void) const { return m_msecs; }
+
+		//! @brief Will return the number of milliseconds from this date time to the other one
+		constexpr long long msecsTo(const aDateTime & _other) const { return _other.m_msecs - m_msecs; }
+
+		//! @brief Will return a copy with the milliseconds added
+		constexpr aDateTime addMSecs(long long _msecs) const { return aDateTime(m_msecs + _msecs, 0); }
+
+		//! @brief Will return a copy with the days added
+		constexpr aDateTime addDays(int _days) const { return aDateTime(m_msecs + static_cast<long long>(_days) * 86400000, 0); }
+
+		//! @brief Will return a QDateTime (local time) representing this object
+		QDateTime toQDateTime(void) const;
+
+		//! @brief Will return a String representation of this date time
+		//! @param _separator The text placed between the date and the time
+		//! @param _dateDelimiter The delimiter that is used to seperate the day, month and year
+		//! @param _timeDelimiter The delimiter that is used to seperate the hour, minute, second and millisecond
+		//! @param _dateFormat The dateFormat of the created string
+		//! @param _timeFormat The timeFormat of the created string
+		std::string toString(const std::string & _separator = " ", const std::string & _dateDelimiter = "-", const std::string & _timeDelimiter = ":",
+			dateFormat _dateFormat = dfDDMMYYYY, timeFormat _timeFormat = tfHHMM) const;
+
+		//! @brief Will return a String representation of this date time
+		//! @param _separator The text placed between the date and the time
+		//! @param _dateDelimiter The delimiter that is used to seperate the day, month and year
+		//! @param _timeDelimiter The delimiter that is used to seperate the hour, minute, second and millisecond
+		//! @param _dateFormat The dateFormat of the created string
+		//! @param _timeFormat The timeFormat of the created string
+		QString toQString(const QString & _separator = " ", const QString & _dateDelimiter = "-", const QString & _timeDelimiter = ":",
+			dateFormat _dateFormat = dfDDMMYYYY, timeFormat _timeFormat = tfHHMM) const;
+
+		// ############################################################################################################
+
+		// Setter
+
+		//! @brief Will set the date, the time is not changed
+		constexpr void setDate(const aDate & _date) { *this = aDateTime(_date, time()); }
+
+		//! @brief Will set the time, the date is not changed
+		constexpr void setTime(const aTime & _time) { *this = aDateTime(date(), _time); }
+
+		// ############################################################################################################
+
+		// Operators
+
+		constexpr aDateTime & operator += (long long _msecs) { m_msecs += _msecs; return *this; }
+		constexpr aDateTime & operator -= (long long _msecs) { m_msecs -= _msecs; return *this; }
+
+	private:
+		constexpr aDateTime(long long _msecs, int) : m_msecs(_msecs) {}
+
+		//! @brief Will return the days since 01.01.1970 (floor division)
+		constexpr long long days(void) const { return (m_msecs >= 0 ? m_msecs / 86400000 : -((-m_msecs + 86400000 - 1) / 86400000)); }
+
+		long long		m_msecs;		//! The milliseconds since 01.01.1970 00:00
+	};
+
+	constexpr bool operator == (const aDateTime & _lhv, const aDateTime & _rhv) { return _lhv.msecsSinceEpoch() == _rhv.msecsSinceEpoch(); }
+	constexpr bool operator != (const aDateTime & _lhv, const aDateTime & _rhv) { return _lhv.msecsSinceEpoch() != _rhv.msecsSinceEpoch(); }
+	constexpr bool operator < (const aDateTime & _lhv, const aDateTime & _rhv) { return _lhv.msecsSinceEpoch() < _rhv.msecsSinceEpoch(); }
+	constexpr bool operator > (const aDateTime & _lhv, const aDateTime & _rhv) { return _lhv.msecsSinceEpoch() > _rhv.msecsSinceEpoch(); }
+	constexpr bool operator <= (const aDateTime & _lhv, const aDateTime & _rhv) { return _lhv.msecsSinceEpoch() <= _rhv.msecsSinceEpoch(); }
+	constexpr bool operator >= (const aDateTime & _lhv, const aDateTime & _rhv) { return _lhv.msecsSinceEpoch() >= _rhv.msecsSinceEpoch(); }
+
+	//! @brief Will return the number of milliseconds between the date times
+	constexpr long long operator - (const aDateTime & _lhv, const aDateTime & _rhv) { return _rhv.msecsTo(_lhv); }
+
+}
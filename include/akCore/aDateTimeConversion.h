@@ -0,0 +1,75 @@
+/*
+ *	File:		aDateTimeConversion.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// C++ header
+#include <cstddef>
+
+namespace ak {
+
+	//! @brief Allocation free helper used to convert date and time values from and to characters.
+	//! The functions are templated on the character type (char, char16_t, wchar_t)
+	namespace dateTimeConversion {
+
+		//! @brief Will read an unsigned decimal number starting at _pos and move _pos behind the last digit.
+		//! Returns false if no digit was found or the number has more than 9 digits
+		template <class T> inline bool readNumber(const T *& _pos, const T * _end, int & _value) {
+			const T * begin = _pos;
+			int v = 0;
+			while (_pos != _end && *_pos >= T('0') && *_pos <= T('9')) {
+				if (_pos - begin == 9) { return false; }	// A tenth digit may overflow the int
+				v = v * 10 + static_cast<int>(*_pos - T('0'));
+				++_pos;
+			}
+			if (_pos == begin) { return false; }
+			_value = v;
+			return true;
+		}
+
+		//! @brief Will read a decimal number with a fixed amount of digits.
+		//! The loop has no early exit so the compiler may unroll and vectorize it. Returns -1 if a character is not a digit
+		template <class T> inline int readFixed(const T * _pos, int _width) {
+			int v = 0;
+			unsigned int bad = 0;
+			for (int i = 0; i < _width; i++) {
+				unsigned int d = static_cast<unsigned int>(static_cast<int>(_pos[i]) - '0');
+				bad |= (d > 9);
+				v = v * 10 + static_cast<int>(d);
+			}
+			return bad ? -1 : v;
+		}
+
+		//! @brief Will write the value with at least _minWidth digits (leading zeros) and return the number of characters written.
+		//! At most 11 characters are written
+		template <class T> inline size_t writeNumber(T * _pos, int _value, int _minWidth) {
+			T buffer[11];
+			int n = 0;
+			unsigned int v = (_value < 0 ? 0u - static_cast<unsigned int>(_value) : static_cast<unsigned int>(_value));
+			do { buffer[n++] = static_cast<T>('0' + v % 10); v /= 10; } while (v != 0);
+			while (n < _minWidth && n < 10) { buffer[n++] = T('0'); }
+			size_t len = 0;
+			if (_value < 0) { _pos[len++] = T('-'); }
+			while (n > 0) { _pos[len++] = buffer[--n]; }
+			return len;
+		}
+
+		//! @brief Will normalize the value to the range [0, _base) and return the carry to the next unit (floor division)
+		inline int carry(int & _value, int _base) {
+			int q = _value / _base;
+			_value -= q * _base;
+			if (_value < 0) { _value += _base; q--; }
+			return q;
+		}
+
+	}
+}
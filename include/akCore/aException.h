@@ -15,6 +15,8 @@
 // C++ header
 #include <exception>			// Base class
 #include <string>				// std::string
+#include <memory>				// std::shared_ptr
+#include <mutex>				// std::once_flag
 
 // AK header
 #include <akCore/globalDataTypes.h>
@@ -31,6 +33,8 @@ namespace ak {
 	//!			@ Inner function
 	//!			@ Outter function
 	//!			@ Initial calling function
+	//! The locations are stored as a chain of frames that share the frames of the forwarded exception,
+	//! the text is only created when what() or getWhere() is called. what() may be called from multiple threads
 	class UICORE_API_EXPORT aException : public std::exception {
 	public:
 
@@ -48,6 +52,13 @@ namespace ak {
 			BadAlloc
 		};
 
+		//! @brief A location that is known to be a string literal, it is referenced instead of copied.
+		//! Create it with A_LITERAL_LOCATION, the macro only compiles for string literals
+		struct literalLocation {
+			explicit literalLocation(const char * _text) : text(_text) {}
+			const char *	text;
+		};
+
 		//! @brief Default constructor. Will initialize the type with undefined
 		aException();
 
@@ -91,7 +102,18 @@ namespace ak {
 			exceptionType				_exType = exceptionType::Undefined
 		);
 
+		//! @brief Assignment constructor. Will set the internal variables
+		//! @param _exWhat The exception message
+		//! @param _exWhere The location where the exception was thrown from, is not copied
+		//! @param _exType The type of the exception
+		aException(
+			const char *				_exWhat,
+			literalLocation				_exWhere,
+			exceptionType				_exType = exceptionType::Undefined
+		);
+
 		//! @brief Copy constructor. Will copy all information from the other exception.
+		//! The output message is not copied, the copy creates it when what() is called
 		//! @param _other The other exception
 		aException(
 			const aException &			_other
@@ -106,6 +128,20 @@ namespace ak {
 			const char *				_exWhere
 		);
 
+		//! @brief Forward constructor. Will copy all information from the other exception and append the new location
+		//! @brief _other The other exception the information will be copied from
+		//! @brief _exWhere The new location message which will be appended, is not copied
+		aException(
+			const aException &			_other,
+			literalLocation				_exWhere
+		);
+
+		//! @brief Assignment operator. Will copy all information from the other exception
+		//! @param _other The other exception
+		aException & operator = (
+			const aException &			_other
+		);
+
 		//! @brief Deconstructor
 		virtual ~aException() throw();
 
@@ -122,14 +158,43 @@ namespace ak {
 		exceptionType getType(void) const;
 
 	protected:
-		std::string						m_what;								//! Contains the exception message
-		std::string						m_where;								//! Contains the location desription
-		exceptionType					m_type;								//! Contains the exception type which is initialized as undefined
+		//! A single location, the location text is only copied if it was not provided as a literalLocation
+		struct whereFrame {
+			const char *						location;
+			std::string							ownedLocation;
+			std::shared_ptr<const whereFrame>	inner;
+		};
 
-		void buildOut(void);													//! Used internally to build the output string
+		std::string							m_what;								//! Contains the exception message
+		std::shared_ptr<const whereFrame>	m_where;							//! The outermost location
+		exceptionType						m_type;								//! Contains the exception type which is initialized as undefined
+
+		void buildOut(void) const;												//! Used internally to build the output string
 
 	private:
-		std::string						m_out;									//! Contains the output message which will be returned in the what() function
+		bool								m_isDefault;						//! If true, the exception was default constructed
+		mutable std::string					m_out;								//! Contains the output message which will be returned in the what() function
+		std::unique_ptr<std::once_flag>		m_outIsBuilt;						//! Ensures that the output message is only built once, replaced on assignment
 	};
 
 } // namespace ak
+
+// ###########################################################################################################################################
+
+// Forwarding
+
+//! Creates a location that is referenced by the exception instead of copied, only compiles for string literals
+#define A_LITERAL_LOCATION(___location) ak::aException::literalLocation("" ___location)
+
+//! Define AK_NO_EXCEPTION_FORWARDING to remove the wrap and rethrow blocks.
+//! Exceptions are then passed on unchanged (without the location chain) and the blocks cost nothing on the non-throwing path
+#ifdef AK_NO_EXCEPTION_FORWARDING
+#define A_TRY
+#define A_CATCH_FORWARD(___location)
+#else
+#define A_TRY try
+#define A_CATCH_FORWARD(___location) \
+	catch (const ak::aException & e) { throw ak::aException(e, A_LITERAL_LOCATION(___location)); } \
+	catch (const std::exception & e) { throw ak::aException(e.what(), A_LITERAL_LOCATION(___location)); } \
+	catch (...) { throw ak::aException("Unknown error", ___location); }
+#endif
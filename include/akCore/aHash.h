@@ -0,0 +1,102 @@
+/*
+ *	File:		aHash.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// AK header
+#include <akCore/globalDataTypes.h>
+#include <akCore/akCore.h>
+
+// Qt header
+#include <qbytearray.h>
+#include <qcryptographichash.h>
+#include <qstring.h>
+#include <qstringlist.h>
+
+// C++ header
+#include <vector>
+
+namespace ak {
+
+	//! @brief Incremental hash calculation.
+	//! Create the object (or call reset), add the data in any number of calls and request the result
+	class UICORE_API_EXPORT aHash {
+	public:
+		//! @brief Constructor
+		//! @param _algorithm The algorithm used to calculate the hash
+		aHash(HashAlgorithm _algorithm = hashSha_256);
+
+		virtual ~aHash();
+
+		//! @brief Will reset the hash so a new calculation can be started
+		void reset(void);
+
+		//! @brief Will add the data to the hash
+		//! @param _data The data to add
+		//! @param _length The number of bytes to add
+		void addData(const char * _data, size_t _length);
+
+		//! @brief Will add the data to the hash
+		void addData(const QByteArray & _data);
+
+		//! @brief Will add the UTF-8 representation of the string to the hash
+		void addData(const QString & _string);
+
+		//! @brief Will add the content of the file to the hash. The file is memory mapped if possible.
+		//! Returns false if the file could not be read
+		//! @param _filePath The path of the file
+		bool addFile(const QString & _filePath);
+
+		//! @brief Will return the raw hash of the data added so far
+		QByteArray result(void) const;
+
+		//! @brief Will return the hash of the data added so far as a hex string
+		QString resultHex(void) const;
+
+		//! @brief Will return the algorithm used
+		HashAlgorithm algorithm(void) const { return m_algorithm; }
+
+		// #######################################################################################################
+
+		// Static functions
+
+		//! @brief Will return the raw hash of the data
+		static QByteArray hash(const char * _data, size_t _length, HashAlgorithm _algorithm);
+
+		//! @brief Will return the hash of the UTF-8 representation of the string as a hex string
+		static QString hashHex(const QString & _string, HashAlgorithm _algorithm);
+
+		//! @brief Will return the hash of the file content as a hex string, an empty string is returned if the file could not be read
+		//! @param _filePath The path of the file
+		//! @param _algorithm The algorithm to use
+		//! @param _ok If provided, will be set to false if the file could not be read
+		static QString hashFile(const QString & _filePath, HashAlgorithm _algorithm, bool * _ok = (bool *) nullptr);
+
+		//! @brief Will return the hash of every string as a hex string. Large batches are calculated on multiple threads
+		static std::vector<QString> hashBatch(const QStringList & _strings, HashAlgorithm _algorithm);
+
+		//! @brief Will return the raw hash of every entry. Large batches are calculated on multiple threads
+		static std::vector<QByteArray> hashBatch(const std::vector<QByteArray> & _data, HashAlgorithm _algorithm);
+
+		//! @brief Will return the hash of every file as a hex string, an empty string is returned for files that could not be read.
+		//! The files are hashed on multiple threads
+		static std::vector<QString> hashFiles(const QStringList & _filePaths, HashAlgorithm _algorithm);
+
+	private:
+		QCryptographicHash			m_hash;
+		HashAlgorithm				m_algorithm;
+
+		aHash(const aHash &) = delete;
+		aHash & operator = (const aHash &) = delete;
+	};
+
+}
@@ -15,11 +15,18 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <memory>
 
 #include <akCore/globalDataTypes.h>
+#include <akCore/aJSONArena.h>
 
 namespace ak {
 
+	//! @brief A JSON item
+	//! Array and Object items created by the user are document roots and own a aJSONArena.
+	//! All items added to a document (and the strings, arrays and maps they hold) are allocated from the arena of the document.
+	//! Items obtained by moving out of a document keep referring to the arena of that document and must not outlive it.
+	//! Items moved into a document from a different arena are deep copied into the arena of the document.
 	class UICORE_API_EXPORT aJSON {
 	public:
 
@@ -33,10 +40,32 @@ namespace ak {
 			String
 		};
 
+		//! @brief The string type used for values and member keys
+		//! Short strings are stored inside the item (small string storage), longer ones are placed in the arena
+		typedef std::basic_string<char, std::char_traits<char>, aJSONArenaAllocator<char>> stringType;
+
+		//! @brief Transparent key comparator, allows member lookup without creating a key string
+		struct keyLess {
+			typedef void is_transparent;
+			template <class A, class B> bool operator() (const A & _lhv, const B & _rhv) const {
+				return compareKeys(_lhv.data(), _lhv.size(), _rhv.data(), _rhv.size()) < 0;
+			}
+		};
+
+		typedef std::vector<aJSON, aJSONArenaAllocator<aJSON>> arrayType;
+		typedef std::map<stringType, aJSON, keyLess, aJSONArenaAllocator<std::pair<const stringType, aJSON>>> objectType;
+
 		//! @brief Will create a empty item with the specified type
-		//! The type can not be changed
+		//! The type can not be changed.
+		//! If the type is Array or Object the item will become a document root with its own arena
 		aJSON(jsonType _type);
 
+		//! @brief Will create a empty item with the specified type that allocates from the provided arena
+		//! If no arena is provided and the type is Array or Object the item will create its own arena
+		//! @param _type The item type
+		//! @param _arena The arena to allocate from
+		aJSON(jsonType _type, aJSONArena * _arena);
+
 		//! @brief Will create an item with the type Boolean
 		//! @param _v The value to set
 		aJSON(bool _v);
@@ -62,11 +91,32 @@ namespace ak {
 		aJSON(const std::string & _v);
 
 		//! @brief Will create a copy of the other json item
+		//! If the other item is an Array or Object the copy will become a document root with its own arena
 		//! @param _other The other item
 		aJSON(const aJSON & _other);
 
+		//! @brief Will create a deep copy of the other json item that allocates from the provided arena
+		//! @param _other The other item
+		//! @param _arena The arena to allocate from
+		aJSON(const aJSON & _other, aJSONArena * _arena);
+
+		//! @brief Will take over the contents (and the arena) of the other item
+		//! The other item will be Null afterwards
+		//! @param _other The other item
+		aJSON(aJSON && _other) noexcept;
+
 		virtual ~aJSON();
 
+		//! @brief Will replace the contents of this item with a deep copy of the other item
+		//! If this item is part of a document the copy will be placed in the arena of this document
+		aJSON & operator = (const aJSON & _other);
+
+		//! @brief Will take over the contents (and the arena) of the other item
+		//! The other item will be Null afterwards.
+		//! If this item is part of a document and the other item uses a different arena, the contents are deep copied
+		//! into the arena of this document instead and the other item is left unchanged
+		aJSON & operator = (aJSON && _other);
+
 		// #############################################################
 
 		// Setter
@@ -74,17 +124,17 @@ namespace ak {
 		//! @brief Will set the Boolean value
 		//! This function will have no effect if the item type is not Boolean
 		//! @param _v The value to set
-		void setBool(bool _v) { m_bool = _v; }
+		void setBool(bool _v) { if (m_type == Boolean) { m_bool = _v; } }
 
 		//! @brief Will set the Integer value
 		//! This function will have no effect if the item type is not Integer
 		//! @param _v The value to set
-		void setInt(int _v) { m_int = _v; }
+		void setInt(int _v) { if (m_type == Integer) { m_int = _v; } }
 
 		//! @brief Will set the Double value
 		//! This function will have no effect if the item type is not Double
 		//! @param _v The value to set
-		void setDouble(double _v) { m_double = _v; }
+		void setDouble(double _v) { if (m_type == Double) { m_double = _v; } }
 
 		//! @brief Will set the String value
 		//! This function will have no effect if the item type is not String
@@ -94,12 +144,12 @@ namespace ak {
 		//! @brief Will set the String value
 		//! This function will have no effect if the item type is not String
 		//! @param _v The value to set
-		void setString(const char * _v) { m_string = _v; }
+		void setString(const char * _v) { if (m_type == String) { m_string.assign(_v); } }
 
 		//! @brief Will set the String value
 		//! This function will have no effect if the item type is not String
 		//! @param _v The value to set
-		void setString(const std::string & _v) { m_string = _v; }
+		void setString(const std::string & _v) { if (m_type == String) { m_string.assign(_v.data(), _v.size()); } }
 
 		//! @brief Will reserve memory for the array
 		//! This function will have no effect if the item type is not Array
@@ -141,6 +191,19 @@ namespace ak {
 		//! @param _v The value to add
 		void pushBack(const aJSON & _v);
 
+		//! @brief Will move the provided value to the end of the array
+		//! This function will have no effect if the item type is not Array
+		//! If the value uses a different arena it will be deep copied into the arena of this document
+		//! @param _v The value to add
+		void pushBack(aJSON && _v);
+
+		//! @brief Will construct a new item with the specified type at the end of the array and return it
+		//! The new item allocates from the arena of this document.
+		//! The returned reference is invalidated when further items are added to the array.
+		//! This function may be used only for array type item
+		//! @param _type The type of the new item
+		aJSON & emplaceBack(jsonType _type);
+
 		//! @brief Will add the provided member to the object
 		//! This function will have no effect if the item type is not Object
 		//! The order in which the members are added may differ from the order at export
@@ -183,6 +246,13 @@ namespace ak {
 		//! @param _v The value to add
 		void addMember(const char * _member, const aJSON & _v);
 
+		//! @brief Will move the provided member to the object
+		//! This function will have no effect if the item type is not Object
+		//! The order in which the members are added may differ from the order at export
+		//! If the value uses a different arena it will be deep copied into the arena of this document
+		//! @param _v The value to add
+		void addMember(const char * _member, aJSON && _v);
+
 		//! @brief Will add the provided member to the object
 		//! This function will have no effect if the item type is not Object
 		//! The order in which the members are added may differ from the order at export
@@ -225,6 +295,29 @@ namespace ak {
 		//! @param _v The value to add
 		void addMember(const std::string & _member, const aJSON & _v);
 
+		//! @brief Will move the provided member to the object
+		//! This function will have no effect if the item type is not Object
+		//! The order in which the members are added may differ from the order at export
+		//! If the value uses a different arena it will be deep copied into the arena of this document
+		//! @param _v The value to add
+		void addMember(const std::string & _member, aJSON && _v);
+
+		//! @brief Will construct a new member with the specified type in the object and return it
+		//! An existing member with the same key will be replaced.
+		//! The new item allocates from the arena of this document.
+		//! This function may be used only for object type item
+		//! @param _member The member key
+		//! @param _type The type of the new item
+		aJSON & emplaceMember(const char * _member, jsonType _type);
+
+		//! @brief Will construct a new member with the specified type in the object and return it
+		//! An existing member with the same key will be replaced.
+		//! The new item allocates from the arena of this document.
+		//! This function may be used only for object type item
+		//! @param _member The member key
+		//! @param _type The type of the new item
+		aJSON & emplaceMember(const std::string & _member, jsonType _type);
+
 		// #############################################################
 
 		// Getter
@@ -243,8 +336,8 @@ namespace ak {
 		inline bool getBool(void) const { return m_bool; }
 
 		//! @brief Will return the double value
-		//! This function may be used only for double type item
-		inline double getDouble(void) const { return m_double; }
+		//! This function may be used only for double or integer type item
+		inline double getDouble(void) const { return (m_type == Integer ? static_cast<double>(m_int) : m_double); }
 
 		//! @brief Will return the integer value
 		//! This function may be used only for integer type item
@@ -256,7 +349,11 @@ namespace ak {
 
 		//! @brief Will return the string value
 		//! This function may be used only for string type item
-		inline std::string getString(void) { return m_string; }
+		inline std::string getString(void) const { return std::string(m_string.data(), m_string.size()); }
+
+		//! @brief Will return the string value without creating a copy
+		//! This function may be used only for string type item
+		inline const char * getCString(void) const { return m_string.c_str(); }
 
 		//! @brief Will return true if the object has a member with the specified key
 		//! This function may be used only for object type item
@@ -266,6 +363,16 @@ namespace ak {
 		//! This function may be used only for object type item
 		aJSON getMember(const std::string & _key) const;
 
+		//! @brief Will return a pointer to the item with the specified member key or nullptr if the member does not exist
+		//! No copy of the member is created.
+		//! This function may be used only for object type item
+		const aJSON * findMember(const char * _key) const;
+
+		//! @brief Will return a pointer to the item with the specified member key or nullptr if the member does not exist
+		//! No copy of the member is created.
+		//! This function may be used only for object type item
+		const aJSON * findMember(const std::string & _key) const;
+
 		//! @brief Will return the item at the specified index
 		//! This function may be used only for array type item
 		aJSON getAt(size_t _index);
@@ -273,21 +380,54 @@ namespace ak {
 		//! @brief Will return the ammount of members in the object or the array size
 		//! This function has only an effect on an objct type or array type item, otherwise will return 0
 		size_t size(void) const;
+
+		//! @brief Will return the arena this item allocates from
+		aJSONArena * arena(void) const { return m_arena; }
+
+		//! @brief Will compare two member keys
+		static int compareKeys(const char * _lhv, size_t _lhvLength, const char * _rhv, size_t _rhvLength);
+
 	private:
 
-		std::string toMultilineString(const std::string & _prefix) const;
+		//! @brief Non owning key reference used for member lookups
+		struct keyRef {
+			keyRef(const char * _data, size_t _size) : m_data(_data), m_size(_size) {}
+			const char * data(void) const { return m_data; }
+			size_t size(void) const { return m_size; }
+		private:
+			const char *	m_data;
+			size_t			m_size;
+		};
+
+		void createContainer(void);
+
+		void destroyContainer(void);
+
+		void copyContentsFrom(const aJSON & _other);
 
-		std::string toValidStringItem(const std::string & _orig) const;
+		void takeValueFrom(aJSON & _other);
 
-		jsonType				m_type;
+		aJSON & memberSlot(const char * _member, size_t _memberLength, jsonType _type);
 
-		std::vector<aJSON>		m_array;
-		bool					m_bool;
-		double					m_double;
-		int						m_int;
-		std::map<std::string,
-			aJSON>				m_obj;
-		std::string				m_string;
+		const aJSON * findMember(const char * _key, size_t _keyLength) const;
+
+		void writeTo(std::string & _out) const;
+
+		void writeMultilineTo(std::string & _out, size_t _indent) const;
+
+		static void writeEscapedString(std::string & _out, const stringType & _str);
+
+		std::shared_ptr<aJSONArena>	m_arenaOwner;			//! Set if this item is a document root that owns its arena
+		aJSONArena *				m_arena;				//! The arena this item allocates from (may be nullptr for scalar items)
+		jsonType					m_type;
+		union {
+			bool					m_bool;
+			int						m_int;
+			double					m_double;
+			arrayType *				m_array;
+			objectType *			m_obj;
+		};
+		stringType					m_string;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+ *	File:		aJSONArena.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// C++ header
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief A monotonic memory arena used by the aJSON document tree
+	//! Memory is handed out from large blocks and is released only when the arena is destroyed.
+	//! Deallocation requests are ignored, so the arena is meant for trees that are built once and dropped as a whole.
+	class UICORE_API_EXPORT aJSONArena {
+	public:
+
+		//! @brief Will create an empty arena. The first block will be allocated on first use
+		//! @param _blockSize The size of a regular memory block
+		aJSONArena(size_t _blockSize = 65536);
+
+		virtual ~aJSONArena();
+
+		//! @brief Will return a pointer to a memory chunk with the requested size and alignment
+		//! @param _size The number of bytes to allocate
+		//! @param _alignment The alignment of the chunk, must be a power of two
+		void * allocate(size_t _size, size_t _alignment);
+
+		//! @brief Will return the number of bytes handed out by this arena
+		size_t usedBytes(void) const { return m_usedBytes; }
+
+		//! @brief Will return the number of bytes reserved by this arena
+		size_t reservedBytes(void) const { return m_reservedBytes; }
+
+	private:
+
+		struct block {
+			block *		next;
+			size_t		size;
+			size_t		used;
+		};
+
+		block * createBlock(size_t _size);
+
+		block *			m_head;
+		size_t			m_blockSize;
+		size_t			m_usedBytes;
+		size_t			m_reservedBytes;
+
+		aJSONArena(const aJSONArena &) = delete;
+		aJSONArena & operator = (const aJSONArena &) = delete;
+	};
+
+	//! @brief STL allocator forwarding to a aJSONArena
+	//! If no arena is provided the allocator will fall back to the global heap
+	template <class T> class aJSONArenaAllocator {
+	public:
+		typedef T value_type;
+		typedef std::true_type propagate_on_container_move_assignment;
+		typedef std::true_type propagate_on_container_swap;
+
+		aJSONArenaAllocator() : m_arena(nullptr) {}
+
+		aJSONArenaAllocator(aJSONArena * _arena) : m_arena(_arena) {}
+
+		template <class U> aJSONArenaAllocator(const aJSONArenaAllocator<U> & _other) : m_arena(_other.arena()) {}
+
+		T * allocate(size_t _n) {
+			if (m_arena) { return static_cast<T *>(m_arena->allocate(_n * sizeof(T), alignof(T))); }
+			return static_cast<T *>(::operator new(_n * sizeof(T)));
+		}
+
+		void deallocate(T * _p, size_t) {
+			if (m_arena == nullptr) { ::operator delete(_p); }
+		}
+
+		//! @brief Will return the arena this allocator forwards to
+		aJSONArena * arena(void) const { return m_arena; }
+
+	private:
+		aJSONArena *		m_arena;
+	};
+
+	template <class T, class U> bool operator == (const aJSONArenaAllocator<T> & _lhv, const aJSONArenaAllocator<U> & _rhv) { return _lhv.arena() == _rhv.arena(); }
+	template <class T, class U> bool operator != (const aJSONArenaAllocator<T> & _lhv, const aJSONArenaAllocator<U> & _rhv) { return _lhv.arena() != _rhv.arena(); }
+
+}
@@ -0,0 +1,80 @@
+/*
+ *	File:		aProgressTask.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qstring.h>				// QString
+
+// C++ header
+#include <atomic>
+#include <mutex>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief The progress of a running task.
+	//! The progress may be reported from any thread without locking, the display samples it periodically.
+	//! A task with a total of 0 or less is displayed as continuous
+	class UICORE_API_EXPORT aProgressTask {
+	public:
+		//! @brief Constructor
+		//! @param _label The text displayed while the task is running
+		//! @param _total The total progress of the task, 0 if unknown
+		aProgressTask(
+			const QString &			_label,
+			long long				_total = 0
+		);
+
+		virtual ~aProgressTask();
+
+		//! @brief Will set the current progress, lock free
+		void setProgress(long long _progress) { m_progress.store(_progress, std::memory_order_relaxed); }
+
+		//! @brief Will add the provided value to the current progress, lock free
+		void addProgress(long long _delta = 1) { m_progress.fetch_add(_delta, std::memory_order_relaxed); }
+
+		//! @brief Will set the total progress, lock free
+		void setTotal(long long _total) { m_total.store(_total, std::memory_order_relaxed); }
+
+		//! @brief Will mark the task as finished, it will be removed from the display on the next sample
+		void finish(void) { m_isFinished.store(true, std::memory_order_release); }
+
+		//! @brief Will set the label
+		void setLabel(
+			const QString &			_label
+		);
+
+		long long progress(void) const { return m_progress.load(std::memory_order_relaxed); }
+
+		long long total(void) const { return m_total.load(std::memory_order_relaxed); }
+
+		bool isFinished(void) const { return m_isFinished.load(std::memory_order_acquire); }
+
+		bool isContinuous(void) const { return total() <= 0; }
+
+		QString label(void) const;
+
+	private:
+		std::atomic<long long>		m_progress;
+		std::atomic<long long>		m_total;
+		std::atomic<bool>			m_isFinished;
+		mutable std::mutex			m_labelMutex;
+		QString						m_label;
+
+		aProgressTask(const aProgressTask &) = delete;
+		aProgressTask & operator = (const aProgressTask &) = delete;
+	};
+
+}
@@ -0,0 +1,159 @@
+/*
+ *	File:		aSettingsCache.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// C++ header
+#include <vector>
+
+// Qt header
+#include <qstring.h>				// QString
+#include <qvariant.h>				// QVariant
+#include <qhash.h>					// QHash
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+class QSettings;
+class QTimer;
+
+namespace ak {
+
+	class aMessenger;
+
+	//! @brief A typed settings key
+	//! The key name is created once, keys should be declared as static objects:
+	//!		static const ak::aSettingsKey<int> mySetting("Group/Name", 42);
+	template <class T> class aSettingsKey {
+	public:
+		aSettingsKey(const char * _name, const T & _defaultValue)
+			: m_name(QString::fromUtf8(_name)), m_defaultValue(_defaultValue) {}
+
+		//! @brief Will return the name of the key
+		const QString & name(void) const { return m_name; }
+
+		//! @brief Will return the value used if the setting does not exist
+		const T & defaultValue(void) const { return m_defaultValue; }
+
+	private:
+		QString		m_name;
+		T			m_defaultValue;
+	};
+
+	//! @brief In-memory store for the application settings
+	//! All settings are loaded once on creation. Changed values are kept in memory and
+	//! written to the QSettings in a single batch when the flush timer times out or flush() is called.
+	//! Every change is reported via the messenger: sender is the cache UID, event is etChanged and info1 is the key ID (see keyName())
+	class UICORE_API_EXPORT aSettingsCache {
+	public:
+		//! @brief Constructor
+		//! @param _settings The settings to read from and write to
+		//! @param _messenger The messenger used to send the change notifications
+		//! @param _uid The UID used as sender of the change notifications
+		//! @param _flushInterval The time in milliseconds after a change until the settings are written
+		aSettingsCache(
+			QSettings *				_settings,
+			aMessenger *			_messenger,
+			UID						_uid,
+			int						_flushInterval = 2000
+		);
+
+		//! @brief Deconstructor, will flush all pending changes
+		virtual ~aSettingsCache();
+
+		// ###########################################################################################################################################
+
+		// Data
+
+		//! @brief Will return the value of the setting or the default value if the setting does not exist
+		QVariant value(
+			const QString &			_key,
+			const QVariant &		_defaultValue = QVariant()
+		) const;
+
+		//! @brief Will return the value of the typed setting
+		template <class T> T value(const aSettingsKey<T> & _key) const {
+			const QVariant * v = find(_key.name());
+			return (v == nullptr ? _key.defaultValue() : v->value<T>());
+		}
+
+		//! @brief Will set the value of the setting
+		//! If the value differs from the current value the setting is marked dirty and a change notification is sent
+		void setValue(
+			const QString &			_key,
+			const QVariant &		_value
+		);
+
+		//! @brief Will set the value of the typed setting
+		template <class T> void setValue(const aSettingsKey<T> & _key, const T & _value) { setValue(_key.name(), QVariant::fromValue(_value)); }
+
+		//! @brief Will return true if the setting exists
+		bool contains(
+			const QString &			_key
+		) const { return m_values.contains(_key); }
+
+		//! @brief Will return the name of the key with the provided ID or an empty string if the ID is invalid
+		QString keyName(
+			int						_keyId
+		) const;
+
+		//! @brief Will return the UID used as sender of the change notifications
+		UID uid(void) const { return m_uid; }
+
+		// ###########################################################################################################################################
+
+		// Persistence
+
+		//! @brief Will write all dirty settings to the QSettings
+		void flush(void);
+
+		//! @brief Will return true if there are changes that were not written yet
+		bool isDirty(void) const { return !m_dirtyKeys.empty(); }
+
+		//! @brief Will set the time in milliseconds after a change until the settings are written
+		//! If the interval is 0 the settings are only written on flush() or when the cache is destroyed
+		void setFlushInterval(
+			int						_interval
+		);
+
+		//! @brief Will return the time in milliseconds after a change until the settings are written
+		int flushInterval(void) const { return m_flushInterval; }
+
+	private:
+
+		struct entry {
+			QVariant	value;
+			int			id;
+			bool		dirty;
+		};
+
+		//! @brief Will return the value stored for the key or nullptr
+		const QVariant * find(
+			const QString &			_key
+		) const;
+
+		QSettings *					m_settings;
+		aMessenger *				m_messenger;
+		UID							m_uid;
+		QTimer *					m_timer;
+		int							m_flushInterval;
+
+		QHash<QString, entry>		m_values;
+		std::vector<QString>		m_keyNames;				//! The key names, the index is the key ID
+		std::vector<int>			m_dirtyKeys;			//! The IDs of the keys that were changed since the last flush
+
+		aSettingsCache() = delete;
+		aSettingsCache(const aSettingsCache &) = delete;
+		aSettingsCache & operator = (const aSettingsCache &) = delete;
+	};
+
+}
@@ -0,0 +1,165 @@
+/*
+ *	File:		aStateSnapshot.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// C++ header
+#include <string>
+#include <vector>
+#include <functional>
+
+// Rapid JSON header
+#include <rapidjson/document.h>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief A compact binary snapshot of object settings
+	//! The snapshot contains one entry per object (alias, object type and settings).
+	//! The settings are stored in a binary encoding of the JSON value and are decoded only when requested.
+	//! Binary layout (all integers are little endian):
+	//!		"AKWS" | u16 format version | u16 flags | u32 length + application version
+	//!		u32 entry count | entry count * { u64 alias hash | u32 offset | u32 length } (sorted by hash)
+	//!		u32 payload size | u32 stored size | payload (zlib compressed if the flag is set)
+	//!	Every entry in the payload is: u32 length + alias | u32 length + object type | encoded settings
+	class UICORE_API_EXPORT aStateSnapshot {
+	public:
+
+		enum readResult {
+			rrOk,
+			rrInvalidFormat,
+			rrUnsupportedVersion,
+			rrDecompressionFailed
+		};
+
+		struct entry {
+			unsigned long long	hash;
+			std::string			alias;
+			std::string			objectType;
+			size_t				offset;			//! Offset of the entry in the payload
+			size_t				length;			//! Length of the entry in the payload
+			size_t				settingsOffset;	//! Offset of the encoded settings in the payload
+		};
+
+		//! @brief Writes settings directly in the binary settings encoding.
+		//! Provides the rapidjson SAX handler interface, so a rapidjson::Value can also be written with Accept()
+		class UICORE_API_EXPORT settingsWriter {
+		public:
+			settingsWriter(std::string & _out) : m_out(_out) {}
+
+			bool Null();
+			bool Bool(bool _v);
+			bool Int(int _v) { return Int64(_v); }
+			bool Uint(unsigned _v) { return Int64(_v); }
+			bool Int64(int64_t _v);
+			bool Uint64(uint64_t _v);
+			bool Double(double _v);
+			bool RawNumber(const char * _str, rapidjson::SizeType _length, bool _copy) { return String(_str, _length, _copy); }
+			bool String(const char * _str, rapidjson::SizeType _length, bool _copy = true);
+			bool StartObject();
+			bool Key(const char * _str, rapidjson::SizeType _length, bool _copy = true);
+			bool EndObject(rapidjson::SizeType _count);
+			bool StartArray();
+			bool EndArray(rapidjson::SizeType _count);
+
+		private:
+			struct frame {
+				size_t	start;
+				bool	allInt8;
+			};
+
+			void valueAdded(bool _isInt8);
+
+			std::string &		m_out;
+			std::vector<frame>	m_frames;
+		};
+
+		//! @brief Writes the settings of an entry
+		typedef std::function<void(settingsWriter & _writer)> settingsFunction;
+
+		aStateSnapshot();
+		virtual ~aStateSnapshot();
+
+		// ###########################################################################################################################################
+
+		// Writing
+
+		//! @brief Will set the application version stored in the snapshot
+		void setApplicationVersion(const std::string & _version) { m_applicationVersion = _version; }
+
+		//! @brief Will add the entries from their JSON representation
+		//! The JSON must either be a single entry or an array of entries, an entry looks like this:
+		//!	     { "Alias":"[ObjectAlias]","ObjectType":"[ObjectType]","Settings":{...} }
+		//! @param _json The JSON string
+		//! @param _length The length of the JSON string
+		//! @return false if the JSON does not describe entries, in this case no entry is added
+		bool addEntriesFromJSON(const char * _json, size_t _length);
+
+		//! @brief Will add an entry
+		//! @param _alias The object alias
+		//! @param _objectType The object type
+		//! @param _settings The settings of the object
+		void addEntry(const std::string & _alias, const std::string & _objectType, const rapidjson::Value & _settings);
+
+		//! @brief Will add an entry, the settings are written directly into the snapshot without creating a document
+		//! @param _alias The object alias
+		//! @param _objectType The object type
+		//! @param _writeSettings Writes exactly one value (the settings object) to the provided writer
+		void addEntry(const std::string & _alias, const std::string & _objectType, const settingsFunction & _writeSettings);
+
+		//! @brief Will return the binary representation of the snapshot
+		//! @param _compress If true the payload will be compressed with zlib
+		std::string toBinary(bool _compress) const;
+
+		// ###########################################################################################################################################
+
+		// Reading
+
+		//! @brief Will load the snapshot from the binary representation
+		//! Only the header and the index are decoded
+		readResult fromBinary(const char * _data, size_t _length);
+
+		//! @brief Will return the application version stored in the snapshot
+		const std::string & applicationVersion(void) const { return m_applicationVersion; }
+
+		//! @brief Will return all entries
+		const std::vector<entry> & entries(void) const { return m_entries; }
+
+		//! @brief Will return the entry with the specified alias or nullptr if there is none
+		const entry * findEntry(const std::string & _alias) const;
+
+		//! @brief Will decode the settings of the provided entry into the document
+		//! @return false if the encoded settings are invalid
+		bool readSettings(const entry & _entry, rapidjson::Document & _doc) const;
+
+		//! @brief Will clear all data
+		void clear(void);
+
+		//! @brief Will return the hash used for the alias index
+		static unsigned long long hashAlias(const char * _alias, size_t _length);
+
+	private:
+
+		std::string					m_applicationVersion;
+		std::vector<entry>			m_entries;
+		std::string					m_payload;
+
+		//! @brief Will calculate the hash of the entry and insert it into the sorted entry list
+		void insertEntry(entry && _entry);
+
+		aStateSnapshot(const aStateSnapshot &) = delete;
+		aStateSnapshot & operator = (const aStateSnapshot &) = delete;
+	};
+
+}
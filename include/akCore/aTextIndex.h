@@ -0,0 +1,77 @@
+/*
+ *	File:		aTextIndex.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qstring.h>				// QString
+#include <qhash.h>					// QMultiHash
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief Hash index used to find the ID of an item by its text.
+	//! Multiple items may have the same text, in that case the lowest ID is returned
+	class UICORE_API_EXPORT aTextIndex {
+	public:
+		//! @brief Constructor
+		//! @param _caseSensitivity The case sensitivity used when looking up texts
+		aTextIndex(Qt::CaseSensitivity _caseSensitivity = Qt::CaseSensitive);
+
+		//! @brief Will add the text of an item to the index
+		void add(
+			const QString &			_text,
+			ID						_id
+		);
+
+		//! @brief Will remove the text of an item from the index
+		void remove(
+			const QString &			_text,
+			ID						_id
+		);
+
+		//! @brief Will update the index after the text of an item was changed
+		void rename(
+			const QString &			_oldText,
+			const QString &			_newText,
+			ID						_id
+		);
+
+		//! @brief Will return the ID of the item with the provided text or invalidID if no item has this text
+		ID find(
+			const QString &			_text
+		) const;
+
+		//! @brief Will remove all entries
+		void clear(void);
+
+		//! @brief Returns true if the index contains no entries
+		bool isEmpty(void) const { return m_index.isEmpty(); }
+
+		//! @brief Will set the case sensitivity. The index will be cleared and must be refilled by the caller
+		void setCaseSensitivity(
+			Qt::CaseSensitivity		_caseSensitivity
+		);
+
+		Qt::CaseSensitivity caseSensitivity(void) const { return m_caseSensitivity; }
+
+	private:
+		//! @brief Will return the key stored for the provided text
+		QString key(const QString & _text) const { return (m_caseSensitivity == Qt::CaseSensitive ? _text : _text.toCaseFolded()); }
+
+		QMultiHash<QString, ID>		m_index;
+		Qt::CaseSensitivity			m_caseSensitivity;
+	};
+
+}
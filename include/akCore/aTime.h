@@ -25,29 +25,38 @@
 
 namespace ak {
 
+	//! @brief A time of day stored as the number of milliseconds since midnight.
+	//! The class is trivially copyable, values out of range wrap around midnight
 	class UICORE_API_EXPORT aTime {
 	public:
-		aTime();
-		aTime(int _h, int _m, int _s = 0, int _ms = 0);
+		//! @brief The maximum number of characters written by format() (a valid time requires at most 13)
+		static const size_t maxStringLength = 47;
+
+		constexpr aTime() : m_msecs(0) {}
+		constexpr aTime(int _h, int _m, int _s = 0, int _ms = 0) : m_msecs(normalize(totalMSecs(_h, _m, _s, _ms))) {}
 		aTime(const QTime & _time);
-		aTime(const aTime & _other);
-		virtual ~aTime();
+
+		//! @brief Will create a time from the milliseconds since midnight, the value wraps around midnight
+		static constexpr aTime fromMSecsSinceMidnight(int _msecs) { return aTime(0, 0, 0, _msecs); }
 
 		// ############################################################################################################
 
 		// Getter
 
 		//! @brief Returns the current hour
-		int hour(void) const { return m_h; }
+		constexpr int hour(void) const { return m_msecs / 3600000; }
 
 		//! @brief Returns the current minute
-		int minute(void) const { return m_m; }
+		constexpr int minute(void) const { return (m_msecs / 60000) % 60; }
 
 		//! @brief Returns the current second
-		int second(void) const { return m_s; }
+		constexpr int second(void) const { return (m_msecs / 1000) % 60; }
 
 		//! @brief Returns the current millisecond
-		int msec(void) const { return m_ms; }
+		constexpr int msec(void) const { return m_msecs % 1000; }
+
+		//! @brief Returns the number of milliseconds since midnight
+		constexpr int msecsSinceMidnight(void) const { return m_msecs; }
 
 		//! @brief Will return a String representation of this time
 		//! @param _delimiter The delimiter that is used to seperate the hour, minute, second and millisecond
@@ -73,26 +82,26 @@ namespace ak {
 
 		//! @brief Will set the current hour
 		//! @param _h The value to set
-		void setHour(int _h) { m_h = _h; adjustValues(); }
+		constexpr void setHour(int _h) { set(_h, minute(), second(), msec()); }
 
 		//! @brief Will set the current minute
 		//! @param _m The value to set
-		void setMinute (int _m) { m_m = _m; adjustValues(); }
+		constexpr void setMinute (int _m) { set(hour(), _m, second(), msec()); }
 
 		//! @brief Will set the current second
 		//! @param _s The value to set
-		void setSecond(int _s) { m_s = _s; adjustValues(); }
+		constexpr void setSecond(int _s) { set(hour(), minute(), _s, msec()); }
 
 		//! @brief Will set the current millisecond
 		//! @param _ms The value to set
-		void setMilliSecond(int _ms) { m_ms = _ms; adjustValues(); }
+		constexpr void setMilliSecond(int _ms) { set(hour(), minute(), second(), _ms); }
 
 		//! @brief Will set the current time
 		//! @param _h The hour to set
 		//! @param _m The minute to set
 		//! @param _s The second to set
 		//! @param _ms The millisecond
-		void set(int _h, int _m, int _s = 0, int _ms = 0);
+		constexpr void set(int _h, int _m, int _s = 0, int _ms = 0) { m_msecs = normalize(totalMSecs(_h, _m, _s, _ms)); }
 
 		//! @brief Will set the current time
 		//! @param _time The time to set
@@ -100,7 +109,10 @@ namespace ak {
 
 		//! @brief Will set the current time
 		//! @param _time The time to set
-		void set(const aTime & _time);
+		constexpr void set(const aTime & _time) { m_msecs = _time.m_msecs; }
+
+		//! @brief Will return a copy of this time with the milliseconds added, the result wraps around midnight
+		constexpr aTime addMSecs(int _msecs) const { return fromMSecsSinceMidnight(m_msecs + (_msecs % 86400000)); }
 
 		// ############################################################################################################
 
@@ -139,56 +151,127 @@ namespace ak {
 		//! @param _ms The millisecond value
 		static bool adjustValues(int & _h, int & _m, int & _s, int & _ms);
 
-		//! @brief Will adjust the currently set values
-		bool adjustValues(void);
+		//! @brief Will adjust the currently set values.
+		//! The values are always kept in range, returns false
+		constexpr bool adjustValues(void) const { return false; }
+
+		// ############################################################################################################
+
+		// Allocation free conversion
+
+		//! @brief Will write the time to the buffer and return the number of characters written (no terminating zero)
+		//! @param _buffer The buffer to write to, must provide at least maxStringLength characters
+		//! @param _delimiter The delimiter that is used to seperate the hour, minute, second and millisecond
+		//! @param _timeFormat The timeFormat of the created string
+		size_t format(char * _buffer, char _delimiter = ':', timeFormat _timeFormat = tfHHMM) const;
+
+		//! @brief Will write the time to the buffer and return the number of characters written (no terminating zero)
+		//! @param _buffer The buffer to write to, must provide at least maxStringLength characters
+		//! @param _delimiter The delimiter that is used to seperate the hour, minute, second and millisecond
+		//! @param _timeFormat The timeFormat of the created string
+		size_t format(char16_t * _buffer, char16_t _delimiter = u':', timeFormat _timeFormat = tfHHMM) const;
+
+		//! @brief Will parse the provided characters. Returns false if the input is not one to four numbers seperated by the delimiter.
+		//! Empty fields are read as 0
+		//! @param _string The input characters (not required to be zero terminated)
+		//! @param _length The number of characters
+		//! @param _result The parsed time will be written here
+		//! @param _delimiter The delimiter that seperates the hour, minute, second and millisecond
+		static bool parse(const char * _string, size_t _length, aTime & _result, char _delimiter = ':');
+
+		//! @brief Will parse the provided characters. Returns false if the input is not one to four numbers seperated by the delimiter.
+		//! Empty fields are read as 0
+		//! @param _string The input characters (not required to be zero terminated)
+		//! @param _length The number of characters
+		//! @param _result The parsed time will be written here
+		//! @param _delimiter The delimiter that seperates the hour, minute, second and millisecond
+		static bool parse(const char16_t * _string, size_t _length, aTime & _result, char16_t _delimiter = u':');
+
+		//! @brief Will parse multiple strings. Invalid entries are set to 00:00
+		//! @param _strings The input strings
+		//! @param _lengths The length of every input string
+		//! @param _count The number of strings
+		//! @param _results The array to write the times to, must provide _count entries
+		//! @return The number of strings that were parsed successfully
+		static size_t parseBatch(const char * const * _strings, const size_t * _lengths, size_t _count, aTime * _results, char _delimiter = ':');
+
+		//! @brief Will parse fixed width records (two digit hour, minute and second, four digit millisecond, one character delimiters).
+		//! Invalid entries are set to 00:00
+		//! @param _buffer The buffer containing the records
+		//! @param _stride The distance between the start of two records in characters (at least 5, 8 or 13 depending on the format)
+		//! @param _count The number of records
+		//! @param _results The array to write the times to, must provide _count entries
+		//! @return The number of records that were parsed successfully
+		static size_t parseFixedBatch(const char * _buffer, size_t _stride, size_t _count, aTime * _results, char _delimiter = ':', timeFormat _timeFormat = tfHHMM);
+
+		//! @brief Will parse fixed width records (two digit hour, minute and second, four digit millisecond, one character delimiters).
+		//! Invalid entries are set to 00:00
+		//! @param _buffer The buffer containing the records
+		//! @param _stride The distance between the start of two records in characters (at least 5, 8 or 13 depending on the format)
+		//! @param _count The number of records
+		//! @param _results The array to write the times to, must provide _count entries
+		//! @return The number of records that were parsed successfully
+		static size_t parseFixedBatch(const char16_t * _buffer, size_t _stride, size_t _count, aTime * _results, char16_t _delimiter = u':', timeFormat _timeFormat = tfHHMM);
+
+		//! @brief Will write multiple times as records with a fixed distance. Unused characters of a record are not touched
+		//! @param _times The times to write
+		//! @param _count The number of times
+		//! @param _buffer The buffer to write to, must provide _count * _stride characters
+		//! @param _stride The distance between the start of two records (5, 8 or 13 depending on the format)
+		static void formatBatch(const aTime * _times, size_t _count, char * _buffer, size_t _stride, char _delimiter = ':', timeFormat _timeFormat = tfHHMM);
 
 		// ############################################################################################################
 
 		// Operators
 
-		aTime & operator = (const aTime & _time);
 		aTime & operator = (const QTime & _time);
-		aTime & operator += (const aTime & _time);
+		constexpr aTime & operator += (const aTime & _time) { m_msecs = normalize(static_cast<long long>(m_msecs) + _time.m_msecs); return *this; }
 		aTime & operator += (const QTime & _time);
-		aTime & operator -= (const aTime & _time);
+		constexpr aTime & operator -= (const aTime & _time) { m_msecs = normalize(static_cast<long long>(m_msecs) - _time.m_msecs); return *this; }
 		aTime & operator -= (const QTime & _time);
 
 	private:
-		int		m_h;		//! The current hour value
-		int		m_m;		//! The current minute value
-		int		m_s;		//! The current second value
-		int		m_ms;		//! The current millisecond value
+		static constexpr long long totalMSecs(int _h, int _m, int _s, int _ms) {
+			return ((static_cast<long long>(_h) * 60 + _m) * 60 + _s) * 1000 + _ms;
+		}
+
+		//! @brief Will wrap the milliseconds into a single day
+		static constexpr int normalize(long long _msecs) {
+			return static_cast<int>(_msecs % 86400000 < 0 ? _msecs % 86400000 + 86400000 : _msecs % 86400000);
+		}
+
+		int		m_msecs;		//! The milliseconds since midnight
 	};
 
-	UICORE_API_EXPORT ak::aTime operator + (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr ak::aTime operator + (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.addMSecs(_rhv.msecsSinceMidnight()); }
 	UICORE_API_EXPORT ak::aTime operator + (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT ak::aTime operator + (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT ak::aTime operator - (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr ak::aTime operator - (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.addMSecs(-_rhv.msecsSinceMidnight()); }
 	UICORE_API_EXPORT ak::aTime operator - (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT ak::aTime operator - (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT bool operator == (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr bool operator == (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.msecsSinceMidnight() == _rhv.msecsSinceMidnight(); }
 	UICORE_API_EXPORT bool operator == (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT bool operator == (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT bool operator != (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr bool operator != (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.msecsSinceMidnight() != _rhv.msecsSinceMidnight(); }
 	UICORE_API_EXPORT bool operator != (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT bool operator != (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT bool operator < (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr bool operator < (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.msecsSinceMidnight() < _rhv.msecsSinceMidnight(); }
 	UICORE_API_EXPORT bool operator < (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT bool operator < (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT bool operator <= (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr bool operator <= (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.msecsSinceMidnight() <= _rhv.msecsSinceMidnight(); }
 	UICORE_API_EXPORT bool operator <= (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT bool operator <= (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT bool operator > (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr bool operator > (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.msecsSinceMidnight() > _rhv.msecsSinceMidnight(); }
 	UICORE_API_EXPORT bool operator > (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT bool operator > (const QTime & _lhv, const ak::aTime & _rhv);
 
-	UICORE_API_EXPORT bool operator >= (const ak::aTime & _lhv, const ak::aTime & _rhv);
+	constexpr bool operator >= (const ak::aTime & _lhv, const ak::aTime & _rhv) { return _lhv.msecsSinceMidnight() >= _rhv.msecsSinceMidnight(); }
 	UICORE_API_EXPORT bool operator >= (const ak::aTime & _lhv, const QTime & _rhv);
 	UICORE_API_EXPORT bool operator >= (const QTime & _lhv, const ak::aTime & _rhv);
 
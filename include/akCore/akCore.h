@@ -25,6 +25,10 @@
 #include <list>						// list<T>
 #include <string>
 #include <sstream>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 
 // Forward declaration
 class QKeyEvent;
@@ -221,7 +225,9 @@ namespace ak {
 		otTimer,
 		otToolButton,
 		otTree,
-		otTreeItem
+		otTreeItem,
+		otTableView,
+		otLogView
 	};
 
 	//! Describes the promt type
@@ -240,7 +246,8 @@ namespace ak {
 		srecNone,
 		srecAppVersionMismatch,
 		srecSettingsVersionMismatch,
-		srecEmptySettingsString
+		srecEmptySettingsString,
+		srecInvalidFormat
 	};
 
 	//! Descirbes the tab location
@@ -538,20 +545,84 @@ namespace ak {
 
 	// Type checking
 
+	// Number parsing without allocation, leading and trailing whitespace is ignored
+
+	//! @brief Will parse the signed integer in the range [_begin, _end)
+	//! @return false if the range does not contain an integer or if the integer is out of range
+	UICORE_API_EXPORT bool parseInteger(const char * _begin, const char * _end, long long & _value);
+
+	//! @brief Will parse the signed integer in the range [_begin, _end)
+	//! @return false if the range does not contain an integer or if the integer is out of range
+	UICORE_API_EXPORT bool parseInteger(const QChar * _begin, const QChar * _end, long long & _value);
+
+	//! @brief Will parse the unsigned integer in the range [_begin, _end)
+	//! @return false if the range does not contain an unsigned integer or if the integer is out of range
+	UICORE_API_EXPORT bool parseUnsigned(const char * _begin, const char * _end, unsigned long long & _value);
+
+	//! @brief Will parse the unsigned integer in the range [_begin, _end)
+	//! @return false if the range does not contain an unsigned integer or if the integer is out of range
+	UICORE_API_EXPORT bool parseUnsigned(const QChar * _begin, const QChar * _end, unsigned long long & _value);
+
+	//! @brief Will parse the decimal number in the range [_begin, _end), the decimal separator is always '.'
+	//! @return false if the range does not contain a decimal number or if the number is out of range
+	UICORE_API_EXPORT bool parseDouble(const char * _begin, const char * _end, double & _value);
+
+	//! @brief Will parse the decimal number in the range [_begin, _end), the decimal separator is always '.'
+	//! @return false if the range does not contain a decimal number or if the number is out of range
+	UICORE_API_EXPORT bool parseDouble(const QChar * _begin, const QChar * _end, double & _value);
+
+	namespace intern {
+
+		template <class T, class C> T toInteger(const C * _begin, const C * _end, bool & _failed, std::true_type /* signed */) {
+			long long v;
+			_failed = !parseInteger(_begin, _end, v) || v < static_cast<long long>(std::numeric_limits<T>::min()) || v > static_cast<long long>(std::numeric_limits<T>::max());
+			return (_failed ? T() : static_cast<T>(v));
+		}
+
+		template <class T, class C> T toInteger(const C * _begin, const C * _end, bool & _failed, std::false_type /* signed */) {
+			unsigned long long v;
+			_failed = !parseUnsigned(_begin, _end, v) || v > static_cast<unsigned long long>(std::numeric_limits<T>::max());
+			return (_failed ? T() : static_cast<T>(v));
+		}
+
+		template <class T, class C> T toNumber(const C * _begin, const C * _end, bool & _failed, std::true_type /* integral */) {
+			return toInteger<T>(_begin, _end, _failed, std::is_signed<T>());
+		}
+
+		template <class T, class C> T toNumber(const C * _begin, const C * _end, bool & _failed, std::false_type /* integral */) {
+			double v;
+			_failed = !parseDouble(_begin, _end, v) || std::abs(v) > static_cast<double>(std::numeric_limits<T>::max());
+			return (_failed ? T() : static_cast<T>(v));
+		}
+
+	}
+
+	//! @brief Will convert and return the number specified in the range [_begin, _end)
+	//! @param _begin The first character of the number
+	//! @param _end The character after the last character of the number
+	//! @param _failed Reference to a flag where the failed state will be written to
+	template <class T> T toNumber(const char * _begin, const char * _end, bool & _failed) { return intern::toNumber<T>(_begin, _end, _failed, std::is_integral<T>()); }
+
+	//! @brief Will convert and return the number specified in the range [_begin, _end)
+	//! @param _begin The first character of the number
+	//! @param _end The character after the last character of the number
+	//! @param _failed Reference to a flag where the failed state will be written to
+	template <class T> T toNumber(const QChar * _begin, const QChar * _end, bool & _failed) { return intern::toNumber<T>(_begin, _end, _failed, std::is_integral<T>()); }
+
 	//! @brief Will convert and return the number specified in the string
 	//! @param _string The string containing the number
 	//! @param _failed Reference to a flag where the failed state will be written to
-	template <class T> T toNumber(std::string _string, bool & _failed) {
-		std::stringstream ss(_string);
-		T v;
-		ss >> v;
-		_failed = false;
-		if (ss.fail()) { _failed = true; }
-		std::string rest;
-		ss >> rest;
-		if (!rest.empty()) { _failed = true; }
-		return v;
-	}
+	template <class T> T toNumber(const char * _string, bool & _failed) { return toNumber<T>(_string, _string + strlen(_string), _failed); }
+
+	//! @brief Will convert and return the number specified in the string
+	//! @param _string The string containing the number
+	//! @param _failed Reference to a flag where the failed state will be written to
+	template <class T> T toNumber(const std::string & _string, bool & _failed) { return toNumber<T>(_string.data(), _string.data() + _string.length(), _failed); }
+
+	//! @brief Will convert and return the number specified in the string
+	//! @param _string The string containing the number
+	//! @param _failed Reference to a flag where the failed state will be written to
+	template <class T> T toNumber(const QString & _string, bool & _failed) { return toNumber<T>(_string.constData(), _string.constData() + _string.length(), _failed); }
 
 	//! @brief Returns true if the provided C-String is in a format ready to be converted to a double or float
 	//! @param str The C-String to be checked
@@ -565,6 +636,11 @@ namespace ak {
 	//! @param str The Qt String to be checked
 	UICORE_API_EXPORT bool isDecimal(const QString &str);
 
+	//! @brief Returns true if the provided characters are in a format ready to be converted to a double or float
+	//! @param str The characters to be checked
+	//! @param length The number of characters
+	UICORE_API_EXPORT bool isDecimal(const QChar *str, int length);
+
 	//! @brief Returns true if the provided C-String is in a format ready to be converted to an integer
 	//! @param str The C-String to be checked
 	UICORE_API_EXPORT bool isInteger(const char *str);
@@ -577,6 +653,11 @@ namespace ak {
 	//! @param str The Qt String to be checked
 	UICORE_API_EXPORT bool isInteger(const QString &str);
 
+	//! @brief Returns true if the provided characters are in a format ready to be converted to an integer
+	//! @param str The characters to be checked
+	//! @param length The number of characters
+	UICORE_API_EXPORT bool isInteger(const QChar *str, int length);
+
 	//! @brief Returns true if the provided C-String consists only of numerical characters
 	//! @param str The C-String to be checked
 	UICORE_API_EXPORT bool isNumericOnly(const char *str);
@@ -589,6 +670,16 @@ namespace ak {
 	//! @param str The Qt String to be checked
 	UICORE_API_EXPORT bool isNumericOnly(const QString &str);
 
+	//! @brief Returns true if the provided UTF-8 characters consist only of numerical characters
+	//! @param str The characters to be checked
+	//! @param length The number of bytes
+	UICORE_API_EXPORT bool isNumericOnly(const char *str, size_t length);
+
+	//! @brief Returns true if the provided characters consist only of numerical characters
+	//! @param str The characters to be checked
+	//! @param length The number of characters
+	UICORE_API_EXPORT bool isNumericOnly(const QChar *str, int length);
+
 } // namespace ak
 
 // point 2d
@@ -17,6 +17,7 @@
 // C++ header
 #include <string>
 #include <list>
+#include <vector>
 
 #include <rapidjson/document.h>
 
@@ -81,12 +82,26 @@ namespace ak {
 		//! @throw std::exception if the member is missing or the member type is not uLongLong
 		__declspec(dllexport) std::list<unsigned long long> getULongLongList(AK_rJSON_doc & _doc, const char * _member);
 
+		//! @brief Will return the uLongLong vector from the specified member in the provided document
+		//! The array is read in place, prefer this function over getULongLongList()
+		//! @param _doc The document
+		//! @param _member The name of the member
+		//! @throw std::exception if the member is missing or the member type is not array
+		__declspec(dllexport) std::vector<unsigned long long> getULongLongVector(AK_rJSON_doc & _doc, const char * _member);
+
 		//! @brief Will return the string list from the specified member in the provided document
 		//! @param _doc The document
 		//! @param _member The name of the member
 		//! @throw std::exception if the member is missing or the member type is not array
 		__declspec(dllexport) std::list<std::string> getStringList(AK_rJSON_doc & _doc, const char * _member);
 
+		//! @brief Will return the string vector from the specified member in the provided document
+		//! The array is read in place, prefer this function over getStringList()
+		//! @param _doc The document
+		//! @param _member The name of the member
+		//! @throw std::exception if the member is missing or the member type is not array
+		__declspec(dllexport) std::vector<std::string> getStringVector(AK_rJSON_doc & _doc, const char * _member);
+
 		//! @brief Will return the object list from the specified member in the provided document
 		//! @param _doc The document
 		//! @param _member The name of the member
@@ -191,12 +206,26 @@ namespace ak {
 		//! @throw std::exception if the member is missing or the member type is not uLongLong
 		__declspec(dllexport) std::list<unsigned long long> getULongLongList(AK_rJSON_val & _doc, const char * _member);
 
+		//! @brief Will return the uLongLong vector from the specified member in the provided value
+		//! The array is read in place, prefer this function over getULongLongList()
+		//! @param _doc The document
+		//! @param _member The name of the member
+		//! @throw std::exception if the member is missing or the member type is not array
+		__declspec(dllexport) std::vector<unsigned long long> getULongLongVector(AK_rJSON_val & _doc, const char * _member);
+
 		//! @brief Will return the string list from the specified member in the provided value
 		//! @param _doc The document
 		//! @param _member The name of the member
 		//! @throw std::exception if the member is missing or the member type is not uLongLong
 		__declspec(dllexport) std::list<std::string> getStringList(AK_rJSON_val & _doc, const char * _member);
 
+		//! @brief Will return the string vector from the specified member in the provided value
+		//! The array is read in place, prefer this function over getStringList()
+		//! @param _doc The document
+		//! @param _member The name of the member
+		//! @throw std::exception if the member is missing or the member type is not array
+		__declspec(dllexport) std::vector<std::string> getStringVector(AK_rJSON_val & _doc, const char * _member);
+
 		//! @brief Will return the object list from the specified member in the provided value
 		//! @param _doc The document
 		//! @param _member The name of the member
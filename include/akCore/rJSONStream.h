@@ -0,0 +1,177 @@
+/*
+ *	File:		rJSONStream.h
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// C++ header
+#include <string>
+
+// Rapid JSON header
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief Writes a JSON string directly to a buffer without building a rapidjson::Document
+	class UICORE_API_EXPORT rJSONStreamWriter {
+	public:
+		typedef rapidjson::Writer<rapidjson::StringBuffer> writerType;
+
+		rJSONStreamWriter();
+		virtual ~rJSONStreamWriter();
+
+		void startObject(void) { m_writer.StartObject(); }
+		void endObject(void) { m_writer.EndObject(); }
+		void startArray(void) { m_writer.StartArray(); }
+		void endArray(void) { m_writer.EndArray(); }
+
+		//! @brief Will write the provided member key, must be followed by a value
+		void key(const char * _key) { m_writer.Key(_key); }
+
+		//! @brief Will write the provided member key, must be followed by a value
+		void key(const std::string & _key) { m_writer.Key(_key.c_str(), static_cast<rapidjson::SizeType>(_key.length())); }
+
+		void value(bool _value) { m_writer.Bool(_value); }
+		void value(int _value) { m_writer.Int(_value); }
+		void value(unsigned long long _value) { m_writer.Uint64(_value); }
+		void value(double _value) { m_writer.Double(_value); }
+		void value(const char * _value) { m_writer.String(_value); }
+		void value(const std::string & _value) { m_writer.String(_value.c_str(), static_cast<rapidjson::SizeType>(_value.length())); }
+
+		//! @brief Will write the provided value (and all its children)
+		void value(const rapidjson::Value & _value) { _value.Accept(m_writer); }
+
+		//! @brief Will write the member key followed by the value
+		template <class T> void member(const char * _key, const T & _value) { key(_key); value(_value); }
+
+		//! @brief Will write the provided integers as an array
+		void intArray(const int * _values, size_t _count);
+
+		//! @brief Will return true if the written JSON is complete (all objects and arrays are closed)
+		bool isComplete(void) const { return m_writer.IsComplete(); }
+
+		//! @brief Will return the written JSON string
+		std::string toString(void) const { return std::string(m_buffer.GetString(), m_buffer.GetSize()); }
+
+		//! @brief Will return the written JSON as C string, the pointer is valid until the writer is modified
+		const char * cString(void) const { return m_buffer.GetString(); }
+
+		//! @brief Will return the length of the written JSON string
+		size_t length(void) const { return m_buffer.GetSize(); }
+
+		//! @brief Will clear the buffer and reset the writer
+		void clear(void);
+
+		//! @brief Will return the underlying rapidjson writer
+		writerType & writer(void) { return m_writer; }
+
+	private:
+		rapidjson::StringBuffer		m_buffer;
+		writerType					m_writer;
+
+		rJSONStreamWriter(const rJSONStreamWriter &) = delete;
+		rJSONStreamWriter & operator = (const rJSONStreamWriter &) = delete;
+	};
+
+	// ###########################################################################################################################################
+
+	//! @brief Pull parser reading a JSON string token by token
+	//! Only the current token is held in memory, values that should be accessed as a whole can be
+	//! materialized into a rapidjson::Document with readValue() or skipped with skipValue()
+	class UICORE_API_EXPORT rJSONStreamReader {
+	public:
+
+		enum tokenType {
+			tkNone,
+			tkNull,
+			tkBool,
+			tkInt,
+			tkUint64,
+			tkDouble,
+			tkString,
+			tkKey,
+			tkStartObject,
+			tkEndObject,
+			tkStartArray,
+			tkEndArray,
+			tkEnd,
+			tkError
+		};
+
+		//! @brief Will create a reader for the provided JSON string
+		//! The string must stay valid while the reader is in use
+		//! @param _json The JSON string to read
+		rJSONStreamReader(const char * _json);
+
+		virtual ~rJSONStreamReader();
+
+		//! @brief Will read the next token and return its type
+		tokenType next(void);
+
+		//! @brief Will return the type of the current token
+		tokenType token(void) const { return m_token; }
+
+		//! @brief Will return the nesting depth after the current token (0 = top level)
+		int depth(void) const { return m_depth; }
+
+		//! @brief Will return the string of the current String or Key token
+		const std::string & string(void) const { return m_string; }
+
+		//! @brief Will return true if the current token is a Key or String that equals the provided string
+		bool is(const char * _str) const { return (m_token == tkKey || m_token == tkString) && m_string == _str; }
+
+		bool boolValue(void) const { return m_bool; }
+		long long intValue(void) const { return m_int; }
+		unsigned long long uint64Value(void) const { return m_uint; }
+		double doubleValue(void) const { return m_double; }
+
+		//! @brief Will skip the value starting at the current token
+		//! If the current token starts an object or array the reader will advance to its end
+		//! @return false if an error occured
+		bool skipValue(void);
+
+		//! @brief Will materialize the value starting at the current token into the provided document
+		//! Afterwards the current token is the last token of the value
+		//! @return false if an error occured
+		bool readValue(rapidjson::Document & _doc);
+
+		//! @brief Will return true if a parse error occured
+		bool hasError(void) const { return m_token == tkError; }
+
+		//! @brief Will return the offset of the parse error in the input
+		size_t errorOffset(void) const { return m_reader.GetErrorOffset(); }
+
+	private:
+		friend struct rJSONStreamReaderHandler;
+
+		template <class Handler> bool forward(Handler & _handler);
+
+		rapidjson::Reader			m_reader;
+		rapidjson::StringStream		m_stream;
+		tokenType					m_token;
+		int							m_depth;
+		bool						m_bool;
+		long long					m_int;
+		unsigned long long			m_uint;
+		double						m_double;
+		std::string					m_string;
+
+		rJSONStreamReader(const rJSONStreamReader &) = delete;
+		rJSONStreamReader & operator = (const rJSONStreamReader &) = delete;
+	};
+
+}
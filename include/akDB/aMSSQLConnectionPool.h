@@ -0,0 +1,145 @@
+/*
+ *	File:		aMSSQLConnectionPool.h
+ *	Package:	akDB
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qobject.h>				// Base class
+
+// C++ header
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// uiCore header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	class aMessenger;
+	class aMSSQLWrapper;
+
+	//! @brief Runs database jobs on a pool of worker threads, every worker owns one connection.
+	//! Connections are established on first use, checked while idle and reestablished if they were lost.
+	//! When a job finished the callback is called on the thread of the pool and a message is sent via the messenger:
+	//! sender is the pool UID, event is etChanged on success or etInvalidEntry on failure, info1 is the job ID and info2 is 1 if the job was cancelled.
+	//! Jobs must be submitted from the thread of the pool
+	class UICORE_API_EXPORT aMSSQLConnectionPool : public QObject {
+		Q_OBJECT
+	public:
+		//! @brief The job, will be called on a worker thread with the connection of the worker
+		typedef std::function<void(aMSSQLWrapper & _connection)> jobFunction;
+
+		//! @brief Will be called on the thread of the pool when the job finished
+		typedef std::function<void(ID _jobId, bool _success, const std::string & _error)> callbackFunction;
+
+		//! @brief Constructor, will start the workers
+		//! @param _connectionString The ODBC connection string used for all connections
+		//! @param _size The number of connections (and workers)
+		//! @param _messenger The messenger used to send the completion notifications, may be nullptr
+		//! @param _uid The UID used as sender of the completion notifications
+		aMSSQLConnectionPool(
+			const std::wstring &		_connectionString,
+			int							_size = 4,
+			aMessenger *				_messenger = (aMessenger *) nullptr,
+			UID							_uid = invalidUID,
+			QObject *					_parent = (QObject *) nullptr
+		);
+
+		//! @brief Deconstructor, queued jobs are dropped and running jobs are cancelled without notification
+		virtual ~aMSSQLConnectionPool();
+
+		//! @brief Will queue the job
+		//! @return The job ID
+		ID submit(
+			const jobFunction &			_job,
+			const callbackFunction &	_callback = callbackFunction()
+		);
+
+		//! @brief Will cancel the job. A queued job is removed, for a running job the current statement is cancelled (SQLCancel).
+		//! A running job is only reported as cancelled if its statement was cancelled (SQLSTATE HY008), if it already completed the cancel has no effect
+		//! @return False if the job is not queued or running
+		bool cancel(
+			ID							_jobId
+		);
+
+		//! @brief Will cancel all queued and running jobs
+		void cancelAll(void);
+
+		//! @brief Returns the number of jobs that did not finish yet
+		int pendingCount(void) const { return m_pendingCount; }
+
+		int size(void) const { return static_cast<int>(m_workers.size()); }
+
+		//! @brief Will set the time in milliseconds after which idle connections are checked
+		void setHealthCheckInterval(int _interval);
+
+		int healthCheckInterval(void) const { return m_healthCheckInterval; }
+
+		const std::wstring & connectionString(void) const { return m_connectionString; }
+
+		UID uid(void) const { return m_uid; }
+
+	private slots:
+		void slotJobFinished(int _jobId);
+
+	private:
+		struct job {
+			ID							id;
+			jobFunction					function;
+		};
+
+		struct jobResult {
+			bool						success = false;
+			bool						cancelled = false;
+			std::string					error;
+		};
+
+		struct worker {
+			std::thread						thread;
+			std::unique_ptr<aMSSQLWrapper>	connection;
+			ID								currentJob = invalidID;
+		};
+
+		void run(worker * _worker);
+		jobResult runJob(worker * _worker, const job & _job);
+		bool ensureConnected(worker * _worker, std::string & _error);
+		void resetConnection(worker * _worker);
+		void finishJob(ID _jobId, const jobResult & _result);
+		void cancelWorker(worker * _worker);
+
+		aMessenger *								m_messenger;
+		UID											m_uid;
+		std::wstring								m_connectionString;
+		std::vector<std::unique_ptr<worker>>		m_workers;
+		std::map<ID, callbackFunction>				m_callbacks;		//! Only used on the thread of the pool
+		ID											m_nextId;
+		int											m_pendingCount;
+
+		std::mutex									m_mutex;
+		std::condition_variable						m_condition;
+		std::deque<job>								m_queue;
+		std::map<ID, jobResult>						m_results;
+		int											m_healthCheckInterval;
+		bool										m_stop;
+
+		aMSSQLConnectionPool(const aMSSQLConnectionPool &) = delete;
+		aMSSQLConnectionPool & operator = (const aMSSQLConnectionPool &) = delete;
+	};
+
+}
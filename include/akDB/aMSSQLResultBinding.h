@@ -0,0 +1,152 @@
+/*
+ *	File:		aMSSQLResultBinding.h
+ *	Package:	akDB
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qobject.h>				// Base class
+#include <qstring.h>				// QString
+#include <qpointer.h>				// QPointer
+
+// C++ header
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+
+// uiCore header
+#include <akCore/globalDataTypes.h>
+
+class QAbstractScrollArea;
+
+namespace ak {
+
+	class aMSSQLStatement;
+	class aTableViewWidget;
+	class aTreeWidget;
+
+	//! @brief Streams the result set of an executed statement into a table view or tree widget.
+	//! Rows are fetched page by page, the first page is requested immediately and further pages are requested when the view is scrolled to the end.
+	//! The pages are fetched and converted to text on a background thread, only adding them to the widget happens on the thread of the binding.
+	//! Only the fetched pages are added to the widget, the statement buffers hold a single page.
+	//! The statement (and its connection) must not be used by anyone else until the binding finished or was reset
+	class UICORE_API_EXPORT aMSSQLResultBinding : public QObject {
+		Q_OBJECT
+	public:
+		aMSSQLResultBinding(QObject * _parent = (QObject *) nullptr);
+
+		virtual ~aMSSQLResultBinding();
+
+		//! @brief Will bind the result set to the table model of the view. The table is cleared and gets one column per result column
+		//! @param _statement The executed statement
+		//! @param _pageSize The number of rows fetched at once
+		void bindTable(
+			aTableViewWidget *							_table,
+			const std::shared_ptr<aMSSQLStatement> &	_statement,
+			int											_pageSize = 200
+		);
+
+		//! @brief Will bind the result set to the tree. Every row adds an item
+		//! @param _statement The executed statement
+		//! @param _textColumn The column containing the item text
+		//! @param _pathColumn The column containing the path of the parent item (see aTreeWidget::add), -1 for top level items
+		//! @param _delimiter The delimiter used in the path
+		//! @param _pageSize The number of rows fetched at once
+		void bindTree(
+			aTreeWidget *								_tree,
+			const std::shared_ptr<aMSSQLStatement> &	_statement,
+			int											_textColumn = 0,
+			int											_pathColumn = -1,
+			char										_delimiter = '|',
+			int											_pageSize = 200
+		);
+
+		//! @brief Will start fetching the next page, the page is added when the fetch completed (see pageFetched())
+		//! @return False if there are no more rows or a page is currently fetched
+		bool fetchMore(void);
+
+		//! @brief Will fetch all remaining rows, a page is requested as soon as the previous one was added
+		void fetchAll(void);
+
+		//! @brief Returns true if there may be more rows
+		bool canFetchMore(void) const { return m_statement != nullptr; }
+
+		//! @brief Returns true if a page is currently fetched
+		bool isFetching(void) const { return m_isFetching; }
+
+		//! @brief Returns the number of rows added so far
+		int rowCount(void) const { return m_rowCount; }
+
+		//! @brief Will close the result set and detach from the widget, the rows added so far are kept.
+		//! Waits for a page that is currently fetched, the page is dropped
+		void reset(void);
+
+		//! @brief Will set the distance in rows to the end of the view at which the next page is fetched
+		void setPrefetchDistance(int _rows) { m_prefetchDistance = _rows; }
+
+		int prefetchDistance(void) const { return m_prefetchDistance; }
+
+	signals:
+		//! @brief Is emitted after a page was added to the widget
+		void pageFetched(int _rowCount);
+
+		//! @brief Is emitted when all rows were fetched
+		void finished(int _rowCount);
+
+		//! @brief Is emitted if fetching the rows failed, the binding is reset
+		void fetchFailed(const QString & _error);
+
+	private slots:
+		void slotScrolled(int _value);
+		void slotPageFetched(int _generation);
+
+	private:
+		//! @brief A fetched page, the cells are stored row by row
+		struct page {
+			std::vector<QString>			cells;
+			std::vector<QString>			headers;
+			size_t							rows = 0;
+			size_t							columns = 0;
+			bool							failed = false;
+			QString							error;
+		};
+
+		void attach(QAbstractScrollArea * _view, const std::shared_ptr<aMSSQLStatement> & _statement, int _pageSize);
+		void addRows(const page & _page);
+		void waitForFetch(void);
+
+		//! @brief Runs on the fetch thread
+		static void fetchPage(aMSSQLStatement & _statement, bool _withHeaders, page & _page);
+
+		std::shared_ptr<aMSSQLStatement>	m_statement;
+		QPointer<aTableViewWidget>			m_table;
+		QPointer<aTreeWidget>				m_tree;
+		QPointer<QAbstractScrollArea>		m_view;
+		int									m_textColumn;
+		int									m_pathColumn;
+		char								m_delimiter;
+		int									m_rowCount;
+		int									m_prefetchDistance;
+		bool								m_isFetching;
+		bool								m_isFetchingAll;
+		bool								m_hasHeaders;
+		int									m_generation;		//! Is increased on reset, pages of an older generation are dropped
+
+		std::thread							m_fetchThread;
+		std::mutex							m_pageMutex;
+		page								m_page;				//! The page fetched by the fetch thread, protected by m_pageMutex
+
+		aMSSQLResultBinding(const aMSSQLResultBinding &) = delete;
+		aMSSQLResultBinding & operator = (const aMSSQLResultBinding &) = delete;
+	};
+
+}
@@ -0,0 +1,239 @@
+/*
+ *	File:		aMSSQLStatement.h
+ *	Package:	akDB
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// uiCore header
+#include <akCore/globalDataTypes.h>
+
+// Qt header
+#include <qstring.h>				// QString
+
+// C++ header
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+#include <sqlext.h>
+#include <sqltypes.h>
+#include <sql.h>
+
+namespace ak {
+
+	class aMSSQLWrapper;
+
+	static_assert(sizeof(SQLWCHAR) == sizeof(ushort), "SQLWCHAR must be UTF-16");
+
+	//! @brief Converts text returned by the driver. SQLWCHAR is always UTF-16 while wchar_t is 32 bit on unixODBC systems, so the text must not be reinterpreted
+	//! @param _length The length in characters, -1 if the text is zero terminated
+	inline QString sqlTextToQString(const SQLWCHAR * _text, int _length = -1) { return QString::fromUtf16(reinterpret_cast<const ushort *>(_text), _length); }
+
+	//! @brief Converts text returned by the driver
+	//! @param _length The length in characters, -1 if the text is zero terminated
+	inline std::wstring sqlTextToWString(const SQLWCHAR * _text, int _length = -1) { return sqlTextToQString(_text, _length).toStdWString(); }
+
+	//! @brief Returns the UTF-16 buffer of the text that can be passed to the driver, valid as long as the QString is not modified or destroyed
+	inline const SQLWCHAR * sqlText(const QString & _text) { return reinterpret_cast<const SQLWCHAR *>(_text.utf16()); }
+
+	//! @brief Read only view of a fetched column, the data is valid until the next fetch
+	template <class T> class aMSSQLColumn {
+	public:
+		aMSSQLColumn(const T * _data, const SQLLEN * _indicators, size_t _rows)
+			: m_data(_data), m_indicators(_indicators), m_rows(_rows) {}
+
+		size_t size(void) const { return m_rows; }
+		bool isNull(size_t _row) const { return m_indicators[_row] == SQL_NULL_DATA; }
+		const T & operator[](size_t _row) const { return m_data[_row]; }
+		const T * begin(void) const { return m_data; }
+		const T * end(void) const { return m_data + m_rows; }
+
+	private:
+		const T *			m_data;
+		const SQLLEN *		m_indicators;
+		size_t				m_rows;
+	};
+
+	//! @brief Read only view of a fetched text column, the data is valid until the next fetch
+	class aMSSQLStringColumn {
+	public:
+		aMSSQLStringColumn(const SQLWCHAR * _data, size_t _width, const SQLLEN * _indicators, size_t _rows)
+			: m_data(_data), m_width(_width), m_indicators(_indicators), m_rows(_rows) {}
+
+		size_t size(void) const { return m_rows; }
+		bool isNull(size_t _row) const { return m_indicators[_row] == SQL_NULL_DATA; }
+
+		//! @brief Returns the zero terminated text of the row
+		const SQLWCHAR * text(size_t _row) const { return m_data + _row * (m_width + 1); }
+
+		//! @brief Returns the length of the text in characters (texts longer than the column width are truncated, see isTruncated())
+		size_t length(size_t _row) const {
+			if (m_indicators[_row] == SQL_NO_TOTAL) { return m_width; }
+			if (m_indicators[_row] < 0) { return 0; }
+			size_t len = static_cast<size_t>(m_indicators[_row]) / sizeof(SQLWCHAR);
+			return (len > m_width ? m_width : len);
+		}
+
+		//! @brief Returns true if the text of the row did not fit into the column width and was cut off
+		bool isTruncated(size_t _row) const {
+			if (m_indicators[_row] == SQL_NO_TOTAL) { return true; }
+			return (m_indicators[_row] > 0 && static_cast<size_t>(m_indicators[_row]) / sizeof(SQLWCHAR) > m_width);
+		}
+
+		std::wstring toString(size_t _row) const { return sqlTextToWString(text(_row), static_cast<int>(length(_row))); }
+
+		QString toQString(size_t _row) const { return sqlTextToQString(text(_row), static_cast<int>(length(_row))); }
+
+	private:
+		const SQLWCHAR *	m_data;
+		size_t				m_width;
+		const SQLLEN *		m_indicators;
+		size_t				m_rows;
+	};
+
+	//! @brief A prepared statement with bound parameters.
+	//! Result sets are fetched in blocks of rows into column-wise buffers (ODBC array binding).
+	//! Parameter and column indices are zero based
+	class UICORE_API_EXPORT aMSSQLStatement {
+	public:
+		//! @brief Will prepare the query on the provided connection.
+		//! While the statement is executed or fetched it is registered as the active statement of the connection so it can be cancelled
+		//! @throw aMSSQLQueryException If the statement could not be prepared
+		aMSSQLStatement(
+			aMSSQLWrapper &			_connection,
+			const std::wstring &	_query
+		);
+
+		//! @brief Deconstructor, will free the statement handle
+		virtual ~aMSSQLStatement();
+
+		// ###################################################################################################################################
+
+		// Parameters
+
+		void bind(size_t _index, int _value);
+		void bind(size_t _index, long long _value);
+		void bind(size_t _index, double _value);
+		void bind(size_t _index, const std::wstring & _value);
+		void bindNull(size_t _index);
+
+		//! @brief Will remove all parameter values
+		void clearParameters(void);
+
+		// ###################################################################################################################################
+
+		// Execution
+
+		//! @brief Will execute the statement with the current parameter values, an open result set will be closed.
+		//! The result columns are available after the execution
+		//! @throw aMSSQLQueryException If the execution failed
+		void execute(void);
+
+		//! @brief Will fetch the next block of rows into the column buffers.
+		//! Texts longer than the column width are cut off, hasTruncatedText() reports if this happened in the block
+		//! @return The number of rows fetched, 0 if there are no more rows
+		//! @throw aMSSQLQueryException If the fetch failed
+		size_t fetchBlock(void);
+
+		//! @brief Will close the open result set
+		void close(void);
+
+		//! @brief Returns the number of rows affected by the last execution
+		long long affectedRows(void) const;
+
+		// ###################################################################################################################################
+
+		// Columns of the current block
+
+		size_t columnCount(void) const { return m_columns.size(); }
+
+		const std::wstring & columnName(size_t _column) const { return m_columns[_column].name; }
+
+		//! @brief Returns the ODBC C type the column is fetched as (SQL_C_SLONG, SQL_C_SBIGINT, SQL_C_DOUBLE or SQL_C_WCHAR).
+		//! Decimal and numeric columns are fetched as text to keep their precision
+		SQLSMALLINT columnType(size_t _column) const { return m_columns[_column].cType; }
+
+		//! @brief Returns true if a text of the current block was cut off at the column width (see aMSSQLStringColumn::isTruncated())
+		bool hasTruncatedText(void) const { return m_hasTruncatedText; }
+
+		//! @brief Returns the number of rows in the current block
+		size_t rowCount(void) const { return static_cast<size_t>(m_rowsFetched); }
+
+		aMSSQLColumn<SQLINTEGER> intColumn(size_t _column) const;
+		aMSSQLColumn<SQLBIGINT> bigIntColumn(size_t _column) const;
+		aMSSQLColumn<double> doubleColumn(size_t _column) const;
+		aMSSQLStringColumn stringColumn(size_t _column) const;
+
+		// ###################################################################################################################################
+
+		// Settings
+
+		//! @brief Will set the number of rows fetched per block, takes effect on the next execution
+		void setRowArraySize(size_t _rows);
+
+		size_t rowArraySize(void) const { return m_rowArraySize; }
+
+		//! @brief Will set the maximum number of characters fetched for text columns, takes effect on the next execution.
+		//! Longer texts are truncated and reported by hasTruncatedText()
+		void setMaxStringLength(size_t _length);
+
+		size_t maxStringLength(void) const { return m_maxStringLength; }
+
+		const std::wstring & query(void) const { return m_query; }
+
+		SQLHANDLE handle(void) const { return m_handle; }
+
+		//! @brief Will free the statement handle, the statement can not be used afterwards
+		void release(void);
+
+	private:
+
+		struct parameter {
+			SQLSMALLINT				cType = SQL_C_WCHAR;
+			SQLSMALLINT				sqlType = SQL_WVARCHAR;
+			long long				intValue = 0;
+			double					doubleValue = 0.;
+			QString					textValue;			//! UTF-16, bound directly as SQL_C_WCHAR
+			SQLLEN					indicator = SQL_NULL_DATA;
+		};
+
+		struct column {
+			std::wstring			name;
+			SQLSMALLINT				cType;
+			size_t					width;				//! The number of characters of text columns
+			size_t					elementSize;
+			std::vector<char>		buffer;
+			std::vector<SQLLEN>		indicators;
+		};
+
+		parameter & parameterAt(size_t _index);
+		void bindParameters(void);
+		void bindColumns(void);
+		const column & columnOfType(size_t _column, SQLSMALLINT _cType) const;
+		void throwError(const char * _text) const;
+
+		aMSSQLWrapper *				m_connection;
+		SQLHANDLE					m_handle;
+		std::wstring				m_query;
+		std::vector<parameter>		m_parameters;
+		std::vector<column>			m_columns;
+		bool						m_columnsBound;
+		SQLULEN						m_rowsFetched;
+		bool						m_hasTruncatedText;
+		size_t						m_rowArraySize;
+		size_t						m_maxStringLength;
+
+		aMSSQLStatement(const aMSSQLStatement &) = delete;
+		aMSSQLStatement & operator = (const aMSSQLStatement &) = delete;
+	};
+
+}
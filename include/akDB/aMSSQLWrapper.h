@@ -14,11 +14,17 @@
 
 // uiCore header
 #include <akCore/globalDataTypes.h>
+#include <akDB/aMSSQLStatement.h>
 
 // C++ header
 #include <exception>
 #include <string>
+#include <map>
+#include <memory>
+#include <atomic>
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include <sqlext.h>
 #include <sqltypes.h>
 #include <sql.h>
@@ -97,6 +103,18 @@ namespace ak {
 		//! @throw std::exception If error occurs while allocating the statement handle
 		SQLHANDLE executeQuery(const std::wstring & _query);
 
+		//! @brief Will return the prepared statement for the query.
+		//! Prepared statements are cached, preparing the same query again returns the cached statement if no other caller holds it.
+		//! While a caller holds the cached statement other callers get an uncached statement, a statement is never used by two callers at once.
+		//! Statements must not be used after the connection was closed
+		//! @throw aMSSQLQueryException If the statement could not be prepared
+		std::shared_ptr<aMSSQLStatement> prepare(const std::wstring & _query);
+
+		//! @brief Will set the maximum number of cached prepared statements, the least recently used statements are removed first
+		void setStatementCacheSize(size_t _size);
+
+		size_t statementCacheSize(void) const { return m_statementCacheSize; }
+
 		// ###################################################################################################################################
 
 		// Getter
@@ -104,6 +122,29 @@ namespace ak {
 		//! @brief Will return true if the connection is established
 		bool isConnected(void) const { return m_isConnected; }
 
+		//! @brief Will return true if the connection is established and was not lost.
+		//! Uses the connection dead attribute of the driver, if the driver does not support it a trivial query is executed
+		bool isConnectionAlive(void);
+
+		//! @brief Will cancel the statement currently executed or fetched on this connection (SQLCancel).
+		//! May be called from another thread, does not wait for the connection
+		//! @return False if no statement is running
+		bool cancel(void);
+
+		//! @brief Will register the statement as running on this connection so it can be cancelled, must be followed by endStatement()
+		void beginStatement(SQLHANDLE _statement);
+
+		//! @brief Will unregister the running statement, waits for a cancel that is in progress
+		//! @param _result The result of the ODBC call, if it failed because of a cancel statementCancelled() will return true
+		void endStatement(SQLRETURN _result);
+
+		//! @brief Returns true if a statement was cancelled since the last call to resetStatementCancelled()
+		bool statementCancelled(void) const { return m_statementCancelled; }
+
+		void resetStatementCancelled(void) { m_statementCancelled = false; }
+
+		SQLHANDLE connectionHandle(void) const { return m_connectionHandle; }
+
 		//! @brief Will return true if a table with the specified name does exist
 		bool tableExists(const std::wstring & _table);
 
@@ -140,7 +181,22 @@ namespace ak {
 		SQLHANDLE		m_connectionHandle;		//! Stores connection attributes to connect to SQL Server
 		SQLHANDLE		m_lastQueryHandle;		//! Stores the last query handle
 
+		std::atomic<SQLHANDLE>	m_activeStatement;		//! The statement currently executed or fetched
+		std::atomic<int>		m_cancelsInProgress;	//! The number of cancel calls that may use the active statement
+		bool					m_statementCancelled;	//! If true, a statement failed with SQLSTATE HY008 (only used by the executing thread)
+
+		struct cachedStatement {
+			std::shared_ptr<aMSSQLStatement>	statement;
+			unsigned long long					lastUse;
+		};
+
+		std::map<std::wstring, cachedStatement>	m_statementCache;		//! Prepared statements by query
+		size_t									m_statementCacheSize;
+		unsigned long long						m_statementUseCounter;
+
 	private:
+		//! @brief Will remove the least recently used statements until the cache has the provided size
+		void trimStatementCache(size_t _size);
 
 		aMSSQLWrapper(aMSSQLWrapper&) = delete;
 		aMSSQLWrapper& operator = (aMSSQLWrapper&) = delete;
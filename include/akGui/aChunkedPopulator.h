@@ -0,0 +1,95 @@
+/*
+ *	File:		aChunkedPopulator.h
+ *	Package:	akGui
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qobject.h>				// Base class
+#include <qtimer.h>
+
+// C++ header
+#include <functional>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief Runs a step function repeatedly across multiple event loop iterations.
+	//! Each iteration runs steps until the time budget is used up, then returns to the event loop
+	class UICORE_API_EXPORT aChunkedPopulator : public QObject {
+		Q_OBJECT
+	public:
+		//! @brief The step function, will be called once per item with the index of the item.
+		//! Must return false if there are no more items. If the function throws, the population
+		//! is cancelled (the finished signal is emitted) and the exception is forwarded
+		typedef std::function<bool(int _index)> stepFunction;
+
+		aChunkedPopulator(QObject * _parent = (QObject *) nullptr);
+
+		//! @brief Deconstructor, a running population is stopped without emitting the finished signal
+		virtual ~aChunkedPopulator();
+
+		//! @brief Will start the population. A running population will be cancelled first
+		//! @param _step The function to call for every item
+		//! @param _expectedCount The expected number of items (used for the progress), -1 if unknown
+		void start(
+			const stepFunction &		_step,
+			int							_expectedCount = -1
+		);
+
+		//! @brief Will stop the population and emit the finished signal
+		void cancel(void);
+
+		//! @brief Returns true if a population is running
+		bool isRunning(void) const { return m_isRunning; }
+
+		//! @brief Returns the number of items processed by the current (or last) population
+		int count(void) const { return m_count; }
+
+		//! @brief Will set the time in milliseconds that may be spent per event loop iteration
+		void setTimeBudget(
+			int							_milliseconds
+		);
+
+		int timeBudget(void) const { return m_timeBudget; }
+
+	signals:
+		//! @brief Is emitted before a chunk is processed
+		void chunkStarted(void);
+
+		//! @brief Is emitted after a chunk was processed
+		//! @param _count The number of items processed so far
+		//! @param _expectedCount The expected number of items or -1 if unknown
+		void progress(int _count, int _expectedCount);
+
+		//! @brief Is emitted when all items were processed or the population was cancelled
+		void finished(int _count, bool _cancelled);
+
+	private slots:
+		void slotProcessChunk(void);
+
+	private:
+		void stop(bool _cancelled);
+
+		stepFunction			m_step;
+		QTimer					m_timer;
+		int						m_count;
+		int						m_expectedCount;
+		int						m_timeBudget;
+		bool					m_isRunning;
+
+		aChunkedPopulator(const aChunkedPopulator &) = delete;
+		aChunkedPopulator & operator = (const aChunkedPopulator &) = delete;
+	};
+
+}
@@ -25,6 +25,12 @@ namespace ak {
 	class UICORE_API_EXPORT aColor {
 	public:
 
+		//! @brief The size of a buffer that fits every hex string (AARRGGBB) including the terminating null
+		static const int hexStringBufferSize = 9;
+
+		//! @brief The size of a buffer that fits every channel string with a delimiter of up to 2 characters (A,R,G,B) including the terminating null
+		static const int channelStringBufferSize = 22;
+
 		//! @brief Default constructor
 		aColor();
 
@@ -174,6 +180,47 @@ namespace ak {
 			const QString &		_delimiter
 		) const;
 
+		//! @brief Writes the Hex-String representation of the color (like toHexString) to the buffer without allocating memory
+		//! @param _buffer The buffer to write to, must fit at least hexStringBufferSize characters
+		//! @param _includeA If false, the alpha channel value will be excluded from the hex-string
+		//! @return The number of characters written (excluding the terminating null)
+		int toHexString(
+			char *				_buffer,
+			bool				_includeA = false
+		) const;
+
+		//! @brief Writes the Hex-String representation of the color (like toHexString) to the buffer without allocating memory
+		//! @param _buffer The buffer to write to, must fit at least hexStringBufferSize characters
+		//! @param _includeA If false, the alpha channel value will be excluded from the hex-string
+		//! @return The number of characters written (excluding the terminating null)
+		static int toHexString(
+			const QColor &		_color,
+			char *				_buffer,
+			bool				_includeA = false
+		);
+
+		//! @brief Writes the RGB-String representation of the color (like toRGBString) to the buffer without allocating memory
+		//! @param _buffer The buffer to write to
+		//! @param _bufferSize The size of the buffer, the string is truncated if it does not fit
+		//! @param _delimiter The delimiter between the entries
+		//! @return The number of characters written (excluding the terminating null)
+		int toRGBString(
+			char *				_buffer,
+			int					_bufferSize,
+			const char *		_delimiter
+		) const;
+
+		//! @brief Writes the ARGB-String representation of the color (like toARGBString) to the buffer without allocating memory
+		//! @param _buffer The buffer to write to
+		//! @param _bufferSize The size of the buffer, the string is truncated if it does not fit
+		//! @param _delimiter The delimiter between the entries
+		//! @return The number of characters written (excluding the terminating null)
+		int toARGBString(
+			char *				_buffer,
+			int					_bufferSize,
+			const char *		_delimiter
+		) const;
+
 		//! @brief Returns a QColor Object with the colors set
 		QColor toQColor(void) const;
 
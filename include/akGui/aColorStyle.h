@@ -31,7 +31,37 @@ namespace ak {
 	class UICORE_API_EXPORT aColorStyle {
 	public:
 
-		aColorStyle() {}
+		//! @brief The color roles of a color style
+		enum colorRole {
+			crWindowMainForeground,
+			crWindowMainBackground,
+			crControlsMainForeground,
+			crControlsMainBackground,
+			crControlsErrorFrontForeground,
+			crControlsErrorBackForeground,
+			crControlsErrorBackBackground,
+			crControlsFocusedBackground,
+			crControlsFocusedForeground,
+			crControlsPressedForeground,
+			crControlsPressedBackground,
+			crControlsBorder,
+			crAlternateForeground,
+			crAlternateBackground,
+			crHeaderForeground,
+			crHeaderBackground,
+			crHeaderBorder,
+			crCount
+		};
+
+		//! @brief A resolved color of the palette with all string representations formatted
+		struct paletteEntry {
+			QColor				color;					//! The color
+			QString				hex;					//! The hex string without alpha channel like: "aabbcc" (RRGGBB)
+			QString				hexWithAlpha;			//! The hex string with alpha channel like: "ffaabbcc" (AARRGGBB)
+			QString				rgba;					//! The stylesheet color function like: "rgba(255, 255, 255, 255)"
+		};
+
+		aColorStyle() : m_paletteIsValid(false) {}
 
 		//! @brief Will return the name of this styleSheet
 		virtual QString getColorStyleName(void) const = 0;
@@ -103,6 +133,21 @@ namespace ak {
 		//! @brief Returns the currently set controls border color
 		aColor getControlsBorderColor(void) const { return m_controlsBorderColor; }
 
+		//! @brief Returns the resolved palette entry of the provided color role.
+		//! The palette is built once and reused until a color of the style is changed, no strings are built per call
+		const paletteEntry & getPaletteEntry(
+			colorRole					_role
+		) const;
+
+		//! @brief Returns the resolved color of the provided color role
+		const QColor & getPaletteColor(colorRole _role) const { return getPaletteEntry(_role).color; }
+
+		//! @brief Returns the hex string of the provided color role like: "aabbcc" or "ffaabbcc" (if the alpha channel is included)
+		const QString & getPaletteHexString(colorRole _role, bool _includeA = false) const {
+			const paletteEntry & entry = getPaletteEntry(_role);
+			return (_includeA ? entry.hexWithAlpha : entry.hex);
+		}
+
 		//! @brief Will set the provided directories to the colorStyle
 		//! @param _directory The new search directory to add
 		void setDirectories(
@@ -120,6 +165,9 @@ namespace ak {
 
 	protected:
 
+		//! @brief Will mark the palette as outdated, must be called after a color was changed
+		void invalidatePalette(void) { m_paletteIsValid = false; }
+
 		aColor					m_windowMainForecolor;			//! The currently set window main foreground color
 		aColor					m_windowMainBackcolor;			//! The currently set window main background color
 
@@ -143,5 +191,15 @@ namespace ak {
 		aColor					m_headerBorderColor;
 
 		std::vector<QString>	m_directories;					//! Contains all directories to scan for incons
+
+	private:
+		//! @brief Returns the color of the provided role
+		const aColor & roleColor(colorRole _role) const;
+
+		//! @brief Will build the palette entries of all color roles
+		void buildPalette(void) const;
+
+		mutable paletteEntry	m_palette[crCount];				//! The resolved palette, valid if m_paletteIsValid is set
+		mutable bool			m_paletteIsValid;
 	};
 } // namespace ak
\ No newline at end of file
@@ -54,37 +54,37 @@ namespace ak {
 
 		void removeSheet(colorAreaFlag _area);
 
-		void setWindowMainForegroundColor(const aColor & _color) { m_windowMainForecolor = _color; }
+		void setWindowMainForegroundColor(const aColor & _color) { m_windowMainForecolor = _color; invalidatePalette(); }
 
-		void setWindowMainBackgroundColor(const aColor & _color) { m_windowMainBackcolor = _color; }
+		void setWindowMainBackgroundColor(const aColor & _color) { m_windowMainBackcolor = _color; invalidatePalette(); }
 
-		void setControlsMainForegroundColor(const aColor & _color) { m_controlsMainForecolor = _color; }
+		void setControlsMainForegroundColor(const aColor & _color) { m_controlsMainForecolor = _color; invalidatePalette(); }
 
-		void setControlsMainBackgroundColor(const aColor & _color) { m_controlsMainBackcolor = _color; }
+		void setControlsMainBackgroundColor(const aColor & _color) { m_controlsMainBackcolor = _color; invalidatePalette(); }
 
-		void setControlsErrorFrontForegroundColor(const aColor & _color) { m_controlsErrorFrontForecolor = _color; }
+		void setControlsErrorFrontForegroundColor(const aColor & _color) { m_controlsErrorFrontForecolor = _color; invalidatePalette(); }
 
-		void setControlsErrorBackForegroundColor(const aColor & _color) { m_controlsErrorBackForecolor = _color; }
+		void setControlsErrorBackForegroundColor(const aColor & _color) { m_controlsErrorBackForecolor = _color; invalidatePalette(); }
 
-		void setControlsErrorBackBackgroundColor(const aColor & _color) { m_controlsErrorBackBackcolor = _color; }
+		void setControlsErrorBackBackgroundColor(const aColor & _color) { m_controlsErrorBackBackcolor = _color; invalidatePalette(); }
 
-		void setControlsFocusedBackgroundColor(const aColor & _color) { m_controlsFocusBackColor = _color; }
+		void setControlsFocusedBackgroundColor(const aColor & _color) { m_controlsFocusBackColor = _color; invalidatePalette(); }
 
-		void setControlsFocusedForegroundColor(const aColor & _color) { m_controlsFocusForeColor = _color; }
+		void setControlsFocusedForegroundColor(const aColor & _color) { m_controlsFocusForeColor = _color; invalidatePalette(); }
 
-		void setControlsPressedForegroundColor(const aColor & _color) { m_controlsPressedForeColor = _color; }
+		void setControlsPressedForegroundColor(const aColor & _color) { m_controlsPressedForeColor = _color; invalidatePalette(); }
 
-		void setControlsPressedBackgroundColor(const aColor & _color) { m_controlsPressedBackColor = _color; }
+		void setControlsPressedBackgroundColor(const aColor & _color) { m_controlsPressedBackColor = _color; invalidatePalette(); }
 
-		void setAlternateForegroundColor(const aColor & _color) { m_alternateForeColor = _color; }
+		void setAlternateForegroundColor(const aColor & _color) { m_alternateForeColor = _color; invalidatePalette(); }
 
-		void setAlternateBackgroundColor(const aColor & _color) { m_alternateBackColor = _color; }
+		void setAlternateBackgroundColor(const aColor & _color) { m_alternateBackColor = _color; invalidatePalette(); }
 
-		void setHeaderForegroundColor(const aColor & _color) { m_headerForeColor = _color; }
+		void setHeaderForegroundColor(const aColor & _color) { m_headerForeColor = _color; invalidatePalette(); }
 
-		void setHeaderBackgroundColor(const aColor & _color) { m_headerBackColor = _color; }
+		void setHeaderBackgroundColor(const aColor & _color) { m_headerBackColor = _color; invalidatePalette(); }
 
-		void setControlsBorderColor(const aColor & _color) { m_controlsBorderColor = _color; }
+		void setControlsBorderColor(const aColor & _color) { m_controlsBorderColor = _color; invalidatePalette(); }
 
 	private:
 
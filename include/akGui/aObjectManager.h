@@ -16,9 +16,12 @@
 #include <akCore/globalDataTypes.h>
 #include <akCore/akCore.h>
 #include <akGui/aColor.h>
+#include <akGui/aTtbLayout.h>
 
 // C++ header
 #include <map>							// map
+#include <set>							// set
+#include <rapidjson/fwd.h>
 
 // Qt header
 #include <qstring.h>
@@ -35,6 +38,7 @@ namespace ak {
 	class aUidManager;
 	class aSignalLinker;
 	class aColorStyle;
+	class aStateSnapshot;
 
 	//! @brief The objectManager is used for creating and manipulating objects and widgets
 	//! All objects created here a derived from ak::core::aObject or child
@@ -168,6 +172,14 @@ namespace ak {
 			const QString &										_password = QString()
 		);
 
+		//! @brief Will create a log view and return its UID
+		//! @param _creatorUid The UID of the creator
+		//! @param _maximumLineCount The maximum number of lines to keep, 0 for unlimited
+		UID createLogView(
+			UID												_creatorUid,
+			int													_maximumLineCount
+		);
+
 		//! @brief Will create a nice line edit
 		//! @param _initialText The initial text of the edit field
 		//! @param _infoLabelText The initial text of the information label
@@ -224,6 +236,16 @@ namespace ak {
 			int													_columns
 		);
 
+		//! @brief Will create a model backed table view and return its UID
+		//! @param _creatorUid The UID of the creator
+		//! @param _rows The initial row count of the table
+		//! @param _columns The initial column count of the table
+		UID createTableView(
+			UID												_creatorUid,
+			int													_rows,
+			int													_columns
+		);
+
 		//! @brief Will create a text edit and return its UID
 		//! @param _creatorUid The UID of the creator
 		//! @param _initialText The initial text of the text edit
@@ -294,6 +316,19 @@ namespace ak {
 			const QString &										_text = QString("")
 		);
 
+		//! @brief Will create the pages, groups and subgroups described in the layout and add the objects to them.
+		//! Existing containers with the same text are reused. Tab toolbar updates are suspended while building
+		//! @param _creatorUid The UID of the creator
+		//! @param _uiManagerUid The UID of the ui manager where to create the pages at
+		//! @param _layout The layout to apply
+		//! @param _deferHiddenPages If true, the content of pages that are not the current tab is built when they are shown for the first time
+		void buildTabToolBar(
+			UID												_creatorUid,
+			UID												_uiManagerUid,
+			const aTtbLayout &								_layout,
+			bool											_deferHiddenPages = true
+		);
+
 		/*
 		//! @brief Will create a defaultWelcomeScreen and return its UID
 		//! @param _creatorUid The UID of the creator
@@ -368,19 +403,37 @@ namespace ak {
 			const std::string &									_applicationVersion
 		);
 
+		//! @brief Will return the binary settings snapshot of all objects that have an alias set
+		//! @param _applicationVersion The application version to store
+		//! @param _compress If true the snapshot payload will be compressed
+		std::string saveStateWindowBinary(
+			const std::string &									_applicationVersion,
+			bool												_compress
+		);
+
 		//! @brief Will return the JSON settings string of all objects that have an alias set
 		std::string saveStateColorStyle(
 			const std::string &									_applicationVersion
 		);
 
 		//! @brief Will setup the UI with the settings provided in the settings JSON string
+		//! The settings are only applied if the whole string was read successfully
 		//! @param _json The JSON string containing the settings
+		//! @return srecInvalidFormat if the JSON string is malformed
 		//! @throw ak::Exception on syntax mismatch
 		settingsRestoreErrorCode restoreStateWindow(
 			const char *										_json,
 			const std::string &									_applicationVersion
 		);
 
+		//! @brief Will setup the UI with the settings provided in the binary snapshot
+		//! The settings for aliases that are not registered yet are kept and will be applied when the alias is added
+		//! @param _data The binary snapshot created with saveStateWindowBinary
+		settingsRestoreErrorCode restoreStateWindowBinary(
+			const std::string &									_data,
+			const std::string &									_applicationVersion
+		);
+
 		//! @brief Will setup the UI with the settings provided in the settings JSON string
 		//! @param _json The JSON string containing the settings
 		settingsRestoreErrorCode restoreStateColorStyle(
@@ -441,11 +494,32 @@ namespace ak {
 			UID												_createdUid
 		);
 
+		//! @brief Will create the groups and subgroups of a single tab toolbar page and add the objects to them
+		void buildTabToolBarPage(
+			UID												_creatorUid,
+			UID												_pageUid,
+			const aTtbLayout::pageEntry &					_page
+		);
+
 		//! @brief Will cast and return the object to a QWidget
 		QWidget * castToWidget(
 			UID												_objectUid
 		);		
 
+		//! @brief Will check the versions stored in a window state
+		settingsRestoreErrorCode checkStateVersion(
+			const std::string &									_settingVersionApp,
+			const std::string &									_settingVersionWindowState,
+			const std::string &									_applicationVersion
+		) const;
+
+		//! @brief Will restore the settings of the object with the specified alias
+		void restoreObjectSettings(
+			const QString &										_alias,
+			const QString &										_objectType,
+			const rapidjson::Value &							_settings
+		);
+
 		// ###############################################################################################################################################
 		
 		// Object storing
@@ -463,6 +537,9 @@ namespace ak {
 
 		std::vector<QString>				m_iconSearchPaths;
 
+		aStateSnapshot *					m_stateSnapshot;							//! The last restored binary snapshot, kept while entries are pending
+		std::set<QString>					m_pendingStateAliases;						//! The aliases of the snapshot entries that were not restored yet
+
 		// ###############################################################################################################################################
 
 		aUidManager *						m_uidManager;									//! The globally used uidManager
@@ -0,0 +1,64 @@
+/*
+ *	File:		aRepaintScheduler.h
+ *	Package:	akGui
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qobject.h>				// Base class
+#include <qtimer.h>
+#include <qelapsedtimer.h>
+#include <qpointer.h>
+#include <qwidget.h>
+
+// C++ header
+#include <vector>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief Coalesces repaint requests of custom painted widgets.
+	//! All widgets invalidated within a frame are updated together at the start of the next frame, a widget is updated once per frame at most
+	class UICORE_API_EXPORT aRepaintScheduler : public QObject {
+		Q_OBJECT
+	public:
+		//! @brief Returns the scheduler of the GUI thread
+		static aRepaintScheduler * instance(void);
+
+		//! @brief Will schedule an update of the widget for the next frame
+		static void schedule(QWidget * _widget) { instance()->add(_widget); }
+
+		//! @brief Will set the frame interval in milliseconds
+		void setFrameInterval(int _interval);
+
+		int frameInterval(void) const { return m_frameInterval; }
+
+	private slots:
+		void slotFrame(void);
+
+	private:
+		aRepaintScheduler();
+		virtual ~aRepaintScheduler();
+
+		void add(QWidget * _widget);
+
+		std::vector<QPointer<QWidget>>	m_pending;
+		QTimer							m_timer;
+		QElapsedTimer					m_lastFrame;
+		int								m_frameInterval;
+
+		aRepaintScheduler(const aRepaintScheduler &) = delete;
+		aRepaintScheduler & operator = (const aRepaintScheduler &) = delete;
+	};
+
+}
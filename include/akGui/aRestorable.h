@@ -34,6 +34,9 @@
 
 namespace ak {
 
+	class rJSONStreamWriter;
+	class aStateSnapshot;
+
 	//! Represents an object that can save and restore its settings
 	class UICORE_API_EXPORT aRestorable {
 	public:
@@ -52,6 +55,22 @@ namespace ak {
 			rapidjson::Document::AllocatorType &	_allocator
 		) = 0;
 
+		//! @brief Will write this objects current state to the provided writer
+		//! The default implementation writes the value created by addObjectSettingsToValue().
+		//! Objects with large settings should override this function to write their settings directly.
+		//! The written value must look like this:
+		//!	     { "Alias":"[ObjectAlias]","Type":"[ObjectType]","Settings":{...} }
+		virtual void writeObjectSettings(
+			rJSONStreamWriter &						_writer
+		);
+
+		//! @brief Will add this objects current state as entries to the provided snapshot
+		//! The default implementation encodes the settings of the value created by addObjectSettingsToValue().
+		//! Objects with large settings should override this function to write their settings directly
+		virtual void writeObjectSettings(
+			aStateSnapshot &						_snapshot
+		);
+
 		//! @brief Will restore the settings from the provided JSON value which must have an object type
 		//! The value looks like this:
 		//!	     { { "[SettingsName]":"[SettingsValue]",... } }
@@ -42,10 +42,12 @@ namespace ak {
 	class aDockWidget;
 	class aLineEditWidget;
 	class aLogInDialog;
+	class aLogViewWidget;
 	class aNiceLineEditWidget;
 	class aPushButtonWidget;
 	class aTreeWidget;
 	class aTableWidget;
+	class aTableViewWidget;
 	class aTabWidget;
 	class aTextEditWidget;
 	class aTimer;
@@ -146,6 +148,14 @@ namespace ak {
 			UID													_objectUid = invalidUID
 		);
 
+		//! @brief Will create a new link for the provided logView. Will return the object uid
+		//! @param _object The logView to be linked to the messaging system
+		//! @param _objectUid The uid of the object. If the provided uid is 0 a new uid will be generated by the uid manager
+		UID addLink(
+			aLogViewWidget *									_object,
+			UID													_objectUid = invalidUID
+		);
+
 		//! @brief Will create a new link for the provided niceLineEdit. Will return the object uid
 		//! @param _object The niceLineEdit to be linked to the messaging system
 		//! @param _objectUid The uid of the object. If the provided uid is 0 a new uid will be generated by the uid manager
@@ -178,6 +188,14 @@ namespace ak {
 			UID													_objectUid = invalidUID
 		);
 
+		//! @brief Will create a new link for the provided table view. Will return the object uid
+		//! @param _object The table view to be linked to the messaging system
+		//! @param _objectUid The uid of the object. If the provided uid is 0 a new uid will be generated by the uid manager
+		UID addLink(
+			aTableViewWidget *									_object,
+			UID													_objectUid = invalidUID
+		);
+
 		//! @brief Will create a new link for the provided tabView. Will return the object uid
 		//! @param _object The tabView to be linked to the messaging system
 		//! @param _objectUid The uid of the object. If the provided uid is 0 a new uid will be generated by the uid manager
@@ -17,6 +17,7 @@
 
 // Qt header
 #include <qtabbar.h>
+#include <qcolor.h>
 
 // AK header
 #include <akCore/globalDataTypes.h>
@@ -36,19 +37,25 @@ namespace ak {
 
 		virtual void paintEvent(QPaintEvent * _event) override;
 
+		//! @brief Will remove the colors of all tabs.
+		//! The repaint is scheduled for the next frame, multiple changes within a frame cause a single repaint
 		void clearColors(bool _repaint = true);
 
 		void clearColor(int _index, bool _repaint = true);
 
 		void addColor(int _index, const aColor & _color, bool _repaint = true);
 
-		void setRepaintBlocked(bool _blocked = true) { m_repaintIsBlocked = _blocked; }
+		//! @brief Will block the repaint, a repaint requested while blocked is scheduled when the block is removed.
+		//! Not required to batch changes, changes are coalesced by the repaint scheduler
+		void setRepaintBlocked(bool _blocked = true);
 
 	private:
+		void scheduleRepaint(void);
 
-		std::map<int, aColor>		m_colors;
+		std::vector<QColor>			m_colors;				//! The color of every tab, invalid if the tab has no color
 
 		bool						m_repaintIsBlocked;
+		bool						m_repaintIsPending;
 
 		aSpecialTabBar(const aSpecialTabBar&) = delete;
 		aSpecialTabBar & operator = (const aSpecialTabBar&) = delete;
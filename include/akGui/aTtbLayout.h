@@ -0,0 +1,102 @@
+/*
+ *	File:		aTtbLayout.h
+ *	Package:	akGui
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qstring.h>				// QString
+
+// C++ header
+#include <vector>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+
+namespace ak {
+
+	//! @brief Declarative description of the tab toolbar structure (page -> group -> subgroup -> objects).
+	//! The layout does not create anything, it is applied by the object manager in a single pass
+	class UICORE_API_EXPORT aTtbLayout {
+	public:
+		struct subgroupEntry {
+			QString					text;
+			std::vector<UID>		objects;
+		};
+
+		struct groupEntry {
+			QString						text;
+			std::vector<UID>			objects;
+			std::vector<subgroupEntry>	subgroups;
+		};
+
+		struct pageEntry {
+			QString						text;
+			std::vector<groupEntry>		groups;
+		};
+
+		aTtbLayout();
+		virtual ~aTtbLayout();
+
+		//! @brief Will add a page. Pages are created in the order they were first mentioned
+		//! @param _page The text of the page
+		void addPage(
+			const QString &				_page
+		);
+
+		//! @brief Will add a group to the specified page, the page is added if required
+		//! @param _page The text of the page
+		//! @param _group The text of the group
+		void addGroup(
+			const QString &				_page,
+			const QString &				_group
+		);
+
+		//! @brief Will add an object (action or widget) to the specified group, the page and group are added if required
+		//! @param _page The text of the page
+		//! @param _group The text of the group
+		//! @param _objectUid The UID of the object to add
+		void addObject(
+			const QString &				_page,
+			const QString &				_group,
+			UID							_objectUid
+		);
+
+		//! @brief Will add an object (action or widget) to the specified subgroup, the page, group and subgroup are added if required
+		//! @param _page The text of the page
+		//! @param _group The text of the group
+		//! @param _subgroup The text of the subgroup
+		//! @param _objectUid The UID of the object to add
+		void addObject(
+			const QString &				_page,
+			const QString &				_group,
+			const QString &				_subgroup,
+			UID							_objectUid
+		);
+
+		//! @brief Will remove all entries
+		void clear(void);
+
+		//! @brief Returns true if the layout contains no pages
+		bool isEmpty(void) const { return m_pages.empty(); }
+
+		//! @brief Will return all pages in the order they were added
+		const std::vector<pageEntry> & pages(void) const { return m_pages; }
+
+	private:
+		pageEntry & page(const QString & _text);
+		groupEntry & group(pageEntry & _page, const QString & _text);
+		subgroupEntry & subgroup(groupEntry & _group, const QString & _text);
+
+		std::vector<pageEntry>			m_pages;
+	};
+
+}
@@ -0,0 +1,113 @@
+/*
+ *	File:		aCurlTransport.h
+ *	Package:	akNet
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// uiCore header
+#include <akCore/globalDataTypes.h>
+
+// C++ header
+#include <string>
+#include <list>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+namespace ak {
+
+	//! @brief The result of a transfer
+	struct aCurlResult {
+		bool							success = false;	//! True if the transfer completed without a curl error
+		long							responseCode = 0;	//! The last response code of the server (HTTP status or SMTP reply)
+		std::string						response;			//! The response body (empty if a response writer was used)
+		long long						bytesReceived = 0;	//! The size of the response body
+		std::string						error;				//! The error message if the transfer failed
+	};
+
+	//! @brief Description of a single transfer.
+	//! If mail recipients are set the request is sent as a mail (SMTP), otherwise as a HTTP request
+	struct aCurlRequest {
+		//! @brief Will be called to read the next part of the body, must return the number of bytes written to the buffer (0 at the end)
+		typedef std::function<size_t(char * _buffer, size_t _size)> bodyReaderFunction;
+
+		//! @brief Will be called with every part of the response, returning false aborts the transfer
+		typedef std::function<bool(const char * _data, size_t _size)> responseWriterFunction;
+
+		std::string						url;
+		std::string						customMethod;		//! HTTP method, if empty GET or POST (if a body is set) is used
+		std::list<std::string>			headers;			//! Additional HTTP headers
+		std::string						mailFrom;			//! SMTP sender
+		std::list<std::string>			mailRecipients;		//! SMTP recipients
+		std::string						body;				//! The body, ignored if a body reader is set
+		bodyReaderFunction				bodyReader;			//! Streams the body instead of holding it in memory
+		long long						bodySize = -1;		//! The size of the streamed body, -1 if unknown
+		responseWriterFunction			responseWriter;		//! Streams the response instead of collecting it in the result
+		int								timeout = 0;		//! The timeout in milliseconds, 0 for no timeout
+	};
+
+	//! @brief Performs transfers on a background thread using the curl multi interface.
+	//! Connections are cached per server and reused by later transfers, multiple transfers are in flight at the same time
+	class UICORE_API_EXPORT aCurlTransport {
+	public:
+		typedef std::function<void(const aCurlResult &)> callbackFunction;
+
+		//! @brief Constructor, will start the transport thread
+		//! @param _maxConnectionsPerHost The maximum number of parallel connections to a single host
+		//! @param _maxTotalConnections The maximum number of parallel connections (also the size of the connection cache)
+		aCurlTransport(int _maxConnectionsPerHost = 4, int _maxTotalConnections = 16);
+
+		//! @brief Deconstructor, transfers that did not finish yet are cancelled with an error
+		virtual ~aCurlTransport();
+
+		//! @brief Will queue the request and return a future for its result
+		std::future<aCurlResult> submit(
+			const aCurlRequest &			_request
+		);
+
+		//! @brief Will queue the request, the callback is called on the transport thread when the transfer finished
+		void submit(
+			const aCurlRequest &			_request,
+			const callbackFunction &		_callback
+		);
+
+		//! @brief Returns the number of transfers that are queued or in flight
+		int pendingCount(void) const { return m_pending; }
+
+		//! @brief Returns the transport shared by the static helper functions
+		static aCurlTransport & defaultTransport(void);
+
+	private:
+		struct transfer;
+
+		void enqueue(transfer * _transfer);
+		void run(void);
+		void startTransfer(transfer * _transfer);
+		void finishTransfer(transfer * _transfer, int _curlCode, const char * _error = (const char *) nullptr);
+
+		void *							m_multi;
+		std::thread						m_thread;
+		std::mutex						m_mutex;
+		std::deque<transfer *>			m_queue;
+		std::vector<void *>				m_idleHandles;
+		std::vector<transfer *>			m_active;
+		std::atomic<bool>				m_stop;
+		std::atomic<int>				m_pending;
+
+		aCurlTransport(const aCurlTransport &) = delete;
+		aCurlTransport & operator = (const aCurlTransport &) = delete;
+	};
+
+}
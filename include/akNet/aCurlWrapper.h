@@ -14,6 +14,7 @@
 
 // uiCore header
 #include <akCore/globalDataTypes.h>
+#include <akNet/aCurlTransport.h>
 
 // Qt header
 #include <qstring.h>
@@ -21,6 +22,7 @@
 // C++ header
 #include <string>
 #include <list>
+#include <future>
 
 namespace ak {
 
@@ -32,6 +34,11 @@ namespace ak {
 
 		// Static functions
 
+		//! @brief Will send the mail and wait for the result.
+		//! The mail is sent by the default transport, the connection to the mail server is reused by following mails
+		//! @param _date The date header, if empty no date header is added
+		//! @param _response Will contain the response of the server or the error message
+		//! @param _timeout The timeout in milliseconds
 		static bool sendMail(
 			const std::string &				_mailserver,
 			const std::string &				_senderMail,
@@ -44,6 +51,31 @@ namespace ak {
 			int								_timeout = 3000
 		);
 
+		//! @brief Will queue the mail and return immediately.
+		//! Multiple mails may be in flight at the same time
+		static std::future<aCurlResult> sendMailAsync(
+			const std::string &				_mailserver,
+			const std::string &				_senderMail,
+			const std::list<std::string> &	_receiverMails,
+			const std::list<std::string> &	_ccMails,
+			const std::string &				_subject,
+			const std::string &				_messageBody,
+			const std::string &				_date = std::string(),
+			int								_timeout = 3000
+		);
+
+		//! @brief Will create the request used to send the provided mail
+		static aCurlRequest createMailRequest(
+			const std::string &				_mailserver,
+			const std::string &				_senderMail,
+			const std::list<std::string> &	_receiverMails,
+			const std::list<std::string> &	_ccMails,
+			const std::string &				_subject,
+			const std::string &				_messageBody,
+			const std::string &				_date,
+			int								_timeout
+		);
+
 	private:
 
 	};
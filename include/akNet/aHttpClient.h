@@ -0,0 +1,163 @@
+/*
+ *	File:		aHttpClient.h
+ *	Package:	akNet
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qobject.h>				// Base class
+#include <qstring.h>				// QString
+
+// C++ header
+#include <string>
+#include <list>
+#include <memory>
+
+// uiCore header
+#include <akCore/globalDataTypes.h>
+#include <akNet/aCurlTransport.h>
+
+class QFile;
+
+namespace ak {
+
+	class aMessenger;
+
+	//! @brief HTTP client, all requests are performed by a aCurlTransport and never block the caller.
+	//! When a request finished a message is sent via the messenger: sender is the client UID, event is etChanged on success
+	//! or etInvalidEntry on failure, info1 is the request ID and info2 the response code. Use takeResult() to get the result
+	class UICORE_API_EXPORT aHttpClient : public QObject {
+		Q_OBJECT
+	public:
+		//! @brief Constructor
+		//! @param _messenger The messenger used to send the completion notifications
+		//! @param _uid The UID used as sender of the completion notifications
+		//! @param _transport The transport to use, if nullptr the default transport is used
+		aHttpClient(
+			aMessenger *						_messenger,
+			UID									_uid,
+			aCurlTransport *					_transport = (aCurlTransport *) nullptr,
+			QObject *							_parent = (QObject *) nullptr
+		);
+
+		//! @brief Deconstructor, requests that did not finish yet will not be reported.
+		//! Buffer downloads that did not finish yet are cancelled, their buffers are not written anymore once the deconstructor returned
+		virtual ~aHttpClient();
+
+		// ###########################################################################################################################################
+
+		// Requests, every function returns the request ID
+
+		ID get(
+			const std::string &					_url,
+			const std::list<std::string> &		_headers = std::list<std::string>()
+		);
+
+		ID post(
+			const std::string &					_url,
+			const std::string &					_body,
+			const std::string &					_contentType = std::string("application/json"),
+			const std::list<std::string> &		_headers = std::list<std::string>()
+		);
+
+		ID put(
+			const std::string &					_url,
+			const std::string &					_body,
+			const std::string &					_contentType = std::string("application/json"),
+			const std::list<std::string> &		_headers = std::list<std::string>()
+		);
+
+		//! @brief Will write the response body directly to the file
+		//! @return The request ID or invalidID if the file could not be opened
+		ID download(
+			const std::string &					_url,
+			const QString &						_filePath,
+			const std::list<std::string> &		_headers = std::list<std::string>()
+		);
+
+		//! @brief Will write the response body directly to the buffer, the request fails if the buffer is too small.
+		//! The buffer must stay valid until the request finished or was cancelled with cancelDownload() (or the client was destroyed).
+		//! The number of bytes written is the bytesReceived of the result
+		ID download(
+			const std::string &					_url,
+			char *								_buffer,
+			size_t								_capacity,
+			const std::list<std::string> &		_headers = std::list<std::string>()
+		);
+
+		//! @brief Will stream the file as the request body
+		//! @param _method PUT or POST
+		//! @return The request ID or invalidID if the file could not be opened
+		ID upload(
+			const std::string &					_url,
+			const QString &						_filePath,
+			const std::string &					_method = std::string("PUT"),
+			const std::string &					_contentType = std::string("application/octet-stream"),
+			const std::list<std::string> &		_headers = std::list<std::string>()
+		);
+
+		//! @brief Will send the request. The timeout of the client is used if the request has none
+		ID send(
+			const aCurlRequest &				_request
+		);
+
+		//! @brief Will cancel the buffer download. Once the function returned the buffer is not accessed anymore and may be released.
+		//! The request finishes with an error
+		//! @return False if the request is not a buffer download that is still running
+		bool cancelDownload(
+			ID									_requestId
+		);
+
+		// ###########################################################################################################################################
+
+		// Getter and setter
+
+		//! @brief Will move the result of the finished request to the provided result.
+		//! Returns false if the request did not finish yet or the result was already taken
+		bool takeResult(
+			ID									_requestId,
+			aCurlResult &						_result
+		);
+
+		//! @brief Returns the number of requests that did not finish yet
+		int pendingCount(void) const { return m_pendingCount; }
+
+		//! @brief Will set the timeout in milliseconds used for all following requests, 0 for no timeout
+		void setTimeout(int _timeout) { m_timeout = _timeout; }
+
+		int timeout(void) const { return m_timeout; }
+
+		UID uid(void) const { return m_uid; }
+
+	private slots:
+		void slotRequestFinished(int _requestId);
+
+	private:
+		struct sharedData;
+
+		ID submit(
+			aCurlRequest &						_request,
+			const std::shared_ptr<QFile> &		_file
+		);
+
+		aMessenger *							m_messenger;
+		UID										m_uid;
+		aCurlTransport *						m_transport;
+		std::shared_ptr<sharedData>				m_data;			//! Shared with the completion callbacks, outlives the client
+		ID										m_nextId;
+		int										m_pendingCount;
+		int										m_timeout;
+
+		aHttpClient(const aHttpClient &) = delete;
+		aHttpClient & operator = (const aHttpClient &) = delete;
+	};
+
+}
@@ -92,7 +92,8 @@ namespace ak {
 			const QString &				_text
 		);
 
-		//! @brief Will fill the background for the current parent widget
+		//! @brief Will fill the background for the current parent widget.
+		//! Nothing is done if the background is already filled with the provided color
 		//! @param _color The color to set
 		void fillBackground(
 			const aColor &			_color
@@ -117,6 +118,8 @@ namespace ak {
 		QHBoxLayout *			m_layout;					//! The layout used to place the widgets
 
 		aColor					m_color;					//! The currently set color
+		aColor					m_backgroundColor;			//! The color the background was filled with
+		bool					m_backgroundIsFilled;		//! If true the background was filled with m_backgroundColor
 
 		QWidget *				m_widget;
 
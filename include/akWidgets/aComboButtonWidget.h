@@ -26,14 +26,17 @@
 // Forward declaration
 class QMenu;
 class QKeyEvent;
+class QPaintEvent;
 
 namespace ak {
 
 	// Forward declaration
 	class aColorStyle;
+	struct aComboButtonMenuSet;
 
 	//! @brief This class represents a combo button which consists of a QPushButton and it's Menu
-	//! This class behaves like a combo box
+	//! This class behaves like a combo box.
+	//! Combo buttons with the same items share a single menu, the menu is only copied when items are added to one of them
 	class UICORE_API_EXPORT aComboButtonWidget : public QPushButton, public aWidget
 	{
 		Q_OBJECT
@@ -61,6 +64,9 @@ namespace ak {
 		//! @brief Emits a key released signal a key is released
 		virtual void keyReleaseEvent(QKeyEvent * _event) override;
 
+		//! @brief Paints the button with a menu indicator
+		virtual void paintEvent(QPaintEvent * _event) override;
+
 		// #######################################################################################################
 
 		//! @brief Will remove all items from the combo button
@@ -83,6 +89,9 @@ namespace ak {
 		//! @brief Will return the ammount of items in the combo button
 		int getItemCount(void) const;
 
+		//! @brief Will return the number of menus currently shared between combo buttons (used for diagnostics)
+		static int sharedMenuCount(void);
+
 		// #######################################################################################################
 		// Base class functions
 
@@ -102,13 +111,14 @@ namespace ak {
 		void changed(void);
 
 	private slots:
-		void slotItemTriggered();
+		void slotShowMenu();
 
 	private:
-		QMenu *													m_menu;				//! The QMenu of this combo button
-		aUidManager												m_itemsUIDmanager;		//! The UID manager used for the menu items of this combo button
-		std::vector<aComboButtonWidgetItem *>					m_items;				//! The items of this combo button
-		std::map<UID, size_t>								m_itemUids;			//! The map containing the index of a item UID
+		//! @brief Will create the style sheet for the menu
+		void refreshMenuStyleSheet(void);
+
+		aComboButtonMenuSet *									m_menuSet;			//! The (possibly shared) menu of this combo button
+		QString													m_menuStyleSheet;	//! The style sheet applied to the menu when it is shown
 
 		aComboButtonWidget(aComboButtonWidget &) = delete;
 		aComboButtonWidget & operator = (aComboButtonWidget &) = delete;
@@ -21,6 +21,8 @@
 #include <qicon.h>						// QIcon
 
 // C++ header
+#include <map>
+#include <vector>
 
 class QMenu;
 class QAction;
@@ -51,7 +53,8 @@ namespace ak {
 
 		// #######################################################################################################
 
-		//! @brief Will refresh all data stored according to the current visible state
+		//! @brief Will refresh the check state of all menu items according to the tracked visible state.
+		//! The visible state is tracked by the visibility changed signal of the docks, the docks are not queried
 		void refreshData(void);
 
 		//! @brief Will add the provided dock as to watch
@@ -62,22 +65,48 @@ namespace ak {
 		//! @brief Will remove the watch for the specified dock
 		void removeWatch(QDockWidget * _dock);
 
-		//! @brief Will set the enabled state of the watcher
+		//! @brief Will set the enabled state of the watcher.
+		//! The menu items are refreshed when the watcher gets enabled, since they are not updated while it is disabled
 		//! @param _isEnabled The enabled state to set
-		void setWatcherEnabled(bool _isEnabled) { m_isEnabled = _isEnabled; }
+		void setWatcherEnabled(bool _isEnabled);
 
 		//! @brief Will return the enabled state that is currently set
 		bool isWatcherEnabled(void) const { return m_isEnabled; }
 
+		//! @brief Returns the number of watched docks that are currently visible
+		int visibleDockCount(void) const { return m_visibleCount; }
+
+		//! @brief Returns the number of watched docks
+		int watchCount(void) const { return static_cast<int>(m_dockMap.size()); }
+
+		//! @brief Returns the tracked visible state of the provided dock
+		//! @param _dock The dock to check, must be watched
+		bool isDockVisible(QDockWidget * _dock) const;
+
 	private slots:
 		void slotVisibilityChanged(bool _visible);
 		void slotClicked();
 		void slotMenuItemChanged();
 
 	private:
+		struct watchEntry {
+			QDockWidget *		dock;
+			aContextMenuItem *	action;
+		};
+
+		typedef unsigned long long bitBlock;
+
+		bool visibleBit(size_t _index) const { return (m_visibleBits[_index / 64] >> (_index % 64)) & 1; }
+
+		//! @brief Will set the visible bit of the entry and update the visible count
+		void setVisibleBit(size_t _index, bool _visible);
 
-		std::map<QDockWidget *, aContextMenuItem *>	m_dockMap;
-		std::map<aContextMenuItem *, QDockWidget *>	m_actionMap;
+		std::vector<watchEntry>						m_entries;			//! All watch entries, the index is the index in the visible bitset
+		std::vector<size_t>							m_freeEntries;		//! Indices of removed entries that can be reused
+		std::vector<bitBlock>						m_visibleBits;		//! The visible state of every entry
+		int											m_visibleCount;
+		std::map<QDockWidget *, size_t>				m_dockMap;
+		std::map<aContextMenuItem *, size_t>		m_actionMap;
 		bool										m_isEnabled;
 		QMenu *										m_menu;
 
@@ -15,6 +15,7 @@
  // AK header
 #include <akCore/globalDataTypes.h>
 #include <akWidgets/aWidget.h>
+#include <akCore/aTextIndex.h>
 
 // Qt header
 #include <qlistwidget.h>			// base class (list, listItem)
@@ -23,6 +24,7 @@
 
 // C++ header
 #include <map>
+#include <functional>
 
 class QMouseEvent;
 class QKeyEvent;
@@ -32,6 +34,7 @@ namespace ak {
 
 	// Forward declaration
 	class aListWidgetItem;
+	class aChunkedPopulator;
 
 	class UICORE_API_EXPORT aListWidget : public QListWidget, public aWidget {
 		Q_OBJECT
@@ -107,6 +110,47 @@ namespace ak {
 			ID							_id
 		);
 
+		//! @brief Will return the ID of the first item with the provided text or invalidID if no item has this text
+		ID findItemByText(
+			const QString &				_text
+		) const;
+
+		//! @brief Will set the case sensitivity used to find items by their text
+		void setTextLookupCaseSensitivity(
+			Qt::CaseSensitivity			_caseSensitivity
+		);
+
+		// ###########################################################################################################################################
+
+		// Population
+
+		//! @brief Provides the text and icon of an item. Must return false if there are no more items
+		//! @param _index The index of the requested item, starting at 0 for every population
+		//! @param _text The text to set
+		//! @param _icon The icon to set, a null icon will be ignored
+		typedef std::function<bool(int _index, QString & _text, QIcon & _icon)> itemProducer;
+
+		//! @brief Will add the items provided by the producer in time sliced chunks.
+		//! Every chunk is processed in a single event loop iteration, sorting is disabled until the population finished.
+		//! A running population will be cancelled
+		//! @param _producer The producer of the items
+		//! @param _expectedItemCount The expected number of items (used for the progress), -1 if unknown
+		void populate(
+			const itemProducer &		_producer,
+			int							_expectedItemCount = -1
+		);
+
+		//! @brief Will cancel a running population, the items added so far are kept
+		void cancelPopulation(void);
+
+		//! @brief Returns true if a population is running
+		bool isPopulating(void) const;
+
+		//! @brief Will set the time in milliseconds that may be spent per chunk
+		void setPopulationTimeBudget(
+			int							_milliseconds
+		);
+
 		//QString itemText
 	signals:
 		void keyPressed(QKeyEvent *);
@@ -114,15 +158,33 @@ namespace ak {
 		void mouseMove(QMouseEvent *);
 		void leave(QEvent *);
 
+		//! @brief Is emitted after every chunk of a population
+		void populationProgress(int _itemCount, int _expectedItemCount);
+
+		//! @brief Is emitted when a population finished or was cancelled
+		void populationFinished(int _itemCount, bool _cancelled);
+
+	private slots:
+		void slotPopulationChunkStarted(void);
+		void slotPopulationProgress(int _itemCount, int _expectedItemCount);
+		void slotPopulationFinished(int _itemCount, bool _cancelled);
+
 	private:
 
 		//! Will clear the memory allocated by this object
 		void memFree(void);
 
+		//! @brief Will create the populator if required
+		aChunkedPopulator * populator(void);
+
 		bool							m_verticalScrollbarAlwaysVisible;
 
 		ID								m_currentId;
 		std::map<ID, aListWidgetItem *>	m_items;
+		aTextIndex						m_textIndex;		//! Item text to item ID
+
+		aChunkedPopulator *				m_populator;
+		bool							m_sortingWasEnabled;
 
 	}; // class list
 
@@ -0,0 +1,149 @@
+/*
+ *	File:		aLogViewWidget.h
+ *	Package:	akWidgets
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+// Qt header
+#include <qplaintextedit.h>			// base class
+#include <qstring.h>				// QString
+
+// C++ header
+#include <memory>
+#include <mutex>
+
+// AK header
+#include <akCore/globalDataTypes.h>
+#include <akCore/akCore.h>
+#include <akWidgets/aWidget.h>
+
+// Forward declaration
+class QKeyEvent;
+class QTimer;
+
+namespace ak {
+
+	// Forward declaration
+	class aLogViewWidget;
+
+	//! @brief Thread safe buffer collecting the text appended to a log view.
+	//! Worker threads keep a shared pointer to the buffer and append the text by value, the log view
+	//! takes all pending text once per frame in the UI thread. The buffer may outlive the log view,
+	//! text appended after the view was destroyed is dropped
+	class UICORE_API_EXPORT aLogBuffer {
+	public:
+		//! @brief Will append the text to the buffer and schedule a flush of the log view.
+		//! This function may be called from any thread
+		//! @param _text The text to append
+		void append(
+			const QString &					_text
+		);
+
+		//! @brief Will return all pending text and clear the buffer
+		QString take(void);
+
+	private:
+		friend class aLogViewWidget;
+
+		aLogBuffer(aLogViewWidget * _view);
+
+		std::mutex						m_mutex;					//! Protects all members
+		QString							m_pendingText;				//! The text that was not inserted yet
+		aLogViewWidget *				m_view;						//! The log view to notify, nullptr after the view was destroyed
+		bool							m_flushScheduled;
+
+		aLogBuffer(const aLogBuffer &) = delete;
+		aLogBuffer & operator = (const aLogBuffer &) = delete;
+	};
+
+	//! @brief Read only plain text view for live output consoles.
+	//! Appended text is collected in a aLogBuffer and inserted once per frame, the number of lines is
+	//! limited (oldest lines are removed) and the undo history is disabled. The view only scrolls to
+	//! the bottom if it was at the bottom before the text was inserted
+	class UICORE_API_EXPORT aLogViewWidget : public QPlainTextEdit, public aWidget
+	{
+		Q_OBJECT
+	public:
+		//! @brief Constructor
+		//! @param _maximumLineCount The maximum number of lines to keep, 0 for unlimited
+		//! @param _parent The parent QWidget for this log view
+		aLogViewWidget(int _maximumLineCount = 10000, QWidget * _parent = (QWidget *) nullptr);
+
+		//! @brief Deconstructor
+		virtual ~aLogViewWidget();
+
+		// #######################################################################################################
+		// Event handling
+
+		virtual void keyPressEvent(QKeyEvent * _event) override;
+
+		virtual void keyReleaseEvent(QKeyEvent * _event) override;
+
+		// #######################################################################################################
+
+		// Base class functions
+
+		//! @brief Will return the widgets widget to display it
+		virtual QWidget * widget(void) override;
+
+		//! @brief Will set the objects color style
+		//! @param _colorStyle The color style to set
+		//! @throw ak::Exception if the provided color style is a nullptr or failed to repaint the object
+		virtual void setColorStyle(
+			aColorStyle *			_colorStyle
+		) override;
+
+		// #######################################################################################################
+
+		//! @brief Will append the text at the end of the log.
+		//! The text is inserted with the next flush (one frame later), this function may be called from any thread
+		//! @param _text The text to append
+		void appendText(
+			const QString &					_text
+		) { m_buffer->append(_text); }
+
+		//! @brief Will return the buffer of this log view.
+		//! Worker threads should keep the buffer instead of a pointer to the view
+		std::shared_ptr<aLogBuffer> buffer(void) const { return m_buffer; }
+
+		//! @brief Will remove all text, including the text that was not inserted yet
+		void clearLog(void);
+
+		//! @brief Will set the maximum number of lines to keep
+		//! @param _maximumLineCount The maximum number of lines, 0 for unlimited
+		void setMaximumLineCount(
+			int								_maximumLineCount
+		);
+
+		//! @brief Returns the maximum number of lines to keep
+		int maximumLineCount(void) const;
+
+		//! @brief Will insert all pending text immediately
+		void flush(void);
+
+	signals:
+		void keyPressed(QKeyEvent *);
+		void keyReleased(QKeyEvent *);
+
+	private slots:
+		void slotFlushTimeout();
+
+	private:
+		friend class aLogBuffer;
+
+		std::shared_ptr<aLogBuffer>		m_buffer;
+		QTimer *						m_flushTimer;
+
+		aLogViewWidget(const aLogViewWidget &) = delete;
+		aLogViewWidget & operator = (const aLogViewWidget &) = delete;
+
+	};
+}
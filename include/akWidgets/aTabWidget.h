@@ -15,14 +15,18 @@
  // AK header
 #include <akCore/globalDataTypes.h>
 #include <akWidgets/aWidget.h>
+#include <akCore/aTextIndex.h>
 
 // Qt header
 #include <qtabwidget.h>
 #include <qstring.h>
 #include <qstringlist.h>
+#include <qicon.h>
 
 // C++ header
 #include <vector>
+#include <map>
+#include <functional>
 
 // Forward declaration
 class QWidget;
@@ -72,6 +76,67 @@ namespace ak {
 			QTabBar *							_tabBar
 		);
 
+		//! @brief Will set the text of the tab and update the text index.
+		//! Tabs renamed through QTabWidget or QTabBar are detected at the next lookup and cause an index rebuild
+		void setTabText(
+			int									_index,
+			const QString &						_text
+		);
+
+		//! @brief Will set the case sensitivity used to find tabs by their text
+		void setTextLookupCaseSensitivity(
+			Qt::CaseSensitivity					_caseSensitivity
+		);
+
+		// #######################################################################################################
+
+		// Lazy tabs
+
+		//! @brief Creates the content of a lazy tab
+		typedef std::function<QWidget *(void)> tabFactory;
+
+		//! @brief Destroys the content of a lazy tab that is unloaded
+		typedef std::function<void(QWidget *)> tabDestroyer;
+
+		//! @brief Will add a tab whose content is created when the tab is activated for the first time.
+		//! Until then the tab only contains an empty placeholder. If the created widget is an aWidget the current color style is applied.
+		//! When the tab is removed the placeholder (and the content, if created) is handed to the caller as a plain widget
+		//! @param _factory The function creating the tab content
+		//! @param _title The title of the tab
+		//! @param _icon The icon of the tab
+		//! @param _destroyer The function destroying the tab content. If set, the content may be unloaded again (see setMaximumLoadedLazyTabs())
+		ID addLazyTab(
+			const tabFactory &					_factory,
+			const QString &						_title,
+			const QIcon &						_icon = QIcon(),
+			const tabDestroyer &				_destroyer = tabDestroyer()
+		);
+
+		//! @brief Returns true if the tab is a lazy tab whose content is currently created
+		bool isLazyTabLoaded(
+			int									_index
+		) const;
+
+		//! @brief Will create the content of the lazy tab if not done yet
+		void loadLazyTab(
+			int									_index
+		);
+
+		//! @brief Will destroy the content of the lazy tab, the tab will show the placeholder until it is activated again.
+		//! Only lazy tabs with a destroyer can be unloaded
+		void unloadLazyTab(
+			int									_index
+		);
+
+		//! @brief Will set the maximum number of unloadable lazy tabs that may be loaded at the same time.
+		//! If the limit is exceeded the tabs that were not visited for the longest time are unloaded
+		//! @param _count The maximum count, 0 for unlimited
+		void setMaximumLoadedLazyTabs(
+			int									_count
+		);
+
+		int maximumLoadedLazyTabs(void) const { return m_maximumLoadedLazyTabs; }
+
 		// #######################################################################################################
 
 		// Getter
@@ -82,5 +147,50 @@ namespace ak {
 		//! @param _tabText The text of the tab to look for
 		bool hasTab(const QString & _tabText);
 
+		//! @brief Will return the index of the first tab with the provided text or invalidID if no tab has this text
+		//! @param _tabText The text of the tab to look for
+		ID findTabByText(const QString & _tabText);
+
+	signals:
+		//! @brief Is emitted after the content of a lazy tab was created
+		void lazyTabLoaded(int _index);
+
+	protected:
+		virtual void tabInserted(int _index) override;
+
+		virtual void tabRemoved(int _index) override;
+
+	private slots:
+		void slotTabMoved(int _from, int _to);
+		void slotCurrentChanged(int _index);
+
+	private:
+		//! @brief Will rebuild the text index if the tabs were changed since the last lookup
+		//! or if any tab text differs from the text it was indexed with
+		void refreshTextIndex(void);
+
+		struct lazyTab {
+			tabFactory			factory;
+			tabDestroyer		destroyer;
+			QWidget *			content;
+			unsigned long long	lastActivation;
+		};
+
+		//! @brief Will create the content of the lazy tab
+		void loadLazyTab(QWidget * _placeholder, lazyTab & _tab);
+
+		//! @brief Will destroy the content of the lazy tab
+		void unloadLazyTab(lazyTab & _tab);
+
+		//! @brief Will unload the least recently visited lazy tabs until the limit is reached
+		void applyLazyTabLimit(void);
+
+		std::map<QWidget *, lazyTab>	m_lazyTabs;				//! Placeholder widget to lazy tab
+		unsigned long long				m_activationCounter;
+		int								m_maximumLoadedLazyTabs;
+
+		aTextIndex				m_textIndex;			//! Tab text to tab index
+		bool					m_textIndexIsDirty;		//! If true the tab indices changed since the last lookup
+		std::vector<QString>	m_indexedTexts;			//! The tab texts the index was built from
 	};
 } // namespace ak
\ No newline at end of file
@@ -0,0 +1,287 @@
+/*
+ *	File:		aTableViewWidget.h
+ *	Package:	akWidgets
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#pragma once
+
+ // AK header
+#include <akCore/globalDataTypes.h>
+#include <akWidgets/aWidget.h>
+
+ // Qt header
+#include <qabstractitemmodel.h>			// base class
+#include <qtableview.h>					// base class
+#include <qstring.h>					// QString
+#include <qcolor.h>						// QColor
+#include <qheaderview.h>				// QHeaderView
+
+// C++ header
+#include <vector>
+#include <unordered_map>
+
+// Forward declaration
+class QFocusEvent;
+class QKeyEvent;
+
+namespace ak {
+
+	//! @brief Table model storing the cell texts column by column.
+	//! Every cell only needs the space of one (implicitly shared) QString, cell attributes (colors and flags)
+	//! are only stored for the cells they were set for
+	class UICORE_API_EXPORT aTableModel : public QAbstractTableModel
+	{
+		Q_OBJECT
+	public:
+		aTableModel(QObject * _parent = (QObject *) nullptr);
+
+		virtual ~aTableModel();
+
+		// #######################################################################################################
+
+		// Base class functions
+
+		virtual int rowCount(const QModelIndex & _parent = QModelIndex()) const override;
+
+		virtual int columnCount(const QModelIndex & _parent = QModelIndex()) const override;
+
+		virtual QVariant data(const QModelIndex & _index, int _role = Qt::DisplayRole) const override;
+
+		virtual bool setData(const QModelIndex & _index, const QVariant & _value, int _role = Qt::EditRole) override;
+
+		virtual QVariant headerData(int _section, Qt::Orientation _orientation, int _role = Qt::DisplayRole) const override;
+
+		virtual Qt::ItemFlags flags(const QModelIndex & _index) const override;
+
+		// #######################################################################################################
+
+		// Bulk data
+
+		//! @brief Will set the row and column count, all data will be removed
+		void setDimensions(
+			int										_rows,
+			int										_columns
+		);
+
+		//! @brief Will set the row count, the data of the existing rows is kept
+		void setRowCount(
+			int										_rows
+		);
+
+		//! @brief Will set the column count, the data of the existing columns is kept
+		void setColumnCount(
+			int										_columns
+		);
+
+		//! @brief Will set the texts of a column. Rows are added if required
+		//! @param _column The column to set the texts at
+		//! @param _values The texts, one per row
+		//! @param _count The number of texts
+		//! @param _firstRow The row to set the first text at
+		void setColumn(
+			int										_column,
+			const QString *							_values,
+			int										_count,
+			int										_firstRow = 0
+		);
+
+		//! @brief Will set the texts of multiple rows. Rows are added if required
+		//! @param _firstRow The row to set the first text at
+		//! @param _values The texts in row major order (_rowCount * _columnCount texts)
+		//! @param _rowCount The number of rows provided
+		//! @param _columnCount The number of texts per row, must not exceed the column count
+		void setRows(
+			int										_firstRow,
+			const QString *							_values,
+			int										_rowCount,
+			int										_columnCount
+		);
+
+		//! @brief Will remove all rows and cell attributes
+		void clearRows(void);
+
+		// #######################################################################################################
+
+		// Cells
+
+		void setCellText(
+			int										_row,
+			int										_column,
+			const QString &							_text
+		);
+
+		const QString & cellText(
+			int										_row,
+			int										_column
+		) const;
+
+		void setCellForecolor(
+			int										_row,
+			int										_column,
+			const QColor &							_color
+		);
+
+		void setCellBackcolor(
+			int										_row,
+			int										_column,
+			const QColor &							_color
+		);
+
+		void setCellEditable(
+			int										_row,
+			int										_column,
+			bool									_editable
+		);
+
+		bool isCellEditable(
+			int										_row,
+			int										_column
+		) const;
+
+		void setCellSelectable(
+			int										_row,
+			int										_column,
+			bool									_selectable
+		);
+
+		bool isCellSelectable(
+			int										_row,
+			int										_column
+		) const;
+
+		//! @brief Will set the editable flag for all cells without an explicit flag
+		void setCellsEditable(
+			bool									_editable
+		);
+
+		void setColumnHeader(
+			int										_column,
+			const QString &							_text
+		);
+
+	signals:
+		//! @brief Is emitted when the user changed the text of a cell
+		void cellChanged(int _row, int _column);
+
+	private:
+
+		struct cellAttributes {
+			QColor			foreground;
+			QColor			background;
+			bool			hasFlags;
+			bool			editable;
+			bool			selectable;
+
+			cellAttributes() : hasFlags(false), editable(false), selectable(true) {}
+		};
+
+		static unsigned long long cellKey(int _row, int _column) {
+			return (static_cast<unsigned long long>(static_cast<unsigned int>(_row)) << 32) | static_cast<unsigned int>(_column);
+		}
+
+		const cellAttributes * attributes(int _row, int _column) const;
+
+		//! @brief Will add rows if the row count is less than the provided count
+		void ensureRowCount(int _rows);
+
+		std::vector<std::vector<QString>>							m_columns;
+		std::vector<QString>										m_headers;
+		std::unordered_map<unsigned long long, cellAttributes>		m_attributes;
+		int															m_rowCount;
+		bool														m_cellsEditable;
+
+		aTableModel(const aTableModel &) = delete;
+		aTableModel & operator = (const aTableModel &) = delete;
+	};
+
+	// ###########################################################################################################################################
+
+	//! @brief This class combines the functionallity of a QTableView showing an aTableModel and a ak::ui::core::aWidget.
+	//! Use this table instead of the aTableWidget for large data sets
+	class UICORE_API_EXPORT aTableViewWidget : public QTableView, public aWidget
+	{
+		Q_OBJECT
+	public:
+
+		//! @brief Constructor
+		//! @param _rows The initial row count
+		//! @param _columns The initial columns count
+		//! @param _parent The parent QWidget for this table
+		aTableViewWidget(int _rows = 0, int _columns = 0, QWidget * _parent = (QWidget *) nullptr);
+
+		//! @brief Deconstructor
+		virtual ~aTableViewWidget();
+
+		// #######################################################################################################
+
+		// Event handling
+
+		//! @brief Emits a key pressend signal a key is pressed
+		virtual void keyPressEvent(QKeyEvent * _event) override;
+
+		//! @brief Emits a key released signal a key is released
+		virtual void keyReleaseEvent(QKeyEvent * _event) override;
+
+		//! @brief Emits a focusLost signal
+		virtual void focusOutEvent(QFocusEvent * _event) override;
+
+		// #######################################################################################################
+
+		// Base class functions
+
+		//! @brief Will return the widgets widget to display it
+		virtual QWidget * widget(void) override;
+
+		//! @brief Will set the objects color style
+		//! @param _colorStyle The color style to set
+		//! @throw ak::Exception if the provided color style is a nullptr or failed to repaint the object
+		virtual void setColorStyle(
+			aColorStyle *			_colorStyle
+		) override;
+
+		// #######################################################################################################
+
+		//! @brief Will return the model containing the data
+		aTableModel * tableModel(void) const { return m_model; }
+
+		//! @brief Will set the resize mode of the provided column
+		void setColumnResizeMode(
+			int																_column,
+			QHeaderView::ResizeMode											_mode
+		);
+
+		//! @brief Will set the visible mode for the row header
+		void setRowHeaderIsVisible(
+			bool															_visible
+		);
+
+	signals:
+		void keyPressed(QKeyEvent *);
+		void keyReleased(QKeyEvent *);
+		void focusLost();
+		void cellActivated(int, int);
+		void cellChanged(int, int);
+		void cellClicked(int, int);
+		void cellDoubleClicked(int, int);
+		void cellEntered(int, int);
+
+	private slots:
+		void slotActivated(const QModelIndex & _index);
+		void slotClicked(const QModelIndex & _index);
+		void slotDoubleClicked(const QModelIndex & _index);
+		void slotEntered(const QModelIndex & _index);
+
+	private:
+		aTableModel *				m_model;
+
+		aTableViewWidget(const aTableViewWidget &) = delete;
+		aTableViewWidget & operator = (const aTableViewWidget &) = delete;
+	};
+} // namespace ak
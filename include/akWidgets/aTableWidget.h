@@ -22,6 +22,10 @@
 #include <qstring.h>					// QString
 #include <qcolor.h>						// QColor
 #include <qheaderview.h>				// QHeaderView
+#include <qstringlist.h>				// QStringList
+
+// C++ header
+#include <functional>
 
 // Forward declaration
 class QFocusEvent;
@@ -29,6 +33,9 @@ class QKeyEvent;
 
 namespace ak {
 
+	// Forward declaration
+	class aChunkedPopulator;
+
 	//! @brief This class combines the functionallity of a QTableWidget and a ak::ui::core::aWidget
 	class UICORE_API_EXPORT aTableWidget : public QTableWidget, public aWidget
 	{
@@ -184,6 +191,36 @@ namespace ak {
 
 		// ##############################################################################################################
 
+		// Population
+
+		//! @brief Provides the cell texts of a row. Must return false if there are no more rows
+		//! @param _row The index of the requested row, starting at 0 for every population
+		//! @param _cells The cell texts to set, the list is cleared before every call
+		typedef std::function<bool(int _row, QStringList & _cells)> rowProducer;
+
+		//! @brief Will append the rows provided by the producer in time sliced chunks.
+		//! Every chunk is processed in a single event loop iteration, sorting is disabled until the population finished.
+		//! A running population will be cancelled
+		//! @param _producer The producer of the rows
+		//! @param _expectedRowCount The expected number of rows (used for the progress), -1 if unknown
+		void populate(
+			const rowProducer &												_producer,
+			int																_expectedRowCount = -1
+		);
+
+		//! @brief Will cancel a running population, the rows added so far are kept
+		void cancelPopulation(void);
+
+		//! @brief Returns true if a population is running
+		bool isPopulating(void) const;
+
+		//! @brief Will set the time in milliseconds that may be spent per chunk
+		void setPopulationTimeBudget(
+			int																_milliseconds
+		);
+
+		// ##############################################################################################################
+
 		// Information
 
 		//! @brief Returns true if the row header is visible
@@ -230,8 +267,25 @@ namespace ak {
 		void keyReleased(QKeyEvent *);
 		void focusLost();
 
+		//! @brief Is emitted after every chunk of a population
+		void populationProgress(int _rowCount, int _expectedRowCount);
+
+		//! @brief Is emitted when a population finished or was cancelled
+		void populationFinished(int _rowCount, bool _cancelled);
+
+	private slots:
+		void slotPopulationChunkStarted(void);
+		void slotPopulationProgress(int _rowCount, int _expectedRowCount);
+		void slotPopulationFinished(int _rowCount, bool _cancelled);
+
 	private:
 
+		//! @brief Will create the populator if required
+		aChunkedPopulator * populator(void);
+
+		aChunkedPopulator *		m_populator;
+		bool					m_sortingWasEnabled;
+
 		//! @brief will throw an exception if the row or column index is out of range
 		//! @param _row The row index to check
 		//! @param _column The column index to check
@@ -16,6 +16,7 @@
 #include <akCore/globalDataTypes.h>
 #include <akCore/akCore.h>
 #include <akWidgets/aWidget.h>
+#include <akCore/aTextIndex.h>
 
 // Qt header
 #include <qobject.h>						// Base class
@@ -499,6 +500,14 @@ namespace ak {
 			ID							_id
 		);
 
+		//! @brief Will update the text index after the text of a top level item was changed
+		//! @param _item The item that was changed
+		//! @param _oldText The text of the item before the change
+		void topLevelItemTextChanged(
+			aTreeWidgetItem *			_item,
+			const QString &				_oldText
+		);
+
 		// ####################################################################################################################################
 
 		//! @brief Will extract the id form the QTreeWidgetItem (which must be a treeItem)
@@ -514,6 +523,7 @@ namespace ak {
 
 	private:
 		std::map<ID, aTreeWidgetItem *>			m_topLevelItems;
+		aTextIndex								m_topLevelIndex;		//! Top level item text to item ID
 
 		aTreeWidgetBase(aTreeWidgetBase &) = delete;
 		aTreeWidgetBase& operator = (aTreeWidgetBase &) = delete;
@@ -79,7 +79,12 @@ namespace ak {
 		) override;
 
 	private:
+		//! @brief Will query the large icon size from the style of the group and apply it to all tool buttons if it changed.
+		//! Is called on creation and whenever the style of the group changes
+		void refreshIconSize(void);
+
 		tt::Group *								m_group;
+		int										m_iconSize;			//! The icon size of the tool buttons
 
 		// Block default constructor
 		aTtbGroup() = delete;
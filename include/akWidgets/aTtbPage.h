@@ -24,6 +24,9 @@
 // Qt header
 #include <qstring.h>					// QString
 
+// C++ header
+#include <functional>
+
 // Forward declaraion
 namespace tt { class Page; }
 
@@ -81,8 +84,22 @@ namespace ak {
 			bool						_enabled
 		) override;
 
+		//! @brief Will set a function that builds the content of this page when it is shown for the first time.
+		//! If a build is already pending the provided function will be called after it
+		//! @param _build The build function
+		void setDeferredBuild(
+			const std::function<void()> &	_build
+		);
+
+		//! @brief Will run the pending build (if any). Is called when the page becomes the current tab
+		void runDeferredBuild(void);
+
+		//! @brief Returns true if the page content was not built yet
+		bool hasDeferredBuild(void) const { return m_deferredBuild ? true : false; }
+
 	private:
 		tt::Page *						m_page;
+		std::function<void()>			m_deferredBuild;
 
 		// Block default constructor
 		aTtbPage() = delete;
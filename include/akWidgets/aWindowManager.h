@@ -14,6 +14,9 @@
 
 // C++ header
 #include <map>
+#include <vector>
+#include <memory>
+#include <mutex>
 
 // Qt header
 #include <qobject.h>
@@ -43,6 +46,7 @@ namespace ak {
 	class aIconManager;
 	class aMessenger;
 	class aObjectManager;
+	class aProgressTask;
 	class aTtbContainer;
 	class aTtbPage;
 	class aUidManager;
@@ -101,6 +105,18 @@ namespace ak {
 			rapidjson::Document::AllocatorType &	_allocator
 		) override;
 
+		//! @brief Will write this objects current state to the provided writer
+		//! The window state is written directly without creating a rapidjson::Value per byte
+		virtual void writeObjectSettings(
+			rJSONStreamWriter &						_writer
+		) override;
+
+		//! @brief Will add this objects current state to the provided snapshot
+		//! The window state is written directly in the binary encoding
+		virtual void writeObjectSettings(
+			aStateSnapshot &						_snapshot
+		) override;
+
 		//! @brief Will restore the settings from the provided JSON value which must have an object type
 		//! The value looks like this:
 		//!	     { { "[SettingsName]":"[SettingsValue]",... } }
@@ -170,7 +186,7 @@ namespace ak {
 			bool													_hideDelayed = true
 		);
 
-		//! @brief Will set the progress of the status bar
+		//! @brief Will set the progress of the status bar, the progress bar is only updated if the value changed
 		//! @param _progress The progress to set the status bar (0 - 100)
 		void setStatusBarProgress(
 			int														_progress
@@ -219,6 +235,32 @@ namespace ak {
 			bool									_visible
 		);
 
+		// #############################################################################################################
+
+		// Progress tasks
+
+		//! @brief Will create a task which progress is displayed in the status bar. May be called from any thread.
+		//! The task progress is sampled on the GUI thread at the display refresh rate, the progress of multiple tasks is aggregated.
+		//! The progress bar and status label are shown and hidden by the show and hide delay timers.
+		//! The task is only referenced weakly, releasing the returned pointer finishes the task
+		//! @param _label The label displayed in the status label
+		//! @param _total The total progress of the task, 0 if unknown
+		std::shared_ptr<aProgressTask> createProgressTask(
+			const QString &							_label,
+			long long								_total = 0
+		);
+
+		//! @brief Will set the interval in milliseconds the progress tasks are sampled at
+		void setProgressSampleInterval(
+			int										_interval
+		);
+
+		int getProgressSampleInterval(void) const;
+
+		//! @brief Will update the status bar from the progress tasks, is called by the sample timer.
+		//! The visibility, text and progress the application set before the first task is restored once all tasks are finished
+		void sampleProgressTasks(void);
+
 		void setWaitingAnimation(
 			QMovie *							_movie
 		);
@@ -246,6 +288,19 @@ namespace ak {
 			const QString &				_text
 		);
 
+		//! @brief Will return the tab toolbar page at the specified index or nullptr if there is no such page
+		//! @param _index The index of the page
+		aTtbPage * getTabToolBarPage(
+			int							_index
+		);
+
+		//! @brief Will suspend updates and restyling of the tab toolbar until endTabToolBarUpdate() is called.
+		//! Calls may be nested
+		void beginTabToolBarUpdate(void);
+
+		//! @brief Will resume updates of the tab toolbar and apply a pending restyle
+		void endTabToolBarUpdate(void);
+
 		//! @brief Will add the object with the provided uid to the specified parent object
 		//! The object must have been creted by the objectManager used in this tab toolbar manager.
 		//! Valid objects are actions or any object derived from aWidget
@@ -350,11 +405,29 @@ namespace ak {
 
 		bool								m_progressBarContinuous;		//! If true, the status bar ist currently continuous
 
+		int									m_tabToolBarUpdateDepth;		//! The number of nested tab toolbar updates
+		bool								m_tabToolBarStylePending;		//! If true, the color style must be applied when the update ends
+
 		QTimer *							m_timerProgressShow;			//! The timer used to show the progress bar delayed
 		QTimer *							m_timerProgressHide;			//! The timer used to hide the progress bar delayed
 		QTimer *							m_timerLabelShow;				//! The timer used to show the status label delayed
 		QTimer *							m_timerLabelHide;				//! The timer used to hide the status label delayed
 		QTimer *							m_timerShowMainWindow;			//! The timer used to show the main window upon creation
+		QTimer *							m_timerProgressSample;			//! The timer used to sample the progress tasks
+
+		std::mutex									m_progressTasksMutex;
+		std::vector<std::weak_ptr<aProgressTask>>	m_progressTasks;		//! The running progress tasks, a released task counts as finished
+		bool										m_progressTasksShown;	//! If true, the status objects are displaying the progress tasks
+
+		//! @brief The state of the status objects before the progress tasks were shown, it is restored once all tasks are finished
+		struct statusState {
+			bool			progressBarVisible;
+			bool			labelVisible;
+			bool			progressBarContinuous;
+			int				progress;
+			QString			labelText;
+		};
+		statusState									m_statusStateBeforeTasks;
 
 		std::vector<aTtbContainer *>		m_tabToolBarContainer;
 	};
@@ -39,7 +39,8 @@ namespace ak {
 			progressHide,
 			statusLabelShow,
 			statusLabelHide,
-			showWindow
+			showWindow,
+			progressSample
 		};
 
 		//! @brief Constructor
@@ -62,6 +63,7 @@ namespace ak {
 		void timerTimeoutLabelShow(void);
 		void timerTimeoutLabelHide(void);
 		void timerTimeoutShowWindow(void);
+		void timerTimeoutProgressSample(void);
 
 	private:
 		//! Contains all information about the timer
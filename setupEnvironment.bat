@@ -51,7 +51,7 @@ SET ZLIB_LIB=%SIM_PLAT_ROOT%\Third_Party_Libraries\zlib\zlib-1.2.11\contrib\vstu
 REM ##########################################################################################################
 
 REM Set UI_CORE Project settings
-SET UICORE_PROJ_ENV_INC=%QDIR%\include\QtCore\; %QDIR%\include\QtGui\; %QDIR%\include\QtWidgets\; %QT_TT_ROOT%\include\; %R_JSON_ROOT%\include\; %CURL_INC%
+SET UICORE_PROJ_ENV_INC=%QDIR%\include\QtCore\; %QDIR%\include\QtGui\; %QDIR%\include\QtWidgets\; %QT_TT_ROOT%\include\; %R_JSON_ROOT%\include\; %CURL_INC%; %ZLIB_ROOT%
 SET UICORE_ENV_INC=%UI_CORE_ROOT%\include; $(UICORE_PROJ_ENV_INC)
 
 SET UICORE_PROJ_ENV_LIB_ROOT=%QT_TT_ROOT%\src\TabToolbar\Release; %QDIR%\lib; %CURL_LIB%; %ZLIB_LIB%
@@ -16,6 +16,7 @@
 // AK Core
 #include <akCore/aException.h>				// Error handling
 #include <akCore/aFile.h>
+#include <akCore/aHash.h>
 #include <akCore/aMessenger.h>				// Messaging
 #include <akCore/aNotifier.h>				// Notifier
 #include <akCore/aObject.h>
@@ -23,6 +24,9 @@
 #include <akGui/aTimer.h>
 #include <akCore/aUidMangager.h>
 
+// AK net
+#include <akNet/aHttpClient.h>
+
 // AK dialogs
 #include <akDialogs/aLogInDialog.h>
 #include <akDialogs/aOptionsDialog.h>
@@ -52,10 +56,12 @@
 #include <akWidgets/aLabelWidget.h>
 #include <akWidgets/aLineEditWidget.h>
 #include <akWidgets/aListWidget.h>
+#include <akWidgets/aLogViewWidget.h>
 #include <akWidgets/aNiceLineEditWidget.h>
 #include <akWidgets/aPropertyGridWidget.h>
 #include <akWidgets/aPushButtonWidget.h>
 #include <akWidgets/aTableWidget.h>
+#include <akWidgets/aTableViewWidget.h>
 #include <akWidgets/aTabWidget.h>
 #include <akWidgets/aTextEditWidget.h>
 #include <akWidgets/aToolButtonWidget.h>
@@ -77,6 +83,9 @@
 #include <qdatetime.h>
 #include <qsettings.h>
 
+// C++ header
+#include <memory>
+
 static ak::uiAPI::apiManager		m_apiManager;					//! The API manager
 static ak::aObjectManager *			m_objManager = nullptr;					//! The object manager used in this API
 static ak::aMessenger *				m_messenger = nullptr;					//! The messenger used in this API
@@ -96,7 +105,8 @@ ak::uiAPI::apiManager::apiManager()
 	m_defaultSurfaceFormat(nullptr),
 	m_fileUidManager(nullptr),
 	m_app(nullptr),
-	m_settings(nullptr)
+	m_settings(nullptr),
+	m_settingsCache(nullptr)
 {
 	aSingletonAllowedMessages::instance();
 	m_fileUidManager = new aUidManager();
@@ -124,6 +134,11 @@ ak::uiAPI::apiManager::~apiManager() {
 		delete m_uidManager; m_uidManager = nullptr;
 	}
 
+	// The settings cache will write the pending changes
+	if (m_settingsCache != nullptr) {
+		delete m_settingsCache; m_settingsCache = nullptr;
+	}
+
 	if (m_settings != nullptr) {
 		delete m_settings; m_settings = nullptr;
 	}
@@ -152,6 +167,9 @@ void ak::uiAPI::apiManager::ini(
 	
 	// object manager
 	m_objManager = new aObjectManager(m_messenger, m_uidManager);
+
+	// settings cache
+	m_settingsCache = new aSettingsCache(m_settings, m_messenger, m_uidManager->getId());
 	
 	m_isInitialized = true;
 }
@@ -160,7 +178,9 @@ bool ak::uiAPI::apiManager::isInitialized(void) const { return m_isInitialized;
 
 int ak::uiAPI::apiManager::exec(void) {
 	assert(m_isInitialized);	// API not initialized
-	return m_app->exec();
+	int result = m_app->exec();
+	m_settingsCache->flush();
+	return result;
 }
 
 QSurfaceFormat * ak::uiAPI::apiManager::getDefaultSurfaceFormat(void) {
@@ -268,6 +288,23 @@ ak::settingsRestoreErrorCode ak::uiAPI::restoreStateWindow(
 	return m_objManager->restoreStateWindow(_json.c_str(), _applicationVersion);
 }
 
+std::string ak::uiAPI::saveStateWindowBinary(
+	const std::string &									_applicationVersion,
+	bool												_compress
+) {
+	assert(m_objManager != nullptr);	// API not initialized
+	return m_objManager->saveStateWindowBinary(_applicationVersion, _compress);
+}
+
+ak::settingsRestoreErrorCode ak::uiAPI::restoreStateWindowBinary(
+	const std::string &									_data,
+	const std::string &									_applicationVersion
+) {
+	assert(m_objManager != nullptr); // Not initialized
+	if (_data.length() == 0) { return ak::settingsRestoreErrorCode::srecEmptySettingsString; }
+	return m_objManager->restoreStateWindowBinary(_data, _applicationVersion);
+}
+
 ak::settingsRestoreErrorCode ak::uiAPI::restoreStateColorStyle(
 	const std::string &									_json,
 	const std::string &									_applicationVersion
@@ -506,6 +543,14 @@ ak::UID ak::uiAPI::createLogInDialog(
 	return m_objManager->createLogInDialog(_creatorUid, _showSavePassword, *m_iconManager->pixmap(_imageName), _username, _password);
 }
 
+ak::UID ak::uiAPI::createLogView(
+	UID												_creatorUid,
+	int													_maximumLineCount
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	return m_objManager->createLogView(_creatorUid, _maximumLineCount);
+}
+
 ak::UID ak::uiAPI::createNiceLineEdit(
 	UID												_creatorUid,
 	const QString &										_initialText,
@@ -563,6 +608,15 @@ ak::UID ak::uiAPI::createTable(
 	return m_objManager->createTable(_creatorUid, _rows, _columns);
 }
 
+ak::UID ak::uiAPI::createTableView(
+	UID												_creatorUid,
+	int													_rows,
+	int													_columns
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	return m_objManager->createTableView(_creatorUid, _rows, _columns);
+}
+
 ak::UID ak::uiAPI::createTabToolBarSubContainer(
 	UID												_creatorUid,
 	UID												_parentUid,
@@ -572,6 +626,16 @@ ak::UID ak::uiAPI::createTabToolBarSubContainer(
 	return m_objManager->createTabToolBarSubContainer(_creatorUid, _parentUid, _text);
 }
 
+void ak::uiAPI::buildTabToolBar(
+	UID												_creatorUid,
+	UID												_windowUid,
+	const aTtbLayout &								_layout,
+	bool											_deferHiddenPages
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	m_objManager->buildTabToolBar(_creatorUid, _windowUid, _layout, _deferHiddenPages);
+}
+
 ak::UID ak::uiAPI::createTextEdit(
 	UID												_creatorUid,
 	const QString &										_initialText
@@ -957,6 +1021,19 @@ bool ak::uiAPI::dockWatcher::isWatchEnabled(
 	return object::get<aDockWatcherWidget>(_dockWatcherUid)->isWatcherEnabled();
 }
 
+int ak::uiAPI::dockWatcher::visibleDockCount(
+	ak::UID						_dockWatcherUid
+) {
+	return object::get<aDockWatcherWidget>(_dockWatcherUid)->visibleDockCount();
+}
+
+bool ak::uiAPI::dockWatcher::isDockVisible(
+	ak::UID						_dockWatcherUid,
+	ak::UID						_dockUid
+) {
+	return object::get<aDockWatcherWidget>(_dockWatcherUid)->isDockVisible(object::get<aDockWidget>(_dockUid));
+}
+
 // Dock watcher
 
 // ###############################################################################################################################################
@@ -1161,6 +1238,34 @@ QString ak::uiAPI::logInDialog::getCustomFieldText(
 
 // ###############################################################################################################################################
 
+// Log view
+
+void ak::uiAPI::logView::appendText(
+	UID												_logViewUID,
+	const QString &										_text
+) { object::get<aLogViewWidget>(_logViewUID)->appendText(_text); }
+
+void ak::uiAPI::logView::clear(
+	UID												_logViewUID
+) { object::get<aLogViewWidget>(_logViewUID)->clearLog(); }
+
+void ak::uiAPI::logView::setMaximumLineCount(
+	UID												_logViewUID,
+	int													_maximumLineCount
+) { object::get<aLogViewWidget>(_logViewUID)->setMaximumLineCount(_maximumLineCount); }
+
+int ak::uiAPI::logView::maximumLineCount(
+	UID												_logViewUID
+) { return object::get<aLogViewWidget>(_logViewUID)->maximumLineCount(); }
+
+std::shared_ptr<ak::aLogBuffer> ak::uiAPI::logView::buffer(
+	UID												_logViewUID
+) { return object::get<aLogViewWidget>(_logViewUID)->buffer(); }
+
+// Log view
+
+// ###############################################################################################################################################
+
 // Nice line edit
 
 void ak::uiAPI::niceLineEdit::setText(
@@ -1283,6 +1388,8 @@ void ak::uiAPI::object::setEnabled(
 	case otPushButton: akCastObject<aPushButtonWidget>(obj)->setEnabled(_enabled); return;
 	case otSpecialTabBar: akCastObject<aSpecialTabBar>(obj)->setEnabled(_enabled); return;
 	case otTable: akCastObject<aTableWidget>(obj)->setEnabled(_enabled); return;
+	case otTableView: akCastObject<aTableViewWidget>(obj)->setEnabled(_enabled); return;
+	case otLogView: akCastObject<aLogViewWidget>(obj)->setEnabled(_enabled); return;
 	case otTabToolbarGroup: akCastObject<aTtbGroup>(obj)->setEnabled(_enabled); return;
 	case otTabToolbarPage: akCastObject<aTtbPage>(obj)->setEnabled(_enabled); return;
 	case otTabToolbarSubgroup: akCastObject<aTtbSubGroup>(obj)->setEnabled(_enabled); return;
@@ -1321,6 +1428,8 @@ bool ak::uiAPI::object::getIsEnabled(
 	case otPushButton: return akCastObject<aPushButtonWidget>(obj)->isEnabled();
 	case otSpecialTabBar: return akCastObject<aSpecialTabBar>(obj)->isEnabled();
 	case otTable: return akCastObject<aTableWidget>(obj)->isEnabled();
+	case otTableView: return akCastObject<aTableViewWidget>(obj)->isEnabled();
+	case otLogView: return akCastObject<aLogViewWidget>(obj)->isEnabled();
 	case otTabToolbarGroup: return akCastObject<aTtbGroup>(obj)->enabled();
 	case otTabToolbarPage: return akCastObject<aTtbPage>(obj)->enabled();
 	case otTabToolbarSubgroup: return akCastObject<aTtbSubGroup>(obj)->enabled();
@@ -2159,6 +2268,36 @@ ak::ID ak::uiAPI::tabWidget::addTab(
 	const QIcon &		_icon
 ) { return object::get<aTabWidget>(_tabWidgetUID)->addTab(_widget, _icon, _title); }
 
+ak::ID ak::uiAPI::tabWidget::addLazyTab(
+	UID								_tabWidgetUID,
+	const std::function<UID(void)> &	_factory,
+	const QString &					_title,
+	const QIcon &					_icon,
+	bool							_unloadable
+) {
+	assert(_factory);	// No factory provided
+
+	// The UID of the current content is shared between the factory and the destroyer
+	std::shared_ptr<UID> contentUid = std::make_shared<UID>(invalidUID);
+	aTabWidget::tabFactory factory = [_factory, contentUid]() {
+		*contentUid = _factory();
+		return object::get<aWidget>(*contentUid)->widget();
+	};
+	aTabWidget::tabDestroyer destroyer;
+	if (_unloadable) {
+		destroyer = [contentUid](QWidget *) {
+			object::destroy(*contentUid);
+			*contentUid = invalidUID;
+		};
+	}
+	return object::get<aTabWidget>(_tabWidgetUID)->addLazyTab(factory, _title, _icon, destroyer);
+}
+
+void ak::uiAPI::tabWidget::setMaximumLoadedLazyTabs(
+	UID								_tabWidgetUID,
+	int								_count
+) { object::get<aTabWidget>(_tabWidgetUID)->setMaximumLoadedLazyTabs(_count); }
+
 void ak::uiAPI::tabWidget::closeAllTabs(
 	UID				_tabWidgetUID
 ) { object::get<aTabWidget>(_tabWidgetUID)->clear(); }
@@ -2235,15 +2374,175 @@ bool ak::uiAPI::tabWidget::hasTab(
 ak::ID ak::uiAPI::tabWidget::getTabIDByText(
 	UID							_tabWidgetUID,
 	const QString & _tabText
+) { return object::get<aTabWidget>(_tabWidgetUID)->findTabByText(_tabText); }
+
+void ak::uiAPI::tabWidget::setTextLookupCaseSensitive(
+	UID							_tabWidgetUID,
+	bool						_caseSensitive
+) { object::get<aTabWidget>(_tabWidgetUID)->setTextLookupCaseSensitivity(_caseSensitive ? Qt::CaseSensitive : Qt::CaseInsensitive); }
+
+// TabView
+
+// ###############################################################################################################################################
+
+// TableView
+
+void ak::uiAPI::tableView::setDimensions(
+	UID												_tableViewUID,
+	int													_rows,
+	int													_columns
 ) {
-	auto t = object::get<aTabWidget>(_tabWidgetUID)->tabTitles();
-	for (int i = 0; i < t.size(); i++) {
-		if (t.at(i) == _tabText) { return i; }
-	}
-	return invalidID;
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setDimensions(_rows, _columns);
 }
 
-// TabView
+void ak::uiAPI::tableView::setColumn(
+	UID												_tableViewUID,
+	int													_column,
+	const QString *										_values,
+	int													_count,
+	int													_firstRow
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setColumn(_column, _values, _count, _firstRow);
+}
+
+void ak::uiAPI::tableView::setRows(
+	UID												_tableViewUID,
+	int													_firstRow,
+	const QString *										_values,
+	int													_rowCount,
+	int													_columnCount
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setRows(_firstRow, _values, _rowCount, _columnCount);
+}
+
+void ak::uiAPI::tableView::setCellText(
+	UID												_tableViewUID,
+	int													_row,
+	int													_column,
+	const QString &										_text
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setCellText(_row, _column, _text);
+}
+
+QString ak::uiAPI::tableView::getCellText(
+	UID												_tableViewUID,
+	int													_row,
+	int													_column
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	return actualTableView->tableModel()->cellText(_row, _column);
+}
+
+void ak::uiAPI::tableView::setCellForecolor(
+	UID												_tableViewUID,
+	int													_row,
+	int													_column,
+	const QColor &										_color
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setCellForecolor(_row, _column, _color);
+}
+
+void ak::uiAPI::tableView::setCellBackcolor(
+	UID												_tableViewUID,
+	int													_row,
+	int													_column,
+	const QColor &										_color
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setCellBackcolor(_row, _column, _color);
+}
+
+void ak::uiAPI::tableView::setCellEditable(
+	UID												_tableViewUID,
+	int													_row,
+	int													_column,
+	bool												_editable
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setCellEditable(_row, _column, _editable);
+}
+
+void ak::uiAPI::tableView::setCellsEditable(
+	UID												_tableViewUID,
+	bool												_editable
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setCellsEditable(_editable);
+}
+
+void ak::uiAPI::tableView::setColumnHeader(
+	UID												_tableViewUID,
+	int													_column,
+	const QString &										_text
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->setColumnHeader(_column, _text);
+}
+
+void ak::uiAPI::tableView::clear(
+	UID												_tableViewUID
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	actualTableView->tableModel()->clearRows();
+}
+
+int ak::uiAPI::tableView::rowCount(
+	UID												_tableViewUID
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	return actualTableView->tableModel()->rowCount();
+}
+
+int ak::uiAPI::tableView::columnCount(
+	UID												_tableViewUID
+) {
+	assert(m_objManager != nullptr); // API not initialized
+	aTableViewWidget * actualTableView = nullptr;
+	actualTableView = dynamic_cast<aTableViewWidget *>(m_objManager->object(_tableViewUID));
+	assert(actualTableView != nullptr); // Invalid object type
+	return actualTableView->tableModel()->columnCount();
+}
 
 // ###############################################################################################################################################
 
@@ -3080,6 +3379,42 @@ QString ak::uiAPI::crypto::hash(
 	HashAlgorithm			_algorithm
 ) { return hashString(_orig, _algorithm); }
 
+QString ak::uiAPI::crypto::hashData(
+	const QByteArray &		_data,
+	HashAlgorithm			_algorithm
+) { return QString::fromLatin1(aHash::hash(_data.constData(), static_cast<size_t>(_data.size()), _algorithm).toHex()); }
+
+QString ak::uiAPI::crypto::hashFile(
+	const QString &			_filePath,
+	HashAlgorithm			_algorithm
+) { return aHash::hashFile(_filePath, _algorithm); }
+
+std::vector<QString> ak::uiAPI::crypto::hashBatch(
+	const QStringList &		_strings,
+	HashAlgorithm			_algorithm
+) { return aHash::hashBatch(_strings, _algorithm); }
+
+std::vector<QString> ak::uiAPI::crypto::hashFiles(
+	const QStringList &		_filePaths,
+	HashAlgorithm			_algorithm
+) { return aHash::hashFiles(_filePaths, _algorithm); }
+
+ak::aHash * ak::uiAPI::crypto::createHash(
+	HashAlgorithm			_algorithm
+) { return new aHash(_algorithm); }
+
+// ###############################################################################################################################################
+
+// Net
+
+ak::aHttpClient * ak::uiAPI::net::createHttpClient(
+	QObject *				_parent
+) {
+	assert(m_messenger != nullptr); // API not initialized
+	assert(m_uidManager != nullptr); // API not initialized
+	return new aHttpClient(m_messenger, m_uidManager->getId(), nullptr, _parent);
+}
+
 // ###############################################################################################################################################
 
 void ak::uiAPI::creatorDestroyed(
@@ -3174,70 +3509,91 @@ QString ak::uiAPI::settings::getString(
 	const QString &			_settingsName,
 	const QString &			_defaultValue
 ) {
-	return m_apiManager.settings()->value(_settingsName, _defaultValue).toString();
+	return m_apiManager.settingsCache()->value(_settingsName, _defaultValue).toString();
 }
 
 int ak::uiAPI::settings::getInt(
 	const QString &			_settingsName,
 	int						_defaultValue
 ) {
-	return m_apiManager.settings()->value(_settingsName, _defaultValue).toInt();
+	return m_apiManager.settingsCache()->value(_settingsName, _defaultValue).toInt();
 }
 
 double ak::uiAPI::settings::getDouble(
 	const QString &			_settingsName,
 	double					_defaultValue
 ) {
-	return m_apiManager.settings()->value(_settingsName, _defaultValue).toDouble();
+	return m_apiManager.settingsCache()->value(_settingsName, _defaultValue).toDouble();
 }
 
 float ak::uiAPI::settings::getFloat(
 	const QString &			_settingsName,
 	float					_defaultValue
 ) {
-	return m_apiManager.settings()->value(_settingsName, _defaultValue).toFloat();
+	return m_apiManager.settingsCache()->value(_settingsName, _defaultValue).toFloat();
 }
 
 bool ak::uiAPI::settings::getBool(
 	const QString &			_settingsName,
 	bool					_defaultValue
 ) {
-	return m_apiManager.settings()->value(_settingsName, _defaultValue).toBool();
+	return m_apiManager.settingsCache()->value(_settingsName, _defaultValue).toBool();
 }
 
 void ak::uiAPI::settings::setString(
 	const QString &			_settingsName,
 	const QString &			_value
 ) {
-	m_apiManager.settings()->setValue(_settingsName, _value);
+	m_apiManager.settingsCache()->setValue(_settingsName, _value);
 }
 
 void ak::uiAPI::settings::setInt(
 	const QString &			_settingsName,
 	int						_value
 ) {
-	m_apiManager.settings()->setValue(_settingsName, _value);
+	m_apiManager.settingsCache()->setValue(_settingsName, _value);
 }
 
 void ak::uiAPI::settings::setDouble(
 	const QString &			_settingsName,
 	double					_value
 ) {
-	m_apiManager.settings()->setValue(_settingsName, _value);
+	m_apiManager.settingsCache()->setValue(_settingsName, _value);
 }
 
 void ak::uiAPI::settings::setFloat(
 	const QString &			_settingsName,
 	float					_value
 ) {
-	m_apiManager.settings()->setValue(_settingsName, _value);
+	m_apiManager.settingsCache()->setValue(_settingsName, _value);
 }
 
 void ak::uiAPI::settings::setBool(
 	const QString &			_settingsName,
 	bool					_value
 ) {
-	m_apiManager.settings()->setValue(_settingsName, _value);
+	m_apiManager.settingsCache()->setValue(_settingsName, _value);
+}
+
+void ak::uiAPI::settings::flush(void) { m_apiManager.settingsCache()->flush(); }
+
+void ak::uiAPI::settings::setFlushInterval(
+	int						_interval
+) {
+	m_apiManager.settingsCache()->setFlushInterval(_interval);
+}
+
+ak::UID ak::uiAPI::settings::uid(void) { return m_apiManager.settingsCache()->uid(); }
+
+QString ak::uiAPI::settings::keyName(
+	int						_keyId
+) {
+	return m_apiManager.settingsCache()->keyName(_keyId);
+}
+
+ak::aSettingsCache * ak::uiAPI::settings::cache(void) {
+	assert(m_apiManager.settingsCache() != nullptr);	// API not initialized
+	return m_apiManager.settingsCache();
 }
 
 // ###############################################################################################################################################
@@ -11,37 +11,117 @@
  */
 
 #include <akCore/aDate.h>
+#include <akCore/aDateTimeConversion.h>
 
 #include <qstringlist.h>
 
-ak::aDate::aDate()
-	: m_d(1), m_m(1), m_y(1900)
-{}
+// C++ header
+#include <cstring>
+#include <cwchar>
+
+namespace {
+
+	//! @brief Will create the date from the three fields in the order they appear in the string
+	inline ak::aDate dateFromFields(int _first, int _second, int _third, ak::dateFormat _dateFormat) {
+		switch (_dateFormat)
+		{
+		case ak::dfDDMMYYYY: return ak::aDate(_first, _second, _third);
+		case ak::dfMMDDYYYY: return ak::aDate(_second, _first, _third);
+		case ak::dfYYYYMMDD: return ak::aDate(_third, _second, _first);
+		case ak::dfYYYYDDMM: return ak::aDate(_second, _third, _first);
+		default:
+			assert(0);
+			return ak::aDate();
+		}
+	}
 
-ak::aDate::aDate(int _d, int _m, int _y)
-	: m_d(_d), m_m(_m), m_y(_y)
-{}
+	template <class T> bool parseDate(const T * _string, size_t _length, ak::aDate & _result, T _delimiter, ak::dateFormat _dateFormat) {
+		const T * pos = _string;
+		const T * end = _string + _length;
+		int fields[3];
+		for (int i = 0; i < 3; i++) {
+			if (i > 0) {
+				if (pos == end || *pos != _delimiter) { return false; }
+				++pos;
+			}
+			if (!ak::dateTimeConversion::readNumber(pos, end, fields[i])) { return false; }
+		}
+		if (pos != end) { return false; }
+		_result = dateFromFields(fields[0], fields[1], fields[2], _dateFormat);
+		return true;
+	}
+
+	template <class T> size_t parseFixedDates(const T * _buffer, size_t _stride, size_t _count, ak::aDate * _results, T _delimiter, ak::dateFormat _dateFormat) {
+		assert(_stride >= 10);	// Record too short
+		// Layout is either DD-MM-YYYY or YYYY-MM-DD
+		const int w0 = (_dateFormat == ak::dfYYYYMMDD || _dateFormat == ak::dfYYYYDDMM ? 4 : 2);
+		const int w2 = 6 - w0;
+		const int o1 = w0 + 1;
+		const int o2 = o1 + 3;
+		size_t valid = 0;
+		for (size_t i = 0; i < _count; i++) {
+			const T * record = _buffer + i * _stride;
+			int a = ak::dateTimeConversion::readFixed(record, w0);
+			int b = ak::dateTimeConversion::readFixed(record + o1, 2);
+			int c = ak::dateTimeConversion::readFixed(record + o2, w2);
+			if ((a | b | c) >= 0 && record[w0] == _delimiter && record[o1 + 2] == _delimiter) {
+				_results[i] = dateFromFields(a, b, c, _dateFormat);
+				valid++;
+			}
+			else { _results[i] = ak::aDate(); }
+		}
+		return valid;
+	}
+
+	//! @brief Writes the date, the year is written with at least _yearWidth digits
+	template <class T> size_t formatDate(const ak::aDate & _date, T * _buffer, T _delimiter, ak::dateFormat _dateFormat, int _yearWidth = 1) {
+		int d{ 0 }, m{ 0 }, y{ 0 };
+		_date.get(d, m, y);
+		int v[3];
+		int w[3]{ 2, 2, _yearWidth };
+		switch (_dateFormat)
+		{
+		case ak::dfMMDDYYYY: v[0] = m; v[1] = d; v[2] = y; break;
+		case ak::dfYYYYMMDD: v[0] = y; v[1] = m; v[2] = d; w[0] = _yearWidth; w[2] = 2; break;
+		case ak::dfYYYYDDMM: v[0] = y; v[1] = d; v[2] = m; w[0] = _yearWidth; w[2] = 2; break;
+		default:
+			assert(_dateFormat == ak::dfDDMMYYYY);	// Unknown format
+			v[0] = d; v[1] = m; v[2] = y;
+			break;
+		}
+		size_t n = ak::dateTimeConversion::writeNumber(_buffer, v[0], w[0]);
+		_buffer[n++] = _delimiter;
+		n += ak::dateTimeConversion::writeNumber(_buffer + n, v[1], w[1]);
+		_buffer[n++] = _delimiter;
+		n += ak::dateTimeConversion::writeNumber(_buffer + n, v[2], w[2]);
+		return n;
+	}
+}
+
+#define ADATE_JULIAN_DAY_OF_EPOCH 2440588
 
 ak::aDate::aDate(const QDate & _other)
-	: m_d(_other.day()), m_m(_other.month()), m_y(_other.year())
+	: m_days(_other.isValid() ? static_cast<int>(_other.toJulianDay() - ADATE_JULIAN_DAY_OF_EPOCH) : daysFromCivil(1900, 1, 1))
 {}
 
-ak::aDate::aDate(const aDate & _other) 
-	: m_d(_other.m_d), m_m(_other.m_m), m_y(_other.m_y)
-{}
+std::string ak::aDate::toString(const std::string _delimiter, dateFormat _dateFormat) const {
+	if (_delimiter.length() == 1) {
+		char buffer[maxStringLength];
+		return std::string(buffer, formatDate(*this, buffer, _delimiter[0], _dateFormat));
+	}
 
-ak::aDate::~aDate() {}
+	int dv{ 0 }, mv{ 0 }, yv{ 0 };
+	get(dv, mv, yv);
 
-std::string ak::aDate::toString(const std::string _delimiter, dateFormat _dateFormat) const {
 	std::string d;
 	std::string m;
-	std::string y = std::to_string(m_y);
+	std::string y = std::to_string(yv);
 
-	if (m_d < 10) { d = "0" + std::to_string(m_d); }
-	else { d = std::to_string(m_d); }
+	if (dv < 10) { d = "0" + std::to_string(dv); }
+	else { d = std::to_string(dv); }
 
-	if (m_m < 10) { m = "0" + std::to_string(m_m); }
-	else { m = std::to_string(m_m); }
+	if (mv < 10) { m = "0" + std::to_string(mv); }
+	else { m = std::to_string(mv); }
 
 	std::string ret;
 
@@ -60,15 +140,23 @@ std::string ak::aDate::toString(const std::string _delimiter, dateFormat _dateFo
 }
 
 std::wstring ak::aDate::toWString(const std::wstring _delimiter, dateFormat _dateFormat) const {
+	if (_delimiter.length() == 1) {
+		wchar_t buffer[maxStringLength];
+		return std::wstring(buffer, formatDate(*this, buffer, _delimiter[0], _dateFormat));
+	}
+
+	int dv{ 0 }, mv{ 0 }, yv{ 0 };
+	get(dv, mv, yv);
+
 	std::wstring d;
 	std::wstring m;
-	std::wstring y = std::to_wstring(m_y);
+	std::wstring y = std::to_wstring(yv);
 
-	if (m_d < 10) { d = L"0" + std::to_wstring(m_d); }
-	else { d = std::to_wstring(m_d); }
+	if (dv < 10) { d = L"0" + std::to_wstring(dv); }
+	else { d = std::to_wstring(dv); }
 
-	if (m_m < 10) { m = L"0" + std::to_wstring(m_m); }
-	else { m = std::to_wstring(m_m); }
+	if (mv < 10) { m = L"0" + std::to_wstring(mv); }
+	else { m = std::to_wstring(mv); }
 
 	std::wstring ret;
 
@@ -87,15 +175,24 @@ std::wstring ak::aDate::toWString(const std::wstring _delimiter, dateFormat _dat
 }
 
 QString ak::aDate::toQString(const QString _delimiter, dateFormat _dateFormat) const {
+	if (_delimiter.length() == 1) {
+		char16_t buffer[maxStringLength];
+		size_t n = formatDate(*this, buffer, static_cast<char16_t>(_delimiter[0].unicode()), _dateFormat);
+		return QString(reinterpret_cast<const QChar *>(buffer), static_cast<int>(n));
+	}
+
+	int dv{ 0 }, mv{ 0 }, yv{ 0 };
+	get(dv, mv, yv);
+
 	QString d;
 	QString m;
-	QString y = QString::number(m_y);
+	QString y = QString::number(yv);
 
-	if (m_d < 10) { d = "0" + QString::number(m_d); }
-	else { d = QString::number(m_d); }
+	if (dv < 10) { d = "0" + QString::number(dv); }
+	else { d = QString::number(dv); }
 
-	if (m_m < 10) { m = "0" + QString::number(m_m); }
-	else { m = QString::number(m_m); }
+	if (mv < 10) { m = "0" + QString::number(mv); }
+	else { m = QString::number(mv); }
 
 	QString ret;
 
@@ -113,217 +210,130 @@ QString ak::aDate::toQString(const QString _delimiter, dateFormat _dateFormat) c
 	return ret;
 }
 
-QDate ak::aDate::toQDate(void) const { return QDate(m_y, m_m, m_d); }
+QDate ak::aDate::toQDate(void) const { return QDate::fromJulianDay(static_cast<qint64>(m_days) + ADATE_JULIAN_DAY_OF_EPOCH); }
 
-void ak::aDate::set(int _d, int _m, int _y) {
-	m_y = _y;
-	m_m = _m;
-	m_d = _d;
-}
-
-void ak::aDate::set(const QDate & _date) {
-	m_y = _date.year();
-	m_m = _date.month();
-	m_d = _date.day();
-}
+void ak::aDate::set(const QDate & _date) { *this = aDate(_date); }
 
 // ############################################################################################################
 
 // Static parser
 
+// The string overloads try the allocation free parser first and only split the string if it fails (e.g. empty parts or whitespace)
+
 ak::aDate ak::aDate::parseString(const char * _string, const char * _delimiter, dateFormat _dateFormat) {
-	return parseString(QString(_string), QString(_delimiter));
+	aDate ret;
+	if (_delimiter[0] != 0 && _delimiter[1] == 0 && parseDate(_string, std::strlen(_string), ret, _delimiter[0], _dateFormat)) { return ret; }
+	return parseString(QString(_string), QString(_delimiter), _dateFormat);
 }
 
 ak::aDate ak::aDate::parseString(const wchar_t * _string, const wchar_t * _delimiter, dateFormat _dateFormat) {
-	return parseString(QString::fromWCharArray(_string), QString::fromWCharArray(_delimiter));
+	aDate ret;
+	if (_delimiter[0] != 0 && _delimiter[1] == 0 && parseDate(_string, std::wcslen(_string), ret, _delimiter[0], _dateFormat)) { return ret; }
+	return parseString(QString::fromWCharArray(_string), QString::fromWCharArray(_delimiter), _dateFormat);
 }
 
 ak::aDate ak::aDate::parseString(const std::string & _string, const std::string & _delimiter, dateFormat _dateFormat) {
-	return parseString(QString(_string.c_str()), QString(_delimiter.c_str()));
+	aDate ret;
+	if (_delimiter.length() == 1 && parseDate(_string.c_str(), _string.length(), ret, _delimiter[0], _dateFormat)) { return ret; }
+	return parseString(QString(_string.c_str()), QString(_delimiter.c_str()), _dateFormat);
 }
 
 ak::aDate ak::aDate::parseString(const std::wstring & _string, const std::wstring & _delimiter, dateFormat _dateFormat) {
-	return parseString(QString::fromStdWString(_string), QString::fromStdWString(_delimiter));
+	aDate ret;
+	if (_delimiter.length() == 1 && parseDate(_string.c_str(), _string.length(), ret, _delimiter[0], _dateFormat)) { return ret; }
+	return parseString(QString::fromStdWString(_string), QString::fromStdWString(_delimiter), _dateFormat);
 }
 
 ak::aDate ak::aDate::parseString(const QString & _string, const QString & _delimiter, dateFormat _dateFormat) {
+	aDate ret;
+	if (_delimiter.length() == 1 && parseDate(reinterpret_cast<const char16_t *>(_string.utf16()), static_cast<size_t>(_string.length()), ret,
+		static_cast<char16_t>(_delimiter[0].unicode()), _dateFormat)) {
+		return ret;
+	}
+
 	QStringList lst{ _string.split(_delimiter, QString::SkipEmptyParts) };
 	if (lst.length() != 3) {
 		assert(0);
 		return aDate();
 	}
 
-	switch (_dateFormat)
-	{
-	case ak::dfDDMMYYYY: return aDate(lst[0].toInt(), lst[1].toInt(), lst[2].toInt());
-	case ak::dfMMDDYYYY: return aDate(lst[1].toInt(), lst[0].toInt(), lst[2].toInt());
-	case ak::dfYYYYMMDD: return aDate(lst[2].toInt(), lst[1].toInt(), lst[0].toInt());
-	case ak::dfYYYYDDMM: return aDate(lst[2].toInt(), lst[0].toInt(), lst[1].toInt());
-	default:
-		assert(0);
-		return aDate();
-	}
+	return dateFromFields(lst[0].toInt(), lst[1].toInt(), lst[2].toInt(), _dateFormat);
 }
 
 // ############################################################################################################
 
-// Operators
+// Allocation free conversion
 
-ak::aDate & ak::aDate::operator = (const aDate & _other) {
-	m_y = _other.m_y;
-	m_m = _other.m_m;
-	m_d = _other.m_d;
-	return *this;
+size_t ak::aDate::format(char * _buffer, char _delimiter, dateFormat _dateFormat) const {
+	return formatDate(*this, _buffer, _delimiter, _dateFormat);
 }
 
-ak::aDate & ak::aDate::operator = (const QDate & _other) {
-	m_y = _other.year();
-	m_m = _other.month();
-	m_d = _other.day();
-	return *this;
+size_t ak::aDate::format(char16_t * _buffer, char16_t _delimiter, dateFormat _dateFormat) const {
+	return formatDate(*this, _buffer, _delimiter, _dateFormat);
 }
 
-bool ak::operator == (const aDate & _lhv, const aDate & _rhv) {
-	return _lhv.year() == _rhv.year() && _lhv.month() == _rhv.month() && _lhv.day() == _rhv.day();
-}
-bool ak::operator == (const aDate & _lhv, const QDate & _rhv) {
-	return _lhv.year() == _rhv.year() && _lhv.month() == _rhv.month() && _lhv.day() == _rhv.day();
-}
-bool ak::operator == (const QDate & _lhv, const aDate & _rhv) {
-	return _lhv.year() == _rhv.year() && _lhv.month() == _rhv.month() && _lhv.day() == _rhv.day();
+bool ak::aDate::parse(const char * _string, size_t _length, aDate & _result, char _delimiter, dateFormat _dateFormat) {
+	return parseDate(_string, _length, _result, _delimiter, _dateFormat);
 }
 
-bool ak::operator != (const aDate & _lhv, const aDate & _rhv) {
-	return _lhv.year() != _rhv.year() || _lhv.month() != _rhv.month() || _lhv.day() != _rhv.day();
-}
-bool ak::operator != (const aDate & _lhv, const QDate & _rhv) {
-	return _lhv.year() != _rhv.year() || _lhv.month() != _rhv.month() || _lhv.day() != _rhv.day();
-}
-bool ak::operator != (const QDate & _lhv, const aDate & _rhv) {
-	return _lhv.year() != _rhv.year() || _lhv.month() != _rhv.month() || _lhv.day() != _rhv.day();
+bool ak::aDate::parse(const char16_t * _string, size_t _length, aDate & _result, char16_t _delimiter, dateFormat _dateFormat) {
+	return parseDate(_string, _length, _result, _delimiter, _dateFormat);
 }
 
-bool ak::operator < (const aDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() < _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() < _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() < _rhv.day()) { return true; }
-		}
-	}
-	return false;
-}
-bool ak::operator < (const aDate & _lhv, const QDate & _rhv) {
-	if (_lhv.year() < _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() < _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() < _rhv.day()) { return true; }
-		}
+size_t ak::aDate::parseBatch(const char * const * _strings, const size_t * _lengths, size_t _count, aDate * _results, char _delimiter, dateFormat _dateFormat) {
+	size_t valid = 0;
+	for (size_t i = 0; i < _count; i++) {
+		if (parseDate(_strings[i], _lengths[i], _results[i], _delimiter, _dateFormat)) { valid++; }
+		else { _results[i] = aDate(); }
 	}
-	return false;
-}
-bool ak::operator < (const QDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() < _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() < _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() < _rhv.day()) { return true; }
-		}
-	}
-	return false;
+	return valid;
 }
 
-bool ak::operator > (const aDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() > _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() > _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() > _rhv.day()) { return true; }
-		}
-	}
-	return false;
-}
-bool ak::operator > (const aDate & _lhv, const QDate & _rhv) {
-	if (_lhv.year() > _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() > _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() > _rhv.day()) { return true; }
-		}
-	}
-	return false;
-}
-bool ak::operator > (const QDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() > _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() > _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() > _rhv.day()) { return true; }
-		}
-	}
-	return false;
+size_t ak::aDate::parseFixedBatch(const char * _buffer, size_t _stride, size_t _count, aDate * _results, char _delimiter, dateFormat _dateFormat) {
+	return parseFixedDates(_buffer, _stride, _count, _results, _delimiter, _dateFormat);
 }
 
-bool ak::operator <= (const aDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() < _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() < _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() <= _rhv.day()) { return true; }
-		}
-	}
-	return false;
-}
-bool ak::operator <= (const aDate & _lhv, const QDate & _rhv) {
-	if (_lhv.year() < _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() < _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() <= _rhv.day()) { return true; }
-		}
-	}
-	return false;
-}
-bool ak::operator <= (const QDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() < _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() < _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() <= _rhv.day()) { return true; }
-		}
-	}
-	return false;
+size_t ak::aDate::parseFixedBatch(const char16_t * _buffer, size_t _stride, size_t _count, aDate * _results, char16_t _delimiter, dateFormat _dateFormat) {
+	return parseFixedDates(_buffer, _stride, _count, _results, _delimiter, _dateFormat);
 }
 
-bool ak::operator >= (const aDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() > _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() > _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() >= _rhv.day()) { return true; }
+void ak::aDate::formatBatch(const aDate * _dates, size_t _count, char * _buffer, size_t _stride, char _delimiter, dateFormat _dateFormat) {
+	for (size_t i = 0; i < _count; i++) {
+		char * record = _buffer + i * _stride;
+		if (_stride >= maxStringLength) { formatDate(_dates[i], record, _delimiter, _dateFormat, 4); }
+		else {
+			// The record may be too short for dates outside the four digit year range
+			char buffer[maxStringLength];
+			size_t n = formatDate(_dates[i], buffer, _delimiter, _dateFormat, 4);
+			assert(n <= _stride);	// Record too short
+			std::memcpy(record, buffer, (n < _stride ? n : _stride));
 		}
 	}
-	return false;
 }
-bool ak::operator >= (const aDate & _lhv, const QDate & _rhv) {
-	if (_lhv.year() > _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() > _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() >= _rhv.day()) { return true; }
-		}
-	}
-	return false;
+
+// ############################################################################################################
+
+// Operators
+
+ak::aDate & ak::aDate::operator = (const QDate & _other) {
+	*this = aDate(_other);
+	return *this;
 }
-bool ak::operator >= (const QDate & _lhv, const aDate & _rhv) {
-	if (_lhv.year() > _rhv.year()) { return true; }
-	else if (_lhv.year() == _rhv.year()) {
-		if (_lhv.month() > _rhv.month()) { return true; }
-		else if (_lhv.month() == _rhv.month()) {
-			if (_lhv.day() >= _rhv.day()) { return true; }
-		}
-	}
-	return false;
-}
\ No newline at end of file
+
+bool ak::operator == (const aDate & _lhv, const QDate & _rhv) { return _lhv == aDate(_rhv); }
+bool ak::operator == (const QDate & _lhv, const aDate & _rhv) { return aDate(_lhv) == _rhv; }
+
+bool ak::operator != (const aDate & _lhv, const QDate & _rhv) { return _lhv != aDate(_rhv); }
+bool ak::operator != (const QDate & _lhv, const aDate & _rhv) { return aDate(_lhv) != _rhv; }
+
+bool ak::operator < (const aDate & _lhv, const QDate & _rhv) { return _lhv < aDate(_rhv); }
+bool ak::operator < (const QDate & _lhv, const aDate & _rhv) { return aDate(_lhv) < _rhv; }
+
+bool ak::operator > (const aDate & _lhv, const QDate & _rhv) { return _lhv > aDate(_rhv); }
+bool ak::operator > (const QDate & _lhv, const aDate & _rhv) { return aDate(_lhv) > _rhv; }
+
+bool ak::operator <= (const aDate & _lhv, const QDate & _rhv) { return _lhv <= aDate(_rhv); }
+bool ak::operator <= (const QDate & _lhv, const aDate & _rhv) { return aDate(_lhv) <= _rhv; }
+
+bool ak::operator >= (const aDate & _lhv, const QDate & _rhv) { return _lhv >= aDate(_rhv); }
+bool ak::operator >= (const QDate & _lhv, const aDate & _rhv) { return aDate(_lhv) >= _rhv; }
@@ -1,45 +1,14 @@
 #include <akCore/aDateHelper.h>
+#include <akCore/aTime.h>
 
 QTime ak::aDateHelper::addSeconds(const QTime & _orig, int _sec, bool & _overflow) {
 	int h = _orig.hour();
 	int m = _orig.minute();
-	int s = _orig.second();
+	int s = _orig.second() + _sec;
 	int ms = _orig.msec();
 
-	_overflow = false;
-
-	s += _sec;
-
-	while (s < 0) {
-		s += 60;
-		m--;
-	}
-	while (s > 59) {
-		s -= 60;
-		m++;
-	}
-
-	while (m < 0) {
-		m += 60;
-		h--;
-	}
-	while (m > 59) {
-		m -= 60;
-		h++;
-	}
-
-	while (h < 0) {
-		_overflow = true;
-		h += 24;
-	}
-	
-	while (h > 23) {
-		_overflow = true;
-		h -= 24;
-	}
-
+	_overflow = aTime::adjustValues(h, m, s, ms);
 	return QTime(h, m, s, ms);
-
 }
 
 QTime ak::aDateHelper::addTime(const QTime & _orig, int _h, int _m, int _s, bool & _overflow) {
@@ -47,46 +16,12 @@ QTime ak::aDateHelper::addTime(const QTime & _orig, int _h, int _m, int _s, bool
 }
 
 QTime ak::aDateHelper::addTime(const QTime & _orig, int _h, int _m, int _s, int _ms, bool & _overflow) {
-	int h = _orig.hour();
-	int m = _orig.minute();
-	int s = _orig.second();
-	int ms = _orig.msec();
-
-	_overflow = false;
-
-	ms += _ms;
-	s += _s;
-	m += _m;
-	h += _h;
-
-	while (s < 0) {
-		s += 60;
-		m--;
-	}
-	while (s > 59) {
-		s -= 60;
-		m++;
-	}
-
-	while (m < 0) {
-		m += 60;
-		h--;
-	}
-	while (m > 59) {
-		m -= 60;
-		h++;
-	}
-
-	while (h < 0) {
-		_overflow = true;
-		h += 24;
-	}
-
-	while (h > 23) {
-		_overflow = true;
-		h -= 24;
-	}
+	int h = _orig.hour() + _h;
+	int m = _orig.minute() + _m;
+	int s = _orig.second() + _s;
+	int ms = _orig.msec() + _ms;
 
+	_overflow = aTime::adjustValues(h, m, s, ms);
 	return QTime(h, m, s, ms);
 }
 
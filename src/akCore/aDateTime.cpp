@@ -0,0 +1,32 @@
+/*
+ *	File:		aDateTime.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// uiCore header
+#include <akCore/aDateTime.h>
+
+ak::aDateTime::aDateTime(const QDateTime & _dateTime)
+	: aDateTime(aDate(_dateTime.date()), aTime(_dateTime.time()))
+{}
+
+QDateTime ak::aDateTime::toQDateTime(void) const { return QDateTime(date().toQDate(), time().toQTime()); }
+
+std::string ak::aDateTime::toString(const std::string & _separator, const std::string & _dateDelimiter, const std::string & _timeDelimiter,
+	dateFormat _dateFormat, timeFormat _timeFormat) const
+{
+	return date().toString(_dateDelimiter, _dateFormat) + _separator + time().toString(_timeDelimiter, _timeFormat);
+}
+
+QString ak::aDateTime::toQString(const QString & _separator, const QString & _dateDelimiter, const QString & _timeDelimiter,
+	dateFormat _dateFormat, timeFormat _timeFormat) const
+{
+	return date().toQString(_dateDelimiter, _dateFormat) + _separator + time().toQString(_timeDelimiter, _timeFormat);
+}
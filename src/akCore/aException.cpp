@@ -13,74 +13,113 @@
 // AK header
 #include <akCore/aException.h>
 
+// C++ header
+#include <vector>
+
 ak::aException::aException()
-{
-	m_where = "exception_where";
-	m_what = "exception_what";
-	m_out = "ex : exception";
-	m_type = Undefined;
-}
+	: m_what("exception_what"), m_where(std::make_shared<const whereFrame>(whereFrame{ "exception_where", std::string(), nullptr })),
+	m_type(Undefined), m_isDefault(true), m_outIsBuilt(new std::once_flag)
+{}
 
 ak::aException::aException(
 	const char *	 				_exWhat,
 	const char *				 	_exWhere,
 	ak::aException::exceptionType				_exType
-) : m_what(_exWhat), m_where(_exWhere), m_type(_exType) { buildOut(); }
+) : m_what(_exWhat), m_where(std::make_shared<const whereFrame>(whereFrame{ nullptr, _exWhere, nullptr })),
+	m_type(_exType), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
 
 
 ak::aException::aException(
 	const std::string &				_exWhat,
 	const char *					_exWhere,
 	exceptionType					_exType
-) : m_what(_exWhat), m_where(_exWhere), m_type(_exType) { buildOut(); }
+) : m_what(_exWhat), m_where(std::make_shared<const whereFrame>(whereFrame{ nullptr, _exWhere, nullptr })),
+	m_type(_exType), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
 
 ak::aException::aException(
 	const std::string &				_exWhat,
 	const std::string &				_exWhere,
 	exceptionType					_exType
-) : m_what(_exWhat), m_where(_exWhere), m_type(_exType) { buildOut(); }
+) : m_what(_exWhat), m_where(std::make_shared<const whereFrame>(whereFrame{ nullptr, _exWhere, nullptr })),
+	m_type(_exType), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
 
 ak::aException::aException(
 	const char *					_exWhat,
 	const std::string &				_exWhere,
 	exceptionType					_exType
-) : m_what(_exWhat), m_where(_exWhere), m_type(_exType) { buildOut(); }
+) : m_what(_exWhat), m_where(std::make_shared<const whereFrame>(whereFrame{ nullptr, _exWhere, nullptr })),
+	m_type(_exType), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
+
+ak::aException::aException(
+	const char *					_exWhat,
+	literalLocation					_exWhere,
+	exceptionType					_exType
+) : m_what(_exWhat), m_where(std::make_shared<const whereFrame>(whereFrame{ _exWhere.text, std::string(), nullptr })),
+	m_type(_exType), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
 
 ak::aException::aException(
 	const ak::aException &			_other
-) : m_what(_other.getWhat()),
-	m_where(_other.getWhere()),
-	m_type(_other.getType())
-{
-	buildOut();
-	m_type = _other.getType();
-}
+) : std::exception(_other), m_what(_other.m_what), m_where(_other.m_where), m_type(_other.m_type),
+	m_isDefault(_other.m_isDefault), m_outIsBuilt(new std::once_flag) {}
 
 ak::aException::aException(
 	const ak::aException & 			_other,
 	const char * 					_exWhere
-) : m_what(_other.getWhat()),
-	m_where(_other.getWhere()),
-	m_type(_other.getType())
-{
-	m_where += AK_CSTR_NL "@ ";
-	m_where += _exWhere;
-	buildOut();
-	m_type = _other.getType();
+) : m_what(_other.m_what), m_where(std::make_shared<const whereFrame>(whereFrame{ nullptr, _exWhere, _other.m_where })),
+	m_type(_other.m_type), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
+
+ak::aException::aException(
+	const ak::aException & 			_other,
+	literalLocation					_exWhere
+) : m_what(_other.m_what), m_where(std::make_shared<const whereFrame>(whereFrame{ _exWhere.text, std::string(), _other.m_where })),
+	m_type(_other.m_type), m_isDefault(false), m_outIsBuilt(new std::once_flag) {}
+
+ak::aException & ak::aException::operator = (
+	const ak::aException &			_other
+) {
+	if (this == &_other) { return *this; }
+	std::exception::operator = (_other);
+	m_what = _other.m_what;
+	m_where = _other.m_where;
+	m_type = _other.m_type;
+	m_isDefault = _other.m_isDefault;
+	m_out.clear();
+	m_outIsBuilt.reset(new std::once_flag);
+	return *this;
 }
 
 ak::aException::~aException() throw() {}
 
-const char * ak::aException::what(void) const throw() { return m_out.c_str(); }
+const char * ak::aException::what(void) const throw() {
+	try { std::call_once(*m_outIsBuilt, [this] { buildOut(); }); }
+	catch (...) { return "ak::aException"; }
+	return m_out.c_str();
+}
 
 std::string ak::aException::getWhat(void) const { return m_what; }
 
-std::string ak::aException::getWhere(void) const {return m_where; }
+std::string ak::aException::getWhere(void) const {
+	// The chain starts at the outermost location, the text starts with the innermost
+	std::vector<const whereFrame *> frames;
+	for (const whereFrame * f = m_where.get(); f != nullptr; f = f->inner.get()) { frames.push_back(f); }
+
+	std::string where;
+	for (auto f = frames.rbegin(); f != frames.rend(); f++) {
+		if (f != frames.rbegin()) { where += AK_CSTR_NL "@ "; }
+		if ((*f)->location != nullptr) { where += (*f)->location; }
+		else { where += (*f)->ownedLocation; }
+	}
+	return where;
+}
 
 ak::aException::exceptionType ak::aException::getType(void) const { return m_type; }
 
-void ak::aException::buildOut(void) {
+void ak::aException::buildOut(void) const {
+	if (m_isDefault) {
+		m_out = "ex : exception";
+		return;
+	}
 	m_out = m_what;
 	m_out += AK_CSTR_NL "@ ";
-	m_out += m_where;
+	m_out += getWhere();
 }
@@ -34,13 +34,11 @@ void ak::aFile::setUid(
 void ak::aFile::load(
 	const QString &			_filePath
 ) {
-	try {
+	A_TRY {
 		if (_filePath.length() > 0) { setPath(_filePath); }
 		importFile();
 	}
-	catch (const aException & e) { throw aException(e, "ak::aFile::load()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aFile::load()"); }
-	catch (...) { throw aException("Unknown error", "ak::aFile::load()"); }
+	A_CATCH_FORWARD("ak::aFile::load()")
 }
 
 void ak::aFile::save(
@@ -111,7 +109,7 @@ void ak::aFile::rebuildPath() {
 }
 
 void ak::aFile::importFile() {
-	try {
+	A_TRY {
 		// Check file
 		QFile f(m_path);
 		if (!f.exists()) { assert(0); throw aException("The provided file deos not exist", "Check file"); }
@@ -124,15 +122,13 @@ void ak::aFile::importFile() {
 		while (!f.atEnd()) { QString line = f.readLine(); m_lines.push_back(line); }
 		f.close();
 	}
-	catch (const aException & e) { throw aException(e, "ak::aFile::importFile()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aFile::importFile()"); }
-	catch (...) { throw aException("Unknown error", "ak::aFile::importFile()"); }
+	A_CATCH_FORWARD("ak::aFile::importFile()")
 }
 
 void ak::aFile::exportFile(
 	bool					_append
 ) const {
-	try {
+	A_TRY {
 		QFile f(m_path);
 		if (_append) {
 			if (!f.open(QIODevice::OpenModeFlag::Append)) { assert(0); throw aException("Failed to open file", "Check file"); }
@@ -146,7 +142,5 @@ void ak::aFile::exportFile(
 		}
 		f.close();
 	}
-	catch (const aException & e) { throw aException(e, "ak::aFile::importFile()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aFile::importFile()"); }
-	catch (...) { throw aException("Unknown error", "ak::aFile::importFile()"); }
+	A_CATCH_FORWARD("ak::aFile::importFile()")
 }
\ No newline at end of file
@@ -0,0 +1,180 @@
+/*
+ *	File:		aHash.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akCore/aHash.h>
+
+// Qt header
+#include <qfile.h>
+#include <qrunnable.h>
+#include <qsemaphore.h>
+#include <qthreadpool.h>
+
+// C++ header
+#include <algorithm>
+#include <functional>
+
+#define HASH_MAX_BLOCK_SIZE (1 << 30)				// QCryptographicHash takes the length as int
+#define HASH_FILE_MAP_WINDOW (64ll * 1024 * 1024)	// Large files are mapped in windows to limit the address space used
+#define HASH_FILE_READ_BLOCK (1024 * 1024)
+#define HASH_PARALLEL_MIN_ITEMS 64					// Smaller string batches are not worth distributing
+
+namespace {
+
+	class hashTask : public QRunnable {
+	public:
+		hashTask(const std::function<void()> & _function) : m_function(_function) {}
+		virtual void run(void) override { m_function(); }
+	private:
+		std::function<void()>	m_function;
+	};
+
+	//! @brief The pool used for batch hashing. A separate pool is used so a batch started from a global pool thread can not starve itself
+	QThreadPool & hashThreadPool(void) {
+		static QThreadPool pool;
+		return pool;
+	}
+
+	//! @brief Will split the range [0, _count) into chunks and call the function for every chunk.
+	//! The calling thread works on the first chunk and returns after all chunks are processed
+	void parallelRanges(size_t _count, const std::function<void(size_t, size_t)> & _work) {
+		QThreadPool & pool = hashThreadPool();
+		size_t chunks = std::min<size_t>(_count, static_cast<size_t>(std::max(pool.maxThreadCount(), 1)) + 1);
+		if (chunks <= 1) { _work(0, _count); return; }
+
+		size_t chunkSize = (_count + chunks - 1) / chunks;
+		QSemaphore done;
+		int started = 0;
+		for (size_t begin = chunkSize; begin < _count; begin += chunkSize) {
+			size_t end = std::min(begin + chunkSize, _count);
+			pool.start(new hashTask([&_work, &done, begin, end]() { _work(begin, end); done.release(); }));
+			started++;
+		}
+		_work(0, chunkSize);
+		done.acquire(started);
+	}
+
+}
+
+ak::aHash::aHash(HashAlgorithm _algorithm)
+	: m_hash(toQCryptographicHashAlgorithm(_algorithm)), m_algorithm(_algorithm)
+{}
+
+ak::aHash::~aHash() {}
+
+void ak::aHash::reset(void) { m_hash.reset(); }
+
+void ak::aHash::addData(const char * _data, size_t _length) {
+	while (_length > 0) {
+		int block = static_cast<int>(std::min<size_t>(_length, HASH_MAX_BLOCK_SIZE));
+		m_hash.addData(_data, block);
+		_data += block;
+		_length -= block;
+	}
+}
+
+void ak::aHash::addData(const QByteArray & _data) { m_hash.addData(_data); }
+
+void ak::aHash::addData(const QString & _string) { m_hash.addData(_string.toUtf8()); }
+
+bool ak::aHash::addFile(const QString & _filePath) {
+	QFile file(_filePath);
+	if (!file.open(QIODevice::ReadOnly)) { return false; }
+
+	const qint64 size = file.size();
+	qint64 offset = 0;
+	while (offset < size) {
+		qint64 window = std::min(size - offset, HASH_FILE_MAP_WINDOW);
+		uchar * mapped = file.map(offset, window);
+		if (mapped == nullptr) { break; }
+		addData(reinterpret_cast<const char *>(mapped), static_cast<size_t>(window));
+		file.unmap(mapped);
+		offset += window;
+	}
+
+	// Read the remaining data if the file can not be mapped (e.g. sequential devices)
+	if (offset < size) {
+		if (!file.seek(offset)) { return false; }
+		QByteArray buffer;
+		buffer.resize(HASH_FILE_READ_BLOCK);
+		for (;;) {
+			qint64 read = file.read(buffer.data(), buffer.size());
+			if (read < 0) { return false; }
+			if (read == 0) { break; }
+			m_hash.addData(buffer.constData(), static_cast<int>(read));
+		}
+	}
+	return true;
+}
+
+QByteArray ak::aHash::result(void) const { return m_hash.result(); }
+
+QString ak::aHash::resultHex(void) const { return QString::fromLatin1(m_hash.result().toHex()); }
+
+// #######################################################################################################
+
+// Static functions
+
+QByteArray ak::aHash::hash(const char * _data, size_t _length, HashAlgorithm _algorithm) {
+	aHash h(_algorithm);
+	h.addData(_data, _length);
+	return h.result();
+}
+
+QString ak::aHash::hashHex(const QString & _string, HashAlgorithm _algorithm) {
+	return QString::fromLatin1(QCryptographicHash::hash(_string.toUtf8(), toQCryptographicHashAlgorithm(_algorithm)).toHex());
+}
+
+QString ak::aHash::hashFile(const QString & _filePath, HashAlgorithm _algorithm, bool * _ok) {
+	aHash h(_algorithm);
+	bool ok = h.addFile(_filePath);
+	if (_ok != nullptr) { *_ok = ok; }
+	return (ok ? h.resultHex() : QString());
+}
+
+std::vector<QString> ak::aHash::hashBatch(const QStringList & _strings, HashAlgorithm _algorithm) {
+	std::vector<QString> ret(static_cast<size_t>(_strings.size()));
+	auto work = [&_strings, &ret, _algorithm](size_t _begin, size_t _end) {
+		aHash h(_algorithm);
+		for (size_t i = _begin; i < _end; i++) {
+			h.reset();
+			h.addData(_strings.at(static_cast<int>(i)));
+			ret[i] = h.resultHex();
+		}
+	};
+	if (ret.size() < HASH_PARALLEL_MIN_ITEMS) { work(0, ret.size()); }
+	else { parallelRanges(ret.size(), work); }
+	return ret;
+}
+
+std::vector<QByteArray> ak::aHash::hashBatch(const std::vector<QByteArray> & _data, HashAlgorithm _algorithm) {
+	std::vector<QByteArray> ret(_data.size());
+	auto work = [&_data, &ret, _algorithm](size_t _begin, size_t _end) {
+		aHash h(_algorithm);
+		for (size_t i = _begin; i < _end; i++) {
+			h.reset();
+			h.addData(_data[i]);
+			ret[i] = h.result();
+		}
+	};
+	if (ret.size() < HASH_PARALLEL_MIN_ITEMS) { work(0, ret.size()); }
+	else { parallelRanges(ret.size(), work); }
+	return ret;
+}
+
+std::vector<QString> ak::aHash::hashFiles(const QStringList & _filePaths, HashAlgorithm _algorithm) {
+	std::vector<QString> ret(static_cast<size_t>(_filePaths.size()));
+	parallelRanges(ret.size(), [&_filePaths, &ret, _algorithm](size_t _begin, size_t _end) {
+		for (size_t i = _begin; i < _end; i++) { ret[i] = hashFile(_filePaths.at(static_cast<int>(i)), _algorithm); }
+	});
+	return ret;
+}
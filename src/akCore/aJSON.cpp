@@ -12,62 +12,95 @@
 
 #include <akCore/aJSON.h>
 
-#include <qstring.h>
-#include <qstringlist.h>
-
 #include <cassert>
+#include <cstring>
 
 ak::aJSON::aJSON(jsonType _type)
-	: m_type(_type), m_bool(false), m_double(0.0), m_int(0)
+	: aJSON(_type, nullptr)
 {}
 
+ak::aJSON::aJSON(jsonType _type, aJSONArena * _arena)
+	: m_arenaOwner((_arena == nullptr && (_type == Array || _type == Object)) ? std::make_shared<aJSONArena>() : nullptr),
+	m_arena(_arena ? _arena : m_arenaOwner.get()), m_type(_type), m_double(0.0), m_string(aJSONArenaAllocator<char>(m_arena))
+{
+	createContainer();
+}
+
 ak::aJSON::aJSON(bool _v)
-	: m_type(Boolean), m_bool(_v), m_double(0.0), m_int(0)
-{}
+	: m_arena(nullptr), m_type(Boolean), m_double(0.0)
+{
+	m_bool = _v;
+}
 
 ak::aJSON::aJSON(double _v)
-	: m_type(Double), m_bool(false), m_double(_v), m_int(0)
+	: m_arena(nullptr), m_type(Double), m_double(_v)
 {}
 
 ak::aJSON::aJSON(int _v)
-	: m_type(Integer), m_bool(false), m_double(_v), m_int(_v)
-{}
-
-ak::aJSON::aJSON(char _v)
-	: m_type(String), m_bool(false), m_double(0.0), m_int(0)
+	: m_arena(nullptr), m_type(Integer), m_double(0.0)
 {
-	char v[2]{ _v, 0 };
-	m_string = v;
+	m_int = _v;
 }
 
+ak::aJSON::aJSON(char _v)
+	: m_arena(nullptr), m_type(String), m_double(0.0), m_string(1, _v)
+{}
+
 ak::aJSON::aJSON(const char * _v)
-	: m_type(String), m_bool(false), m_double(0.0), m_int(0), m_string(_v)
+	: m_arena(nullptr), m_type(String), m_double(0.0), m_string(_v)
 {}
 
 ak::aJSON::aJSON(const std::string & _v)
-	: m_type(String), m_bool(false), m_double(0.0), m_int(0), m_string(_v)
+	: m_arena(nullptr), m_type(String), m_double(0.0), m_string(_v.data(), _v.size())
 {}
 
 ak::aJSON::aJSON(const aJSON & _other)
-	: m_type(_other.type()), m_bool(false), m_double(0.0), m_int(0)
+	: aJSON(_other, nullptr)
+{}
+
+ak::aJSON::aJSON(const aJSON & _other, aJSONArena * _arena)
+	: aJSON(_other.m_type, _arena)
 {
-	switch (m_type)
-	{
-	case ak::aJSON::Array: m_array = _other.m_array; break;
-	case ak::aJSON::Boolean: m_bool = _other.m_bool; break;
-	case ak::aJSON::Double: m_double = _other.m_double; break;
-	case ak::aJSON::Integer: m_int = _other.m_int; break;
-	case ak::aJSON::Null: break;
-	case ak::aJSON::Object: m_obj = _other.m_obj; break;
-	case ak::aJSON::String: m_string = _other.m_string; break;
-	default:
-		assert(0);
-		break;
-	}
+	copyContentsFrom(_other);
+}
+
+ak::aJSON::aJSON(aJSON && _other) noexcept
+	: m_arenaOwner(std::move(_other.m_arenaOwner)), m_arena(_other.m_arena), m_type(_other.m_type), m_double(0.0),
+	m_string(std::move(_other.m_string))
+{
+	takeValueFrom(_other);
 }
 
 ak::aJSON::~aJSON() {
+	destroyContainer();
+}
 
+ak::aJSON & ak::aJSON::operator = (const aJSON & _other) {
+	if (this == &_other) { return *this; }
+
+	// Items that belong to a document keep their arena, document roots and scalars get a new one
+	aJSON copy(_other, m_arenaOwner ? nullptr : m_arena);
+	return *this = std::move(copy);
+}
+
+ak::aJSON & ak::aJSON::operator = (aJSON && _other) {
+	if (this == &_other) { return *this; }
+
+	// An item of a document must not refer to the arena of another document
+	if (m_arena != nullptr && !m_arenaOwner && _other.m_arena != m_arena) {
+		return *this = static_cast<const aJSON &>(_other);
+	}
+
+	destroyContainer();
+
+	// The string is moved before the arena ownership changes hands, the current
+	// string buffer may be part of the arena that is released below
+	m_string = std::move(_other.m_string);
+	m_arenaOwner = std::move(_other.m_arenaOwner);
+	m_arena = _other.m_arena;
+	m_type = _other.m_type;
+	takeValueFrom(_other);
+	return *this;
 }
 
 // ########################################################################################
@@ -75,99 +108,127 @@ ak::aJSON::~aJSON() {
 // Setter
 
 void ak::aJSON::setString(char _v) {
-	char v[2]{ _v, 0 };
-	m_string = v;
+	if (m_type == String) { m_string.assign(1, _v); }
 }
 
 void ak::aJSON::reserve(size_t _size) {
 	if (m_type == Array) {
-		m_array.reserve(_size);
+		m_array->reserve(_size);
 	}
 }
 
 void ak::aJSON::pushBack(bool _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { emplaceBack(Boolean).m_bool = _v; }
 }
 
 void ak::aJSON::pushBack(int _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { emplaceBack(Integer).m_int = _v; }
 }
 
 void ak::aJSON::pushBack(double _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { emplaceBack(Double).m_double = _v; }
 }
 
 void ak::aJSON::pushBack(char _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { emplaceBack(String).m_string.assign(1, _v); }
 }
 
 void ak::aJSON::pushBack(const char * _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { emplaceBack(String).m_string.assign(_v); }
 }
 
 void ak::aJSON::pushBack(const std::string & _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { emplaceBack(String).m_string.assign(_v.data(), _v.size()); }
 }
 
 void ak::aJSON::pushBack(const aJSON & _v) {
-	if (m_type == Array) { m_array.push_back(aJSON(_v)); }
+	if (m_type == Array) { m_array->emplace_back(_v, m_arena); }
+}
+
+void ak::aJSON::pushBack(aJSON && _v) {
+	if (m_type != Array) { return; }
+	if (_v.m_arena == m_arena) { m_array->push_back(std::move(_v)); }
+	else { m_array->emplace_back(_v, m_arena); }
+}
+
+ak::aJSON & ak::aJSON::emplaceBack(jsonType _type) {
+	assert(m_type == Array);
+	m_array->emplace_back(_type, m_arena);
+	return m_array->back();
 }
 
 void ak::aJSON::addMember(const char * _member, bool _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), Boolean).m_bool = _v; }
 }
 
 void ak::aJSON::addMember(const char * _member, int _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), Integer).m_int = _v; }
 }
 
 void ak::aJSON::addMember(const char * _member, double _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), Double).m_double = _v; }
 }
 
 void ak::aJSON::addMember(const char * _member, char _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), String).m_string.assign(1, _v); }
 }
 
 void ak::aJSON::addMember(const char * _member, const char * _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), String).m_string.assign(_v); }
 }
 
 void ak::aJSON::addMember(const char * _member, const std::string & _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), String).m_string.assign(_v.data(), _v.size()); }
 }
 
 void ak::aJSON::addMember(const char * _member, const aJSON & _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(std::string(_member), aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member, strlen(_member), Null) = _v; }
+}
+
+void ak::aJSON::addMember(const char * _member, aJSON && _v) {
+	if (m_type == Object) { memberSlot(_member, strlen(_member), Null) = std::move(_v); }
 }
 
 void ak::aJSON::addMember(const std::string & _member, bool _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), Boolean).m_bool = _v; }
 }
 
 void ak::aJSON::addMember(const std::string & _member, int _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), Integer).m_int = _v; }
 }
 
 void ak::aJSON::addMember(const std::string & _member, double _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), Double).m_double = _v; }
 }
 
 void ak::aJSON::addMember(const std::string & _member, char _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), String).m_string.assign(1, _v); }
 }
 
 void ak::aJSON::addMember(const std::string & _member, const char * _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), String).m_string.assign(_v); }
 }
 
 void ak::aJSON::addMember(const std::string & _member, const std::string & _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), String).m_string.assign(_v.data(), _v.size()); }
 }
 
-
 void ak::aJSON::addMember(const std::string & _member, const aJSON & _v) {
-	if (m_type == Object) { m_obj.insert_or_assign(_member, aJSON(_v)); }
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), Null) = _v; }
+}
+
+void ak::aJSON::addMember(const std::string & _member, aJSON && _v) {
+	if (m_type == Object) { memberSlot(_member.data(), _member.size(), Null) = std::move(_v); }
+}
+
+ak::aJSON & ak::aJSON::emplaceMember(const char * _member, jsonType _type) {
+	assert(m_type == Object);
+	return memberSlot(_member, strlen(_member), _type);
+}
+
+ak::aJSON & ak::aJSON::emplaceMember(const std::string & _member, jsonType _type) {
+	assert(m_type == Object);
+	return memberSlot(_member.data(), _member.size(), _type);
 }
 
 // ########################################################################################
@@ -175,208 +236,256 @@ void ak::aJSON::addMember(const std::string & _member, const aJSON & _v) {
 // Getter
 
 std::string ak::aJSON::toMultilineString(void) const {
-	return toMultilineString("");
+	std::string ret;
+	writeMultilineTo(ret, 0);
+	return ret;
 }
 
 std::string ak::aJSON::toString(void) const {
+	std::string ret;
+	writeTo(ret);
+	return ret;
+}
+
+bool ak::aJSON::hasMember(const std::string & _key) const {
+	return findMember(_key.data(), _key.size()) != nullptr;
+}
+
+ak::aJSON ak::aJSON::getMember(const std::string & _key) const {
+	const aJSON * member = findMember(_key.data(), _key.size());
+	if (member) { return *member; }
+	return aJSON(Null);
+}
+
+const ak::aJSON * ak::aJSON::findMember(const char * _key) const {
+	return findMember(_key, strlen(_key));
+}
+
+const ak::aJSON * ak::aJSON::findMember(const std::string & _key) const {
+	return findMember(_key.data(), _key.size());
+}
+
+ak::aJSON ak::aJSON::getAt(size_t _index) {
+	if (m_type != Array || _index >= m_array->size()) { return aJSON(Null); }
+	return (*m_array)[_index];
+}
+
+size_t ak::aJSON::size(void) const {
+	if (m_type == Array) { return m_array->size(); }
+	else if (m_type == Object) { return m_obj->size(); }
+	else { return 0; }
+}
+
+int ak::aJSON::compareKeys(const char * _lhv, size_t _lhvLength, const char * _rhv, size_t _rhvLength) {
+	int ret = memcmp(_lhv, _rhv, (_lhvLength < _rhvLength ? _lhvLength : _rhvLength));
+	if (ret != 0) { return ret; }
+	if (_lhvLength < _rhvLength) { return -1; }
+	else if (_lhvLength > _rhvLength) { return 1; }
+	else { return 0; }
+}
+
+// ########################################################################################
+
+// Private functions
+
+void ak::aJSON::createContainer(void) {
+	if (m_type == Array) {
+		void * mem = aJSONArenaAllocator<arrayType>(m_arena).allocate(1);
+		m_array = new (mem) arrayType(aJSONArenaAllocator<aJSON>(m_arena));
+	}
+	else if (m_type == Object) {
+		void * mem = aJSONArenaAllocator<objectType>(m_arena).allocate(1);
+		m_obj = new (mem) objectType(keyLess(), aJSONArenaAllocator<std::pair<const stringType, aJSON>>(m_arena));
+	}
+}
+
+void ak::aJSON::destroyContainer(void) {
+	if (m_type == Array) {
+		m_array->~arrayType();
+		aJSONArenaAllocator<arrayType>(m_arena).deallocate(m_array, 1);
+	}
+	else if (m_type == Object) {
+		m_obj->~objectType();
+		aJSONArenaAllocator<objectType>(m_arena).deallocate(m_obj, 1);
+	}
+	m_type = Null;
+}
+
+void ak::aJSON::copyContentsFrom(const aJSON & _other) {
+	assert(m_type == _other.m_type);
+	switch (m_type)
+	{
+	case ak::aJSON::Array:
+		m_array->reserve(_other.m_array->size());
+		for (const aJSON & itm : *_other.m_array) { m_array->emplace_back(itm, m_arena); }
+		break;
+	case ak::aJSON::Boolean: m_bool = _other.m_bool; break;
+	case ak::aJSON::Double: m_double = _other.m_double; break;
+	case ak::aJSON::Integer: m_int = _other.m_int; break;
+	case ak::aJSON::Null: break;
+	case ak::aJSON::Object:
+		for (const auto & itm : *_other.m_obj) {
+			m_obj->emplace_hint(m_obj->end(), std::piecewise_construct,
+				std::forward_as_tuple(itm.first.data(), itm.first.size(), aJSONArenaAllocator<char>(m_arena)),
+				std::forward_as_tuple(itm.second, m_arena));
+		}
+		break;
+	case ak::aJSON::String: m_string.assign(_other.m_string.data(), _other.m_string.size()); break;
+	default:
+		assert(0);
+		break;
+	}
+}
+
+void ak::aJSON::takeValueFrom(aJSON & _other) {
+	switch (m_type)
+	{
+	case ak::aJSON::Array: m_array = _other.m_array; break;
+	case ak::aJSON::Boolean: m_bool = _other.m_bool; break;
+	case ak::aJSON::Double: m_double = _other.m_double; break;
+	case ak::aJSON::Integer: m_int = _other.m_int; break;
+	case ak::aJSON::Object: m_obj = _other.m_obj; break;
+	case ak::aJSON::Null:
+	case ak::aJSON::String:
+	default:
+		break;
+	}
+
+	// The other item gave away its contents
+	_other.m_type = Null;
+	_other.m_arena = nullptr;
+	_other.m_double = 0.0;
+}
+
+ak::aJSON & ak::aJSON::memberSlot(const char * _member, size_t _memberLength, jsonType _type) {
+	keyRef key(_member, _memberLength);
+	auto it = m_obj->lower_bound(key);
+	if (it != m_obj->end() && compareKeys(it->first.data(), it->first.size(), _member, _memberLength) == 0) {
+		it->second = aJSON(_type, m_arena);
+		return it->second;
+	}
+	it = m_obj->emplace_hint(it, std::piecewise_construct,
+		std::forward_as_tuple(_member, _memberLength, aJSONArenaAllocator<char>(m_arena)),
+		std::forward_as_tuple(_type, m_arena));
+	return it->second;
+}
+
+const ak::aJSON * ak::aJSON::findMember(const char * _key, size_t _keyLength) const {
+	if (m_type != Object) { return nullptr; }
+	auto it = m_obj->find(keyRef(_key, _keyLength));
+	if (it == m_obj->end()) { return nullptr; }
+	return &it->second;
+}
+
+void ak::aJSON::writeTo(std::string & _out) const {
 	switch (m_type)
 	{
 	case ak::aJSON::Array:
 	{
-		std::string ret{ "[" };
+		_out.push_back('[');
 		bool first{ true };
-		for (auto itm : m_array) {
+		for (const aJSON & itm : *m_array) {
 			if (first) {
 				first = false;
 			}
 			else {
-				ret.append(", ");
+				_out.append(", ");
 			}
-			ret.append(itm.toString());
+			itm.writeTo(_out);
 		}
-		ret.append("]");
-		return ret;
+		_out.push_back(']');
 	}
 		break;
 	case ak::aJSON::Boolean:
-		if (m_bool) { return "true"; }
-		else { return "false"; }
-	case ak::aJSON::Double: return std::to_string(m_double);
-	case ak::aJSON::Integer: return std::to_string(m_int);
-	case ak::aJSON::Null: return "null";
+		if (m_bool) { _out.append("true"); }
+		else { _out.append("false"); }
+		break;
+	case ak::aJSON::Double: _out.append(std::to_string(m_double)); break;
+	case ak::aJSON::Integer: _out.append(std::to_string(m_int)); break;
+	case ak::aJSON::Null: _out.append("null"); break;
 	case ak::aJSON::Object:
 	{
-		std::string ret{ "{" };
+		_out.push_back('{');
 		bool first{ true };
-		for (auto itm : m_obj) {
+		for (const auto & itm : *m_obj) {
 			if (first) {
-				ret.append("\"");
+				_out.push_back('\"');
 				first = false;
 			}
 			else {
-				ret.append(", \"");
+				_out.append(", \"");
 			}
-			ret.append(itm.first).append("\": ").append(itm.second.toString());
+			_out.append(itm.first.data(), itm.first.size()).append("\": ");
+			itm.second.writeTo(_out);
 		}
-		ret.append("}");
-		return ret;
+		_out.push_back('}');
 	}
 		break;
-	case ak::aJSON::String: return "\"" + toValidStringItem(m_string) + "\"";
+	case ak::aJSON::String: writeEscapedString(_out, m_string); break;
 	default:
 		assert(0);
 	}
-	return "";
-}
-
-bool ak::aJSON::hasMember(const std::string & _key) const {
-	if (m_type != Object) { return false; }
-	auto it = m_obj.find(_key);
-	return it != m_obj.end();
-}
-
-ak::aJSON ak::aJSON::getMember(const std::string & _key) const {
-	if (m_type != Object) { return aJSON(Null); }
-	auto it = m_obj.find(_key);
-	if (it != m_obj.end()) {
-		return it->second;
-	}
-	return aJSON(Null);
-}
-
-ak::aJSON ak::aJSON::getAt(size_t _index) {
-	if (m_type != Array || _index < 0 || _index >= m_array.size()) { return aJSON(Null); }
-	return m_array[_index];
 }
 
-size_t ak::aJSON::size(void) const {
-	if (m_type == Array) { return m_array.size(); }
-	else if (m_type == Object) { return m_obj.size(); }
-	else { return 0; }
-}
-
-// ########################################################################################
-
-// Private functions
-
-std::string ak::aJSON::toMultilineString(const std::string & _prefix) const {
-
+void ak::aJSON::writeMultilineTo(std::string & _out, size_t _indent) const {
 	switch (m_type)
 	{
 	case ak::aJSON::Array:
 	{
-		std::string ret{ "[" };
+		_out.push_back('[');
 		bool first{ true };
 
-		for (auto it : m_array) {
+		for (const aJSON & itm : *m_array) {
 			if (first) {
-				ret.append("\n"); first = false;
+				_out.push_back('\n'); first = false;
 			}
 			else {
-				ret.append(",\n");
+				_out.append(",\n");
 			}
-			ret.append(_prefix).append("\t");
-			ret.append(it.toMultilineString(_prefix + "\t"));
+			_out.append(_indent + 1, '\t');
+			itm.writeMultilineTo(_out, _indent + 1);
 		}
-		ret.append("\n").append(_prefix).append("]");
-		return ret;
+		_out.push_back('\n');
+		_out.append(_indent, '\t').push_back(']');
 	}
-	case ak::aJSON::Boolean:
-		if (m_bool) { return "true"; }
-		else { return "false"; }
-	case ak::aJSON::Double: return std::to_string(m_double);
-	case ak::aJSON::Integer: return std::to_string(m_int);
+		break;
 	case ak::aJSON::Object:
 	{
-		std::string ret{ "{" };
+		_out.push_back('{');
 		bool first{ true };
 
-		for (auto it : m_obj) {
+		for (const auto & itm : *m_obj) {
 			if (first) {
-				ret.append("\n"); first = false;
+				_out.push_back('\n'); first = false;
 			}
 			else {
-				ret.append(",\n");
+				_out.append(",\n");
 			}
-			ret.append(_prefix).append("\t\"");
-			ret.append(it.first).append("\": ");
-			ret.append(it.second.toMultilineString(_prefix + "\t"));
+			_out.append(_indent + 1, '\t').push_back('\"');
+			_out.append(itm.first.data(), itm.first.size()).append("\": ");
+			itm.second.writeMultilineTo(_out, _indent + 1);
 		}
-		ret.append("\n").append(_prefix).append("}");
-		return ret;
+		_out.push_back('\n');
+		_out.append(_indent, '\t').push_back('}');
 	}
-	case ak::aJSON::String: return "\"" + toValidStringItem(m_string) + "\"";
-	case ak::aJSON::Null:
-	default: return "null";
+		break;
+	default: writeTo(_out); break;
 	}
 }
 
-std::string ak::aJSON::toValidStringItem(const std::string & _orig) const{
-	QString str{ _orig.c_str() };
-	QString ret;
-	QStringList splitted = str.split('\\', QString::KeepEmptyParts);
-	bool first{ true };
-	for (auto s : splitted) {
-		if (first) {
-			first = false;
-		}
-		else {
-			ret.append("\\\\");
-		}
-		ret.append(s);
-	}
-	
-	str.clear();
-	splitted = ret.split('\t', QString::KeepEmptyParts);
-	first = true;
-	for (auto s : splitted) {
-		if (first) {
-			first = false;
-		}
-		else {
-			str.append("\\t");
-		}
-		str.append(s);
-	}
-
-	ret.clear();
-	splitted = str.split('\n', QString::KeepEmptyParts);
-	first = true;
-	for (auto s : splitted) {
-		if (first) {
-			first = false;
-		}
-		else {
-			ret.append("\\n");
+void ak::aJSON::writeEscapedString(std::string & _out, const stringType & _str) {
+	_out.reserve(_out.size() + _str.size() + 2);
+	_out.push_back('\"');
+	for (char c : _str) {
+		switch (c)
+		{
+		case '\\': _out.append("\\\\"); break;
+		case '\t': _out.append("\\t"); break;
+		case '\n': _out.append("\\n"); break;
+		case '\r': _out.append("\\r"); break;
+		case '\"': _out.append("\\\""); break;
+		default: _out.push_back(c); break;
 		}
-		ret.append(s);
 	}
-
-	str.clear();
-	splitted = ret.split('\r', QString::KeepEmptyParts);
-	first = true;
-	for (auto s : splitted) {
-		if (first) {
-			first = false;
-		}
-		else {
-			str.append("\\r");
-		}
-		str.append(s);
-	}
-
-	ret.clear();
-	splitted = str.split('\"', QString::KeepEmptyParts);
-	first = true;
-	for (auto s : splitted) {
-		if (first) {
-			first = false;
-		}
-		else {
-			ret.append("\\\"");
-		}
-		ret.append(s);
-	}
-
-	return ret.toStdString();
-}
\ No newline at end of file
+	_out.push_back('\"');
+}
@@ -0,0 +1,80 @@
+/*
+ *	File:		aJSONArena.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#include <akCore/aJSONArena.h>
+
+#include <cstdint>
+
+ak::aJSONArena::aJSONArena(size_t _blockSize)
+	: m_head(nullptr), m_blockSize(_blockSize), m_usedBytes(0), m_reservedBytes(0)
+{}
+
+ak::aJSONArena::~aJSONArena() {
+	while (m_head) {
+		block * next = m_head->next;
+		::operator delete(m_head);
+		m_head = next;
+	}
+}
+
+void * ak::aJSONArena::allocate(size_t _size, size_t _alignment) {
+	if (_alignment == 0) { _alignment = 1; }
+
+	// Chunks larger than a quarter block get a block of their own which is linked behind the
+	// current head, this way the remaining space of the head block stays available
+	if (_size > m_blockSize / 4) {
+		block * b = createBlock(_size + _alignment);
+		if (m_head) {
+			b->next = m_head->next;
+			m_head->next = b;
+		}
+		else {
+			m_head = b;
+		}
+		char * base = reinterpret_cast<char *>(b + 1);
+		uintptr_t aligned = (reinterpret_cast<uintptr_t>(base) + _alignment - 1) & ~static_cast<uintptr_t>(_alignment - 1);
+		b->used = b->size;
+		m_usedBytes += _size;
+		return reinterpret_cast<void *>(aligned);
+	}
+
+	for (int attempt = 0; attempt < 2; attempt++) {
+		if (m_head) {
+			char * base = reinterpret_cast<char *>(m_head + 1);
+			uintptr_t current = reinterpret_cast<uintptr_t>(base) + m_head->used;
+			uintptr_t aligned = (current + _alignment - 1) & ~static_cast<uintptr_t>(_alignment - 1);
+			size_t newUsed = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(base)) + _size;
+			if (newUsed <= m_head->size) {
+				m_head->used = newUsed;
+				m_usedBytes += _size;
+				return reinterpret_cast<void *>(aligned);
+			}
+		}
+		block * b = createBlock(m_blockSize);
+		b->next = m_head;
+		m_head = b;
+	}
+	throw std::bad_alloc();
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+ak::aJSONArena::block * ak::aJSONArena::createBlock(size_t _size) {
+	block * b = static_cast<block *>(::operator new(sizeof(block) + _size));
+	b->next = nullptr;
+	b->size = _size;
+	b->used = 0;
+	m_reservedBytes += _size;
+	return b;
+}
@@ -32,7 +32,7 @@ void ak::aMessenger::sendMessage(
 	int						_info2
 ) {
 	if (!m_isEnabled) { return; }
-	try {
+	A_TRY {
 		// Find recievers for the senders UID
 		auto uidItem = m_uidReceivers.find(_senderId);
 		if (uidItem != m_uidReceivers.end()) {
@@ -56,9 +56,7 @@ void ak::aMessenger::sendMessage(
 		for (auto r : m_allMessageReceivers) { if (r->isEnabled()) { r->notify(_senderId, _event, _info1, _info2); } }
 
 	}
-	catch (const aException & e) { throw aException(e, "ak::aMessenger::sendMessage()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aMessenger::sendMessage()"); }
-	catch (...) { throw aException("Unknown error", "ak::aMessenger::sendMessage()"); }
+	A_CATCH_FORWARD("ak::aMessenger::sendMessage()")
 }
 
 // #############################################################################
@@ -68,7 +66,7 @@ void ak::aMessenger::registerUidReceiver(
 	UID					_senderId,
 	aNotifier *			_notifier
 ) {
-	try {
+	A_TRY {
 
 		if (_notifier == nullptr) { throw aException("Is nullptr", "Check notifier"); }
 
@@ -85,16 +83,14 @@ void ak::aMessenger::registerUidReceiver(
 			itm->second->push_back(_notifier);
 		}
 	}
-	catch (const aException & e) { throw aException(e, "ak::aMessenger::registerUidReceiver()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aMessenger::registerUidReceiver()"); }
-	catch (...) { throw aException("Unknown error", "ak::aMessenger::registerUidReceiver()"); }
+	A_CATCH_FORWARD("ak::aMessenger::registerUidReceiver()")
 }
 
 void ak::aMessenger::registerEventTypeReceiver(
 	eventType				_eventType,
 	aNotifier *					_notifier
 ) {
-	try {
+	A_TRY {
 
 		if (_notifier == nullptr) { throw aException("Is nullptr", "Check notifier"); }
 
@@ -110,21 +106,17 @@ void ak::aMessenger::registerEventTypeReceiver(
 		}
 		else { itm->second->push_back(_notifier); }
 	}
-	catch (const aException & e) { throw aException(e, "ak::aMessenger::registerEventTypeReceiver()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aMessenger::registerEventTypeReceiver()"); }
-	catch (...) { throw aException("Unknown error", "ak::aMessenger::registerEventTypeReceiver()"); }
+	A_CATCH_FORWARD("ak::aMessenger::registerEventTypeReceiver()")
 }
 
 void ak::aMessenger::registerNotifierForAllMessages(
 	aNotifier *					_notifier
 ) {
-	try {
+	A_TRY {
 		if (_notifier == nullptr) { throw aException("Is nullptr", "Check notifier"); }
 		m_allMessageReceivers.push_back(_notifier);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aMessenger::registerNotifierForAllMessages()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aMessenger::registerNotifierForAllMessages()"); }
-	catch (...) { throw aException("Unknown error", "ak::aMessenger::registerNotifierForAllMessages()"); }
+	A_CATCH_FORWARD("ak::aMessenger::registerNotifierForAllMessages()")
 }
 
 int ak::aMessenger::uidNotifierCount(
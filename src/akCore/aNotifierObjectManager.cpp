@@ -18,13 +18,11 @@
 ak::aNotifierObjectManager::aNotifierObjectManager(
 	aObjectManager *					_manager
 ) {
-	try {
+	A_TRY {
 		if (_manager == nullptr) { throw aException("Is nullptr", "Check manager", aException::exceptionType::Nullptr); }
 		m_manager = _manager;
 	}
-	catch (const aException & e) { throw aException(e, "aNotifierObjectManager::aNotifierObjectManager()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "aNotifierObjectManager::aNotifierObjectManager()"); }
-	catch (...) { throw aException("Unknown error", "aNotifierObjectManager::aNotifierObjectManager()"); }
+	A_CATCH_FORWARD("aNotifierObjectManager::aNotifierObjectManager()")
 }
 
 ak::aNotifierObjectManager::~aNotifierObjectManager(void) {}
@@ -39,13 +37,11 @@ void ak::aNotifierObjectManager::notify(
 	int							_info1,
 	int							_info2
 ) {
-	try {
+	A_TRY {
 		if (_event == etDestroyed) {
 			assert(isEnabled()); // Message received even if notifier was disabled
 			m_manager->creatorDestroyed(_senderId);
 		}
 	}
-	catch (const aException & e) { throw aException(e, "ak::notifierObjectManager::notify()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::notifierObjectManager::notify()"); }
-	catch (...) { throw aException("Unknown error", "ak::notifierObjectManager::notify()"); }
+	A_CATCH_FORWARD("ak::notifierObjectManager::notify()")
 }
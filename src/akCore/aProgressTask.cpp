@@ -0,0 +1,33 @@
+/*
+ *	File:		aProgressTask.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akCore/aProgressTask.h>
+
+ak::aProgressTask::aProgressTask(
+	const QString &			_label,
+	long long				_total
+) : m_progress(0), m_total(_total), m_isFinished(false), m_label(_label) {}
+
+ak::aProgressTask::~aProgressTask() {}
+
+void ak::aProgressTask::setLabel(
+	const QString &			_label
+) {
+	std::lock_guard<std::mutex> lock(m_labelMutex);
+	m_label = _label;
+}
+
+QString ak::aProgressTask::label(void) const {
+	std::lock_guard<std::mutex> lock(m_labelMutex);
+	return m_label;
+}
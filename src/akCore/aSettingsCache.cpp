@@ -0,0 +1,134 @@
+/*
+ *	File:		aSettingsCache.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akCore/aSettingsCache.h>
+#include <akCore/aMessenger.h>
+
+// Qt header
+#include <qsettings.h>
+#include <qstringlist.h>
+#include <qtimer.h>
+
+ak::aSettingsCache::aSettingsCache(
+	QSettings *				_settings,
+	aMessenger *			_messenger,
+	UID						_uid,
+	int						_flushInterval
+) : m_settings(_settings), m_messenger(_messenger), m_uid(_uid), m_timer(nullptr), m_flushInterval(_flushInterval)
+{
+	assert(m_settings != nullptr);	// nullptr provided
+
+	// Load all settings once
+	QStringList keys = m_settings->allKeys();
+	m_values.reserve(keys.count());
+	m_keyNames.reserve(keys.count());
+	for (auto key : keys) {
+		entry newEntry;
+		newEntry.value = m_settings->value(key);
+		newEntry.id = static_cast<int>(m_keyNames.size());
+		newEntry.dirty = false;
+		m_keyNames.push_back(key);
+		m_values.insert(key, newEntry);
+	}
+
+	m_timer = new QTimer;
+	m_timer->setSingleShot(true);
+	QObject::connect(m_timer, &QTimer::timeout, [this]() { flush(); });
+}
+
+ak::aSettingsCache::~aSettingsCache() {
+	flush();
+	delete m_timer;
+}
+
+// ###########################################################################################################################################
+
+// Data
+
+QVariant ak::aSettingsCache::value(
+	const QString &			_key,
+	const QVariant &		_defaultValue
+) const {
+	const QVariant * v = find(_key);
+	return (v == nullptr ? _defaultValue : *v);
+}
+
+void ak::aSettingsCache::setValue(
+	const QString &			_key,
+	const QVariant &		_value
+) {
+	auto itm = m_values.find(_key);
+	if (itm == m_values.end()) {
+		entry newEntry;
+		newEntry.value = _value;
+		newEntry.id = static_cast<int>(m_keyNames.size());
+		newEntry.dirty = false;
+		m_keyNames.push_back(_key);
+		itm = m_values.insert(_key, newEntry);
+	}
+	else if (itm->value == _value) { return; }
+	else { itm->value = _value; }
+
+	// Mark dirty
+	if (!itm->dirty) {
+		itm->dirty = true;
+		m_dirtyKeys.push_back(itm->id);
+	}
+	if (m_flushInterval > 0 && !m_timer->isActive()) { m_timer->start(m_flushInterval); }
+
+	if (m_messenger != nullptr) { m_messenger->sendMessage(m_uid, etChanged, itm->id); }
+}
+
+QString ak::aSettingsCache::keyName(
+	int						_keyId
+) const {
+	if (_keyId < 0 || _keyId >= static_cast<int>(m_keyNames.size())) { return QString(); }
+	return m_keyNames[_keyId];
+}
+
+// ###########################################################################################################################################
+
+// Persistence
+
+void ak::aSettingsCache::flush(void) {
+	m_timer->stop();
+	if (m_dirtyKeys.empty()) { return; }
+
+	for (int id : m_dirtyKeys) {
+		auto itm = m_values.find(m_keyNames[id]);
+		assert(itm != m_values.end());	// Key not stored
+		m_settings->setValue(itm.key(), itm->value);
+		itm->dirty = false;
+	}
+	m_dirtyKeys.clear();
+	m_settings->sync();
+}
+
+void ak::aSettingsCache::setFlushInterval(
+	int						_interval
+) {
+	m_flushInterval = _interval;
+	if (m_flushInterval <= 0) { m_timer->stop(); }
+	else if (!m_dirtyKeys.empty()) { m_timer->start(m_flushInterval); }
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+const QVariant * ak::aSettingsCache::find(
+	const QString &			_key
+) const {
+	auto itm = m_values.constFind(_key);
+	return (itm == m_values.constEnd() ? nullptr : &itm->value);
+}
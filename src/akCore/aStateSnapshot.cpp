@@ -0,0 +1,638 @@
+/*
+ *	File:		aStateSnapshot.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akCore/aStateSnapshot.h>
+
+// Rapid JSON header
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+// zlib header
+#define ZLIB_WINAPI
+#include <zlib.h>
+
+// C++ header
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#define SNAPSHOT_MAGIC "AKWS"
+#define SNAPSHOT_FORMAT_VERSION 1
+#define SNAPSHOT_FLAG_COMPRESSED 0x0001
+#define SNAPSHOT_MAX_DEPTH 256
+#define SNAPSHOT_MAX_PAYLOAD_SIZE 0x10000000
+#define SNAPSHOT_MAX_COMPRESSION_RATIO 1032
+
+#define SNAPSHOT_NAME_ALIAS "Alias"
+#define SNAPSHOT_NAME_TYPE "ObjectType"
+#define SNAPSHOT_NAME_SETTINGS "Settings"
+
+namespace {
+
+	//! Value tags of the binary settings encoding
+	enum valueTag : unsigned char {
+		tagNull,
+		tagFalse,
+		tagTrue,
+		tagInt,				//! zigzag varint
+		tagUint64,			//! varint
+		tagDouble,			//! 8 bytes
+		tagString,			//! varint length + bytes
+		tagArray,			//! u32 count + values
+		tagObject,			//! u32 count + (varint length + key + value)
+		tagInt8Array		//! u32 count + one byte per value
+	};
+
+	void putU16(std::string & _out, uint16_t _v) {
+		_out.push_back(static_cast<char>(_v & 0xFF));
+		_out.push_back(static_cast<char>((_v >> 8) & 0xFF));
+	}
+
+	void putU32(std::string & _out, uint32_t _v) {
+		for (int i = 0; i < 4; i++) { _out.push_back(static_cast<char>((_v >> (8 * i)) & 0xFF)); }
+	}
+
+	void putU64(std::string & _out, uint64_t _v) {
+		for (int i = 0; i < 8; i++) { _out.push_back(static_cast<char>((_v >> (8 * i)) & 0xFF)); }
+	}
+
+	void patchU32(std::string & _out, size_t _offset, uint32_t _v) {
+		for (int i = 0; i < 4; i++) { _out[_offset + i] = static_cast<char>((_v >> (8 * i)) & 0xFF); }
+	}
+
+	void putVarint(std::string & _out, uint64_t _v) {
+		while (_v >= 0x80) {
+			_out.push_back(static_cast<char>((_v & 0x7F) | 0x80));
+			_v >>= 7;
+		}
+		_out.push_back(static_cast<char>(_v));
+	}
+
+	void putString(std::string & _out, const std::string & _str) {
+		putU32(_out, static_cast<uint32_t>(_str.length()));
+		_out.append(_str);
+	}
+
+	uint64_t zigzag(int64_t _v) { return (static_cast<uint64_t>(_v) << 1) ^ static_cast<uint64_t>(_v >> 63); }
+
+	int64_t unzigzag(uint64_t _v) { return static_cast<int64_t>(_v >> 1) ^ -static_cast<int64_t>(_v & 1); }
+
+	//! Bounds checked little endian reader
+	struct cursor {
+		cursor(const char * _begin, const char * _end) : p(_begin), end(_end) {}
+
+		bool has(size_t _n) const { return static_cast<size_t>(end - p) >= _n; }
+
+		bool u16(uint16_t & _v) {
+			if (!has(2)) { return false; }
+			const unsigned char * b = reinterpret_cast<const unsigned char *>(p);
+			_v = static_cast<uint16_t>(b[0] | (b[1] << 8));
+			p += 2;
+			return true;
+		}
+
+		bool u32(uint32_t & _v) {
+			if (!has(4)) { return false; }
+			const unsigned char * b = reinterpret_cast<const unsigned char *>(p);
+			_v = 0;
+			for (int i = 0; i < 4; i++) { _v |= static_cast<uint32_t>(b[i]) << (8 * i); }
+			p += 4;
+			return true;
+		}
+
+		bool u64(uint64_t & _v) {
+			if (!has(8)) { return false; }
+			const unsigned char * b = reinterpret_cast<const unsigned char *>(p);
+			_v = 0;
+			for (int i = 0; i < 8; i++) { _v |= static_cast<uint64_t>(b[i]) << (8 * i); }
+			p += 8;
+			return true;
+		}
+
+		bool varint(uint64_t & _v) {
+			_v = 0;
+			for (int shift = 0; shift < 64; shift += 7) {
+				if (p >= end) { return false; }
+				unsigned char b = static_cast<unsigned char>(*p++);
+				_v |= static_cast<uint64_t>(b & 0x7F) << shift;
+				if ((b & 0x80) == 0) { return true; }
+			}
+			return false;
+		}
+
+		bool string(std::string & _str) {
+			uint32_t length;
+			if (!u32(length) || !has(length)) { return false; }
+			_str.assign(p, length);
+			p += length;
+			return true;
+		}
+
+		const char *	p;
+		const char *	end;
+	};
+
+	//! Reads entries ({ "Alias":..., "ObjectType":..., "Settings":... }) and encodes their settings.
+	//! The JSON may either be a single entry or an array of entries
+	struct entryEncoder {
+		enum memberTarget { tNone, tAlias, tType, tSettings };
+
+		struct parsedEntry {
+			std::string		alias;
+			std::string		type;
+			std::string		settings;
+			bool			hasSettings{ false };
+		};
+
+		entryEncoder() : encoder(current.settings), base(0), depth(0), target(tNone), inSettings(false), valid(true) {}
+
+		bool atEntry(void) const { return depth == base + 1; }
+		bool forwarding(void) const { return inSettings || (atEntry() && target == tSettings); }
+
+		template <class F> bool scalar(F _forward) {
+			if (!forwarding()) { target = tNone; return depth > 0; }
+			bool ok = _forward();
+			if (!inSettings) { current.hasSettings = true; target = tNone; }
+			return ok;
+		}
+
+		bool Null() { return scalar([this] { return encoder.Null(); }); }
+		bool Bool(bool _v) { return scalar([this, _v] { return encoder.Bool(_v); }); }
+		bool Int(int _v) { return scalar([this, _v] { return encoder.Int(_v); }); }
+		bool Uint(unsigned _v) { return scalar([this, _v] { return encoder.Uint(_v); }); }
+		bool Int64(int64_t _v) { return scalar([this, _v] { return encoder.Int64(_v); }); }
+		bool Uint64(uint64_t _v) { return scalar([this, _v] { return encoder.Uint64(_v); }); }
+		bool Double(double _v) { return scalar([this, _v] { return encoder.Double(_v); }); }
+		bool RawNumber(const char * _str, rapidjson::SizeType _length, bool _copy) { return String(_str, _length, _copy); }
+		bool String(const char * _str, rapidjson::SizeType _length, bool _copy) {
+			if (atEntry() && target == tAlias) { current.alias.assign(_str, _length); target = tNone; return true; }
+			if (atEntry() && target == tType) { current.type.assign(_str, _length); target = tNone; return true; }
+			return scalar([&] { return encoder.String(_str, _length, _copy); });
+		}
+		bool Key(const char * _str, rapidjson::SizeType _length, bool _copy) {
+			if (inSettings) { return encoder.Key(_str, _length, _copy); }
+			if (!atEntry()) { return true; }
+			std::string key(_str, _length);
+			if (key == SNAPSHOT_NAME_ALIAS) { target = tAlias; }
+			else if (key == SNAPSHOT_NAME_TYPE) { target = tType; }
+			else if (key == SNAPSHOT_NAME_SETTINGS) { target = tSettings; }
+			else { target = tNone; }
+			return true;
+		}
+		bool StartObject() {
+			if (depth == base) {
+				// A new entry starts
+				current = parsedEntry();
+				target = tNone;
+				depth++;
+				return true;
+			}
+			return startContainer([this] { return encoder.StartObject(); });
+		}
+		bool EndObject(rapidjson::SizeType _count) {
+			if (inSettings || depth != base + 1) { return endContainer([this, _count] { return encoder.EndObject(_count); }); }
+			depth--;
+			if (!current.hasSettings || current.alias.empty()) { valid = false; }
+			entries.push_back(std::move(current));
+			return true;
+		}
+		bool StartArray() {
+			if (depth == 0) {
+				base = 1;
+				depth++;
+				return true;
+			}
+			if (depth == base) { return false; }	// An entry must be an object
+			return startContainer([this] { return encoder.StartArray(); });
+		}
+		bool EndArray(rapidjson::SizeType _count) {
+			if (depth == 1 && base == 1) { depth--; return true; }
+			return endContainer([this, _count] { return encoder.EndArray(_count); });
+		}
+
+		template <class F> bool startContainer(F _forward) {
+			bool forward = forwarding();
+			if (forward) { inSettings = true; }
+			depth++;
+			return (forward ? _forward() : true);
+		}
+
+		template <class F> bool endContainer(F _forward) {
+			depth--;
+			if (!inSettings) { return true; }
+			bool ok = _forward();
+			if (atEntry()) {
+				inSettings = false;
+				current.hasSettings = true;
+				target = tNone;
+			}
+			return ok;
+		}
+
+		parsedEntry					current;
+		ak::aStateSnapshot::settingsWriter	encoder;
+		std::vector<parsedEntry>	entries;
+		int							base;			//! The depth of the entries (1 if the entries are in an array)
+		int							depth;
+		memberTarget				target;
+		bool						inSettings;
+		bool						valid;
+	};
+
+	//! Decodes a value in the binary settings encoding and forwards it as SAX events to the handler
+	template <class Handler> bool decodeValue(cursor & _c, Handler & _handler, int _depth) {
+		if (_depth > SNAPSHOT_MAX_DEPTH || !_c.has(1)) { return false; }
+		unsigned char tag = static_cast<unsigned char>(*_c.p++);
+		switch (tag)
+		{
+		case tagNull: return _handler.Null();
+		case tagFalse: return _handler.Bool(false);
+		case tagTrue: return _handler.Bool(true);
+		case tagInt:
+		{
+			uint64_t v;
+			return _c.varint(v) && _handler.Int64(unzigzag(v));
+		}
+		case tagUint64:
+		{
+			uint64_t v;
+			return _c.varint(v) && _handler.Uint64(v);
+		}
+		case tagDouble:
+		{
+			uint64_t bits;
+			if (!_c.u64(bits)) { return false; }
+			double v;
+			memcpy(&v, &bits, sizeof(v));
+			return _handler.Double(v);
+		}
+		case tagString:
+		{
+			uint64_t length;
+			if (!_c.varint(length) || !_c.has(length)) { return false; }
+			const char * str = _c.p;
+			_c.p += length;
+			return _handler.String(str, static_cast<rapidjson::SizeType>(length), true);
+		}
+		case tagArray:
+		{
+			uint32_t count;
+			if (!_c.u32(count) || !_handler.StartArray()) { return false; }
+			for (uint32_t i = 0; i < count; i++) {
+				if (!decodeValue(_c, _handler, _depth + 1)) { return false; }
+			}
+			return _handler.EndArray(count);
+		}
+		case tagObject:
+		{
+			uint32_t count;
+			if (!_c.u32(count) || !_handler.StartObject()) { return false; }
+			for (uint32_t i = 0; i < count; i++) {
+				uint64_t length;
+				if (!_c.varint(length) || !_c.has(length)) { return false; }
+				const char * key = _c.p;
+				_c.p += length;
+				if (!_handler.Key(key, static_cast<rapidjson::SizeType>(length), true)) { return false; }
+				if (!decodeValue(_c, _handler, _depth + 1)) { return false; }
+			}
+			return _handler.EndObject(count);
+		}
+		case tagInt8Array:
+		{
+			uint32_t count;
+			if (!_c.u32(count) || !_c.has(count) || !_handler.StartArray()) { return false; }
+			for (uint32_t i = 0; i < count; i++) {
+				if (!_handler.Int(static_cast<int8_t>(*_c.p++))) { return false; }
+			}
+			return _handler.EndArray(count);
+		}
+		default:
+			return false;
+		}
+	}
+
+}
+
+// ###########################################################################################################################################
+
+// Settings writer
+
+bool ak::aStateSnapshot::settingsWriter::Null() { valueAdded(false); m_out.push_back(tagNull); return true; }
+
+bool ak::aStateSnapshot::settingsWriter::Bool(bool _v) { valueAdded(false); m_out.push_back(_v ? tagTrue : tagFalse); return true; }
+
+bool ak::aStateSnapshot::settingsWriter::Int64(int64_t _v) {
+	valueAdded(_v >= -128 && _v <= 127);
+	m_out.push_back(tagInt);
+	putVarint(m_out, zigzag(_v));
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::Uint64(uint64_t _v) {
+	if (_v <= static_cast<uint64_t>(INT64_MAX)) { return Int64(static_cast<int64_t>(_v)); }
+	valueAdded(false);
+	m_out.push_back(tagUint64);
+	putVarint(m_out, _v);
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::Double(double _v) {
+	valueAdded(false);
+	uint64_t bits;
+	memcpy(&bits, &_v, sizeof(bits));
+	m_out.push_back(tagDouble);
+	putU64(m_out, bits);
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::String(const char * _str, rapidjson::SizeType _length, bool) {
+	valueAdded(false);
+	m_out.push_back(tagString);
+	putVarint(m_out, _length);
+	m_out.append(_str, _length);
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::StartObject() {
+	valueAdded(false);
+	m_frames.push_back(frame{ m_out.size(), true });
+	m_out.push_back(tagObject);
+	putU32(m_out, 0);
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::Key(const char * _str, rapidjson::SizeType _length, bool) {
+	putVarint(m_out, _length);
+	m_out.append(_str, _length);
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::EndObject(rapidjson::SizeType _count) {
+	patchU32(m_out, m_frames.back().start + 1, _count);
+	m_frames.pop_back();
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::StartArray() {
+	valueAdded(false);
+	m_frames.push_back(frame{ m_out.size(), true });
+	m_out.push_back(tagArray);
+	putU32(m_out, 0);
+	return true;
+}
+
+bool ak::aStateSnapshot::settingsWriter::EndArray(rapidjson::SizeType _count) {
+	frame f = m_frames.back();
+	m_frames.pop_back();
+	if (!f.allInt8 || _count == 0) {
+		patchU32(m_out, f.start + 1, _count);
+		return true;
+	}
+
+	// All items are small integers (e.g. a serialized byte array), store one byte per item
+	std::string packed;
+	packed.reserve(_count);
+	cursor c(m_out.data() + f.start + 5, m_out.data() + m_out.size());
+	while (c.p < c.end) {
+		c.p++;	// Tag
+		uint64_t v;
+		c.varint(v);
+		packed.push_back(static_cast<char>(static_cast<int8_t>(unzigzag(v))));
+	}
+	m_out.resize(f.start);
+	m_out.push_back(tagInt8Array);
+	putU32(m_out, _count);
+	m_out.append(packed);
+	return true;
+}
+
+void ak::aStateSnapshot::settingsWriter::valueAdded(bool _isInt8) {
+	if (!m_frames.empty()) { m_frames.back().allInt8 = m_frames.back().allInt8 && _isInt8; }
+}
+
+// ###########################################################################################################################################
+
+ak::aStateSnapshot::aStateSnapshot() {}
+
+ak::aStateSnapshot::~aStateSnapshot() {}
+
+// ###########################################################################################################################################
+
+// Writing
+
+bool ak::aStateSnapshot::addEntriesFromJSON(const char * _json, size_t _length) {
+	entryEncoder encoder;
+	rapidjson::Reader reader;
+	rapidjson::MemoryStream stream(_json, _length);
+	if (reader.Parse(stream, encoder).IsError() || !encoder.valid) { return false; }
+
+	for (auto & parsed : encoder.entries) {
+		entry newEntry;
+		newEntry.alias = std::move(parsed.alias);
+		newEntry.objectType = std::move(parsed.type);
+		newEntry.offset = m_payload.size();
+		putString(m_payload, newEntry.alias);
+		putString(m_payload, newEntry.objectType);
+		newEntry.settingsOffset = m_payload.size();
+		m_payload.append(parsed.settings);
+		newEntry.length = m_payload.size() - newEntry.offset;
+		insertEntry(std::move(newEntry));
+	}
+	return true;
+}
+
+void ak::aStateSnapshot::addEntry(const std::string & _alias, const std::string & _objectType, const rapidjson::Value & _settings) {
+	entry newEntry;
+	newEntry.alias = _alias;
+	newEntry.objectType = _objectType;
+	newEntry.offset = m_payload.size();
+
+	putString(m_payload, _alias);
+	putString(m_payload, _objectType);
+	newEntry.settingsOffset = m_payload.size();
+	settingsWriter writer(m_payload);
+	_settings.Accept(writer);
+	newEntry.length = m_payload.size() - newEntry.offset;
+	insertEntry(std::move(newEntry));
+}
+
+void ak::aStateSnapshot::addEntry(const std::string & _alias, const std::string & _objectType, const settingsFunction & _writeSettings) {
+	assert(_writeSettings);	// No function provided
+	entry newEntry;
+	newEntry.alias = _alias;
+	newEntry.objectType = _objectType;
+	newEntry.offset = m_payload.size();
+
+	putString(m_payload, _alias);
+	putString(m_payload, _objectType);
+	newEntry.settingsOffset = m_payload.size();
+	settingsWriter writer(m_payload);
+	_writeSettings(writer);
+	assert(m_payload.size() > newEntry.settingsOffset);	// No settings written
+	newEntry.length = m_payload.size() - newEntry.offset;
+	insertEntry(std::move(newEntry));
+}
+
+std::string ak::aStateSnapshot::toBinary(bool _compress) const {
+	// Compress payload
+	std::string compressed;
+	uint16_t flags{ 0 };
+	if (_compress && !m_payload.empty()) {
+		uLongf compressedLength = compressBound(static_cast<uLong>(m_payload.size()));
+		compressed.resize(compressedLength);
+		if (compress2(reinterpret_cast<Bytef *>(&compressed[0]), &compressedLength,
+			reinterpret_cast<const Bytef *>(m_payload.data()), static_cast<uLong>(m_payload.size()), Z_DEFAULT_COMPRESSION) == Z_OK &&
+			compressedLength < m_payload.size())
+		{
+			compressed.resize(compressedLength);
+			flags |= SNAPSHOT_FLAG_COMPRESSED;
+		}
+	}
+	const std::string & payload = ((flags & SNAPSHOT_FLAG_COMPRESSED) ? compressed : m_payload);
+
+	std::string out;
+	out.reserve(32 + m_applicationVersion.length() + m_entries.size() * 16 + payload.size());
+
+	// Header
+	out.append(SNAPSHOT_MAGIC, 4);
+	putU16(out, SNAPSHOT_FORMAT_VERSION);
+	putU16(out, flags);
+	putString(out, m_applicationVersion);
+
+	// Index
+	putU32(out, static_cast<uint32_t>(m_entries.size()));
+	for (const entry & e : m_entries) {
+		putU64(out, e.hash);
+		putU32(out, static_cast<uint32_t>(e.offset));
+		putU32(out, static_cast<uint32_t>(e.length));
+	}
+
+	// Payload
+	putU32(out, static_cast<uint32_t>(m_payload.size()));
+	putU32(out, static_cast<uint32_t>(payload.size()));
+	out.append(payload);
+	return out;
+}
+
+// ###########################################################################################################################################
+
+// Reading
+
+ak::aStateSnapshot::readResult ak::aStateSnapshot::fromBinary(const char * _data, size_t _length) {
+	clear();
+	cursor c(_data, _data + _length);
+
+	// Header
+	uint16_t version, flags;
+	if (!c.has(4) || memcmp(c.p, SNAPSHOT_MAGIC, 4) != 0) { return rrInvalidFormat; }
+	c.p += 4;
+	if (!c.u16(version) || !c.u16(flags)) { return rrInvalidFormat; }
+	if (version != SNAPSHOT_FORMAT_VERSION) { return rrUnsupportedVersion; }
+	if (!c.string(m_applicationVersion)) { return rrInvalidFormat; }
+
+	// Index
+	uint32_t count;
+	if (!c.u32(count) || !c.has(static_cast<size_t>(count) * 16)) { clear(); return rrInvalidFormat; }
+	m_entries.resize(count);
+	for (entry & e : m_entries) {
+		uint64_t hash;
+		uint32_t offset, length;
+		c.u64(hash);
+		c.u32(offset);
+		c.u32(length);
+		e.hash = hash;
+		e.offset = offset;
+		e.length = length;
+	}
+
+	// Payload
+	uint32_t payloadSize, storedSize;
+	if (!c.u32(payloadSize) || !c.u32(storedSize) || !c.has(storedSize)) { clear(); return rrInvalidFormat; }
+	if (flags & SNAPSHOT_FLAG_COMPRESSED) {
+		// The size is read from the input, check it before allocating (zlib can not exceed its maximum ratio)
+		if (payloadSize > SNAPSHOT_MAX_PAYLOAD_SIZE ||
+			static_cast<unsigned long long>(payloadSize) > static_cast<unsigned long long>(storedSize) * SNAPSHOT_MAX_COMPRESSION_RATIO)
+		{
+			clear();
+			return rrInvalidFormat;
+		}
+		m_payload.resize(payloadSize);
+		uLongf decompressedLength = payloadSize;
+		if (payloadSize > 0 && (uncompress(reinterpret_cast<Bytef *>(&m_payload[0]), &decompressedLength,
+			reinterpret_cast<const Bytef *>(c.p), storedSize) != Z_OK || decompressedLength != payloadSize))
+		{
+			clear();
+			return rrDecompressionFailed;
+		}
+	}
+	else {
+		if (storedSize != payloadSize) { clear(); return rrInvalidFormat; }
+		m_payload.assign(c.p, storedSize);
+	}
+
+	// Entry headers
+	for (entry & e : m_entries) {
+		if (e.offset > m_payload.size() || e.length > m_payload.size() - e.offset) { clear(); return rrInvalidFormat; }
+		cursor ec(m_payload.data() + e.offset, m_payload.data() + e.offset + e.length);
+		if (!ec.string(e.alias) || !ec.string(e.objectType)) { clear(); return rrInvalidFormat; }
+		e.settingsOffset = static_cast<size_t>(ec.p - m_payload.data());
+	}
+	return rrOk;
+}
+
+const ak::aStateSnapshot::entry * ak::aStateSnapshot::findEntry(const std::string & _alias) const {
+	unsigned long long hash = hashAlias(_alias.c_str(), _alias.length());
+	auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash, [](const entry & _e, unsigned long long _hash) { return _e.hash < _hash; });
+	for (; it != m_entries.end() && it->hash == hash; it++) {
+		if (it->alias == _alias) { return &(*it); }
+	}
+	return nullptr;
+}
+
+bool ak::aStateSnapshot::readSettings(const entry & _entry, rapidjson::Document & _doc) const {
+	cursor c(m_payload.data() + _entry.settingsOffset, m_payload.data() + _entry.offset + _entry.length);
+	bool ok{ false };
+	auto generator = [&c, &ok](rapidjson::Document & _handler) {
+		ok = decodeValue(c, _handler, 0);
+		return ok;
+	};
+	_doc.Populate(generator);
+	return ok;
+}
+
+void ak::aStateSnapshot::clear(void) {
+	m_applicationVersion.clear();
+	m_entries.clear();
+	m_payload.clear();
+}
+
+unsigned long long ak::aStateSnapshot::hashAlias(const char * _alias, size_t _length) {
+	// FNV-1a
+	unsigned long long hash{ 14695981039346656037ULL };
+	for (size_t i = 0; i < _length; i++) {
+		hash ^= static_cast<unsigned char>(_alias[i]);
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+void ak::aStateSnapshot::insertEntry(entry && _entry) {
+	_entry.hash = hashAlias(_entry.alias.c_str(), _entry.alias.length());
+	auto pos = std::upper_bound(m_entries.begin(), m_entries.end(), _entry.hash, [](unsigned long long _hash, const entry & _e) { return _hash < _e.hash; });
+	m_entries.insert(pos, std::move(_entry));
+}
@@ -0,0 +1,64 @@
+/*
+ *	File:		aTextIndex.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akCore/aTextIndex.h>
+
+ak::aTextIndex::aTextIndex(Qt::CaseSensitivity _caseSensitivity)
+	: m_caseSensitivity(_caseSensitivity)
+{}
+
+void ak::aTextIndex::add(
+	const QString &			_text,
+	ID						_id
+) { m_index.insert(key(_text), _id); }
+
+void ak::aTextIndex::remove(
+	const QString &			_text,
+	ID						_id
+) { m_index.remove(key(_text), _id); }
+
+void ak::aTextIndex::rename(
+	const QString &			_oldText,
+	const QString &			_newText,
+	ID						_id
+) {
+	QString oldKey{ key(_oldText) };
+	QString newKey{ key(_newText) };
+	if (oldKey == newKey) { return; }
+	m_index.remove(oldKey, _id);
+	m_index.insert(newKey, _id);
+}
+
+ak::ID ak::aTextIndex::find(
+	const QString &			_text
+) const {
+	auto itm = m_index.constFind(key(_text));
+	if (itm == m_index.constEnd()) { return invalidID; }
+
+	// Texts are usually unique, only iterate if there are duplicates
+	ID result = itm.value();
+	const QString & k = itm.key();
+	for (++itm; itm != m_index.constEnd() && itm.key() == k; ++itm) {
+		if (itm.value() < result) { result = itm.value(); }
+	}
+	return result;
+}
+
+void ak::aTextIndex::clear(void) { m_index.clear(); }
+
+void ak::aTextIndex::setCaseSensitivity(
+	Qt::CaseSensitivity		_caseSensitivity
+) {
+	m_caseSensitivity = _caseSensitivity;
+	m_index.clear();
+}
@@ -12,39 +12,116 @@
 
 // uiCore header
 #include <akCore/aTime.h>
+#include <akCore/aDateTimeConversion.h>
 
 // Qt header
 #include <qstringlist.h>
 
-ak::aTime::aTime() 
-	: m_h(0), m_m(0), m_s(0), m_ms(0) {}
+// C++ header
+#include <cstring>
+#include <cwchar>
+
+namespace {
+
+	//! @brief Returns the number of fields written for the time format
+	inline int timeFieldCount(ak::timeFormat _timeFormat) {
+		switch (_timeFormat)
+		{
+		case ak::tfHHMM: return 2;
+		case ak::tfHHMMSS: return 3;
+		case ak::tfHHMMSSMMMM: return 4;
+		default:
+			assert(0);	// Unknown format
+			return 2;
+		}
+	}
 
-ak::aTime::aTime(int _h, int _m, int _s, int _ms) 
-	: m_h(_h), m_m(_m), m_s(_s), m_ms(_ms) {
-	adjustValues();
-}
+	template <class T> bool parseTime(const T * _string, size_t _length, ak::aTime & _result, T _delimiter) {
+		const T * pos = _string;
+		const T * end = _string + _length;
+		int fields[4]{ 0, 0, 0, 0 };
+		for (int i = 0; ; i++) {
+			if (i == 4) { return false; }
+			// Empty fields are accepted and read as 0
+			if (pos != end && *pos != _delimiter && !ak::dateTimeConversion::readNumber(pos, end, fields[i])) { return false; }
+			if (pos == end) { break; }
+			if (*pos != _delimiter) { return false; }
+			++pos;
+			if (pos == end) {
+				if (i == 3) { return false; }
+				break;
+			}
+		}
+		_result.set(fields[0], fields[1], fields[2], fields[3]);
+		return true;
+	}
 
-ak::aTime::aTime(const QTime & _time)
-	: m_h(_time.hour()), m_m(_time.minute()), m_s(_time.second()), m_ms(_time.msec()) {}
+	template <class T> size_t parseFixedTimes(const T * _buffer, size_t _stride, size_t _count, ak::aTime * _results, T _delimiter, ak::timeFormat _timeFormat) {
+		const int fieldCount = timeFieldCount(_timeFormat);
+		assert(_stride >= static_cast<size_t>(fieldCount == 4 ? 13 : fieldCount * 3 - 1));	// Record too short
+		size_t valid = 0;
+		for (size_t i = 0; i < _count; i++) {
+			const T * record = _buffer + i * _stride;
+			int h = ak::dateTimeConversion::readFixed(record, 2);
+			int m = ak::dateTimeConversion::readFixed(record + 3, 2);
+			bool ok = record[2] == _delimiter;
+			int s = 0;
+			int ms = 0;
+			if (fieldCount > 2) {
+				s = ak::dateTimeConversion::readFixed(record + 6, 2);
+				ok = ok && record[5] == _delimiter;
+			}
+			if (fieldCount > 3) {
+				ms = ak::dateTimeConversion::readFixed(record + 9, 4);
+				ok = ok && record[8] == _delimiter;
+			}
+			if (ok && (h | m | s | ms) >= 0) {
+				_results[i].set(h, m, s, ms);
+				valid++;
+			}
+			else { _results[i].set(0, 0, 0, 0); }
+		}
+		return valid;
+	}
 
-ak::aTime::aTime(const aTime & _other)
-	: m_h(_other.m_h), m_m(_other.m_m), m_s(_other.m_s), m_ms(_other.m_ms) {}
+	template <class T> size_t formatTime(const ak::aTime & _time, T * _buffer, T _delimiter, ak::timeFormat _timeFormat) {
+		const int fieldCount = timeFieldCount(_timeFormat);
+		size_t n = ak::dateTimeConversion::writeNumber(_buffer, _time.hour(), 2);
+		_buffer[n++] = _delimiter;
+		n += ak::dateTimeConversion::writeNumber(_buffer + n, _time.minute(), 2);
+		if (fieldCount > 2) {
+			_buffer[n++] = _delimiter;
+			n += ak::dateTimeConversion::writeNumber(_buffer + n, _time.second(), 2);
+		}
+		if (fieldCount > 3) {
+			_buffer[n++] = _delimiter;
+			n += ak::dateTimeConversion::writeNumber(_buffer + n, _time.msec(), 4);
+		}
+		return n;
+	}
+}
 
-ak::aTime::~aTime() {}
+ak::aTime::aTime(const QTime & _time)
+	: m_msecs(_time.msecsSinceStartOfDay()) {}
 
 // ############################################################################################################
 
 // Getter
 
 std::string ak::aTime::toString(const std::string _delimiter, timeFormat _timeFormat) const {
+	if (_delimiter.length() == 1) {
+		char buffer[maxStringLength];
+		return std::string(buffer, formatTime(*this, buffer, _delimiter[0], _timeFormat));
+	}
+
 	std::string h;
 	std::string m;
 	
-	if (m_h < 10) { h = "0" + std::to_string(m_h); }
-	else { h = std::to_string(m_h); }
+	if (hour() < 10) { h = "0" + std::to_string(hour()); }
+	else { h = std::to_string(hour()); }
 
-	if (m_m < 10) { m = "0" + std::to_string(m_m); }
-	else { m = std::to_string(m_m); }
+	if (minute() < 10) { m = "0" + std::to_string(minute()); }
+	else { m = std::to_string(minute()); }
 
 	switch (_timeFormat)
 	{
@@ -52,8 +129,8 @@ std::string ak::aTime::toString(const std::string _delimiter, timeFormat _timeFo
 	case ak::tfHHMMSS:
 	{
 		std::string s;
-		if (m_s < 10) { s = "0" + std::to_string(m_s); }
-		else { s = std::to_string(m_s); }
+		if (second() < 10) { s = "0" + std::to_string(second()); }
+		else { s = std::to_string(second()); }
 		return h + _delimiter + m + _delimiter + s;
 	}
 	case ak::tfHHMMSSMMMM:
@@ -61,13 +138,13 @@ std::string ak::aTime::toString(const std::string _delimiter, timeFormat _timeFo
 		std::string s;
 		std::string ms;
 
-		if (m_s < 10) { s = "0" + std::to_string(m_s); }
-		else { s = std::to_string(m_s); }
+		if (second() < 10) { s = "0" + std::to_string(second()); }
+		else { s = std::to_string(second()); }
 
-		if (m_ms < 10) { ms = "000" + std::to_string(m_ms); }
-		else if (m_ms < 100) { ms = "00" + std::to_string(m_ms); }
-		else if (m_ms < 1000) { ms = "0" + std::to_string(m_ms); }
-		else { ms = std::to_string(m_ms); }
+		if (msec() < 10) { ms = "000" + std::to_string(msec()); }
+		else if (msec() < 100) { ms = "00" + std::to_string(msec()); }
+		else if (msec() < 1000) { ms = "0" + std::to_string(msec()); }
+		else { ms = std::to_string(msec()); }
 
 		return h + _delimiter + m + _delimiter + s + _delimiter + ms;
 	}
@@ -78,14 +155,19 @@ std::string ak::aTime::toString(const std::string _delimiter, timeFormat _timeFo
 }
 
 std::wstring ak::aTime::toWString(const std::wstring _delimiter, timeFormat _timeFormat) const {
+	if (_delimiter.length() == 1) {
+		wchar_t buffer[maxStringLength];
+		return std::wstring(buffer, formatTime(*this, buffer, _delimiter[0], _timeFormat));
+	}
+
 	std::wstring h;
 	std::wstring m;
 
-	if (m_h < 10) { h = L"0" + std::to_wstring(m_h); }
-	else { h = std::to_wstring(m_h); }
+	if (hour() < 10) { h = L"0" + std::to_wstring(hour()); }
+	else { h = std::to_wstring(hour()); }
 
-	if (m_m < 10) { m = L"0" + std::to_wstring(m_m); }
-	else { m = std::to_wstring(m_m); }
+	if (minute() < 10) { m = L"0" + std::to_wstring(minute()); }
+	else { m = std::to_wstring(minute()); }
 
 	switch (_timeFormat)
 	{
@@ -93,8 +175,8 @@ std::wstring ak::aTime::toWString(const std::wstring _delimiter, timeFormat _tim
 	case ak::tfHHMMSS:
 	{
 		std::wstring s;
-		if (m_s < 10) { s = L"0" + std::to_wstring(m_s); }
-		else { s = std::to_wstring(m_s); }
+		if (second() < 10) { s = L"0" + std::to_wstring(second()); }
+		else { s = std::to_wstring(second()); }
 		return h + _delimiter + m + _delimiter + s;
 	}
 	case ak::tfHHMMSSMMMM:
@@ -102,13 +184,13 @@ std::wstring ak::aTime::toWString(const std::wstring _delimiter, timeFormat _tim
 		std::wstring s;
 		std::wstring ms;
 
-		if (m_s < 10) { s = L"0" + std::to_wstring(m_s); }
-		else { s = std::to_wstring(m_s); }
+		if (second() < 10) { s = L"0" + std::to_wstring(second()); }
+		else { s = std::to_wstring(second()); }
 
-		if (m_ms < 10) { ms = L"000" + std::to_wstring(m_ms); }
-		else if (m_ms < 100) { ms = L"00" + std::to_wstring(m_ms); }
-		else if (m_ms < 1000) { ms = L"0" + std::to_wstring(m_ms); }
-		else { ms = std::to_wstring(m_ms); }
+		if (msec() < 10) { ms = L"000" + std::to_wstring(msec()); }
+		else if (msec() < 100) { ms = L"00" + std::to_wstring(msec()); }
+		else if (msec() < 1000) { ms = L"0" + std::to_wstring(msec()); }
+		else { ms = std::to_wstring(msec()); }
 
 		return h + _delimiter + m + _delimiter + s + _delimiter + ms;
 	}
@@ -119,14 +201,20 @@ std::wstring ak::aTime::toWString(const std::wstring _delimiter, timeFormat _tim
 }
 
 QString ak::aTime::toQString(const QString _delimiter, timeFormat _timeFormat) const {
+	if (_delimiter.length() == 1) {
+		char16_t buffer[maxStringLength];
+		size_t n = formatTime(*this, buffer, static_cast<char16_t>(_delimiter[0].unicode()), _timeFormat);
+		return QString(reinterpret_cast<const QChar *>(buffer), static_cast<int>(n));
+	}
+
 	QString h;
 	QString m;
 
-	if (m_h < 10) { h = "0" + QString::number(m_h); }
-	else { h = QString::number(m_h); }
+	if (hour() < 10) { h = "0" + QString::number(hour()); }
+	else { h = QString::number(hour()); }
 
-	if (m_m < 10) { m = "0" + QString::number(m_m); }
-	else { m = QString::number(m_m); }
+	if (minute() < 10) { m = "0" + QString::number(minute()); }
+	else { m = QString::number(minute()); }
 
 	switch (_timeFormat)
 	{
@@ -134,8 +222,8 @@ QString ak::aTime::toQString(const QString _delimiter, timeFormat _timeFormat) c
 	case ak::tfHHMMSS:
 	{
 		QString s;
-		if (m_s < 10) { s = "0" + QString::number(m_s); }
-		else { s = QString::number(m_s); }
+		if (second() < 10) { s = "0" + QString::number(second()); }
+		else { s = QString::number(second()); }
 		return h + _delimiter + m + _delimiter + s;
 	}
 	case ak::tfHHMMSSMMMM:
@@ -143,13 +231,13 @@ QString ak::aTime::toQString(const QString _delimiter, timeFormat _timeFormat) c
 		QString s;
 		QString ms;
 
-		if (m_s < 10) { s = "0" + QString::number(m_s); }
-		else { s = QString::number(m_s); }
+		if (second() < 10) { s = "0" + QString::number(second()); }
+		else { s = QString::number(second()); }
 
-		if (m_ms < 10) { ms = "000" + QString::number(m_ms); }
-		else if (m_ms < 100) { ms = "00" + QString::number(m_ms); }
-		else if (m_ms < 1000) { ms = "0" + QString::number(m_ms); }
-		else { ms = QString::number(m_ms); }
+		if (msec() < 10) { ms = "000" + QString::number(msec()); }
+		else if (msec() < 100) { ms = "00" + QString::number(msec()); }
+		else if (msec() < 1000) { ms = "0" + QString::number(msec()); }
+		else { ms = QString::number(msec()); }
 
 		return h + _delimiter + m + _delimiter + s + _delimiter + ms;
 	}
@@ -159,57 +247,51 @@ QString ak::aTime::toQString(const QString _delimiter, timeFormat _timeFormat) c
 	}
 }
 
-QTime ak::aTime::toQTime(void) const { return QTime(m_h, m_m, m_s, m_ms); }
+QTime ak::aTime::toQTime(void) const { return QTime::fromMSecsSinceStartOfDay(m_msecs); }
 
 // ############################################################################################################
 
 // Setter
 
-void ak::aTime::set(int _h, int _m, int _s, int _ms) {
-	m_h = _h;
-	m_m = _m;
-	m_s = _s;
-	m_ms = _ms;
-	adjustValues();
-}
-
-void ak::aTime::set(const QTime & _time) {
-	m_h = _time.hour();
-	m_m = _time.minute();
-	m_s = _time.second();
-	m_ms = _time.msec();
-	adjustValues();
-}
-
-void ak::aTime::set(const aTime & _time) {
-	m_h = _time.m_h;
-	m_m = _time.m_m;
-	m_s = _time.m_s;
-	m_ms = _time.m_ms;
-	adjustValues();
-}
+void ak::aTime::set(const QTime & _time) { m_msecs = _time.msecsSinceStartOfDay(); }
 
 // ############################################################################################################
 
 // Static parser
 
+// The string overloads try the allocation free parser first and only split the string if it fails (e.g. signs or whitespace)
+
 ak::aTime ak::aTime::parseString(const char * _string, const char * _delimiter) {
+	aTime ret;
+	if (_delimiter[0] != 0 && _delimiter[1] == 0 && parseTime(_string, std::strlen(_string), ret, _delimiter[0])) { return ret; }
 	return parseString(QString(_string), QString(_delimiter));
 }
 
 ak::aTime ak::aTime::parseString(const wchar_t * _string, const wchar_t * _delimiter) {
+	aTime ret;
+	if (_delimiter[0] != 0 && _delimiter[1] == 0 && parseTime(_string, std::wcslen(_string), ret, _delimiter[0])) { return ret; }
 	return parseString(QString::fromWCharArray(_string), QString::fromWCharArray(_delimiter));
 }
 
 ak::aTime ak::aTime::parseString(const std::string & _string, const std::string & _delimiter) {
+	aTime ret;
+	if (_delimiter.length() == 1 && parseTime(_string.c_str(), _string.length(), ret, _delimiter[0])) { return ret; }
 	return parseString(QString(_string.c_str()), QString(_delimiter.c_str()));
 }
 
 ak::aTime ak::aTime::parseString(const std::wstring & _string, const std::wstring & _delimiter) {
+	aTime ret;
+	if (_delimiter.length() == 1 && parseTime(_string.c_str(), _string.length(), ret, _delimiter[0])) { return ret; }
 	return parseString(QString::fromStdWString(_string), QString::fromStdWString(_delimiter));
 }
 
 ak::aTime ak::aTime::parseString(const QString & _string, const QString & _delimiter) {
+	aTime ret;
+	if (_delimiter.length() == 1 && parseTime(reinterpret_cast<const char16_t *>(_string.utf16()), static_cast<size_t>(_string.length()), ret,
+		static_cast<char16_t>(_delimiter[0].unicode()))) {
+		return ret;
+	}
+
 	QStringList lst{ _string.split(_delimiter, QString::KeepEmptyParts) };
 	switch (lst.length())
 	{
@@ -224,298 +306,95 @@ ak::aTime ak::aTime::parseString(const QString & _string, const QString & _delim
 }
 
 bool ak::aTime::adjustValues(int & _h, int & _m, int & _s, int & _ms) {
-	while (_ms < 0) { _ms += 1000; _s--; }
-	while (_ms > 999) { _ms -= 1000; _s++; }
-	while (_s < 0) { _s += 60; _m--; }
-	while (_s > 59) { _s -= 60; _m++; }
-	while (_m < 0) { _m += 60; _h--; }
-	while (_m > 59) { _m -= 60; _h++; }
-	bool ov{ false };
-	while (_h < 0) { _h += 24; ov = true; }
-	while (_h > 23) { _h -= 24; ov = true; }
-	return ov;
-}
-
-bool ak::aTime::adjustValues(void) {
-	return adjustValues(m_h, m_m, m_s, m_ms);
+	_s += dateTimeConversion::carry(_ms, 1000);
+	_m += dateTimeConversion::carry(_s, 60);
+	_h += dateTimeConversion::carry(_m, 60);
+	return dateTimeConversion::carry(_h, 24) != 0;
 }
 
 // ############################################################################################################
 
-// Operators
+// Allocation free conversion
 
-ak::aTime & ak::aTime::operator = (const aTime & _time) {
-	m_h = _time.m_h;
-	m_m = _time.m_m;
-	m_s = _time.m_s;
-	m_ms = _time.m_ms;
-	return *this;
+size_t ak::aTime::format(char * _buffer, char _delimiter, timeFormat _timeFormat) const {
+	return formatTime(*this, _buffer, _delimiter, _timeFormat);
 }
 
-ak::aTime & ak::aTime::operator = (const QTime & _time) {
-	m_h = _time.hour();
-	m_m = _time.minute();
-	m_s = _time.second();
-	m_ms = _time.msec();
-	return *this;
+size_t ak::aTime::format(char16_t * _buffer, char16_t _delimiter, timeFormat _timeFormat) const {
+	return formatTime(*this, _buffer, _delimiter, _timeFormat);
 }
 
-ak::aTime & ak::aTime::operator += (const aTime & _time) {
-	m_h += _time.m_h;
-	m_m += _time.m_m;
-	m_s += _time.m_s;
-	m_ms += _time.m_ms;
-	adjustValues();
-	return *this;
+bool ak::aTime::parse(const char * _string, size_t _length, aTime & _result, char _delimiter) {
+	return parseTime(_string, _length, _result, _delimiter);
 }
 
-ak::aTime & ak::aTime::operator += (const QTime & _time) {
-	m_h += _time.hour();
-	m_m += _time.minute();
-	m_s += _time.second();
-	m_ms += _time.msec();
-	adjustValues();
-	return *this;
+bool ak::aTime::parse(const char16_t * _string, size_t _length, aTime & _result, char16_t _delimiter) {
+	return parseTime(_string, _length, _result, _delimiter);
 }
 
-ak::aTime & ak::aTime::operator -= (const aTime & _time) {
-	m_h -= _time.m_h;
-	m_m -= _time.m_m;
-	m_s -= _time.m_s;
-	m_ms -= _time.m_ms;
-	adjustValues();
-	return *this;
+size_t ak::aTime::parseBatch(const char * const * _strings, const size_t * _lengths, size_t _count, aTime * _results, char _delimiter) {
+	size_t valid = 0;
+	for (size_t i = 0; i < _count; i++) {
+		if (parseTime(_strings[i], _lengths[i], _results[i], _delimiter)) { valid++; }
+		else { _results[i].set(0, 0, 0, 0); }
+	}
+	return valid;
 }
 
-ak::aTime & ak::aTime::operator -= (const QTime & _time) {
-	m_h -= _time.hour();
-	m_m -= _time.minute();
-	m_s -= _time.second();
-	m_ms -= _time.msec();
-	adjustValues();
-	return *this;
+size_t ak::aTime::parseFixedBatch(const char * _buffer, size_t _stride, size_t _count, aTime * _results, char _delimiter, timeFormat _timeFormat) {
+	return parseFixedTimes(_buffer, _stride, _count, _results, _delimiter, _timeFormat);
 }
 
-ak::aTime ak::operator + (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	int h{ _lhv.hour() + _rhv.hour() };
-	int m{ _lhv.minute() + _rhv.minute() };
-	int s{ _lhv.second() + _rhv.second() };
-	int ms{ _lhv.msec() + _rhv.msec() };
-	return aTime(h, m, s, ms);
-}
-ak::aTime ak::operator + (const ak::aTime & _lhv, const QTime & _rhv) {
-	int h{ _lhv.hour() + _rhv.hour() };
-	int m{ _lhv.minute() + _rhv.minute() };
-	int s{ _lhv.second() + _rhv.second() };
-	int ms{ _lhv.msec() + _rhv.msec() };
-	return aTime(h, m, s, ms);
-}
-ak::aTime ak::operator + (const QTime & _lhv, const ak::aTime & _rhv) {
-	int h{ _rhv.hour() + _lhv.hour() };
-	int m{ _rhv.minute() + _lhv.minute() };
-	int s{ _rhv.second() + _lhv.second() };
-	int ms{ _rhv.msec() + _lhv.msec() };
-	return aTime(h, m, s, ms);
+size_t ak::aTime::parseFixedBatch(const char16_t * _buffer, size_t _stride, size_t _count, aTime * _results, char16_t _delimiter, timeFormat _timeFormat) {
+	return parseFixedTimes(_buffer, _stride, _count, _results, _delimiter, _timeFormat);
 }
 
-ak::aTime ak::operator - (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	int h{ _lhv.hour() - _rhv.hour() };
-	int m{ _lhv.minute() - _rhv.minute() };
-	int s{ _lhv.second() - _rhv.second() };
-	int ms{ _lhv.msec() - _rhv.msec() };
-	return aTime(h, m, s, ms);
-}
-ak::aTime ak::operator - (const ak::aTime & _lhv, const QTime & _rhv) {
-	int h{ _lhv.hour() - _rhv.hour() };
-	int m{ _lhv.minute() - _rhv.minute() };
-	int s{ _lhv.second() - _rhv.second() };
-	int ms{ _lhv.msec() - _rhv.msec() };
-	return aTime(h, m, s, ms);
-}
-ak::aTime ak::operator - (const QTime & _lhv, const ak::aTime & _rhv) {
-	int h{ _rhv.hour() - _lhv.hour() };
-	int m{ _rhv.minute() - _lhv.minute() };
-	int s{ _rhv.second() - _lhv.second() };
-	int ms{ _rhv.msec() - _lhv.msec() };
-	return aTime(h, m, s, ms);
+void ak::aTime::formatBatch(const aTime * _times, size_t _count, char * _buffer, size_t _stride, char _delimiter, timeFormat _timeFormat) {
+	for (size_t i = 0; i < _count; i++) {
+		char * record = _buffer + i * _stride;
+		if (_stride >= maxStringLength) { formatTime(_times[i], record, _delimiter, _timeFormat); }
+		else {
+			char buffer[maxStringLength];
+			size_t n = formatTime(_times[i], buffer, _delimiter, _timeFormat);
+			assert(n <= _stride);	// Record too short
+			std::memcpy(record, buffer, (n < _stride ? n : _stride));
+		}
+	}
 }
 
-bool ak::operator == (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	return _lhv.hour() == _rhv.hour() && _lhv.minute() == _rhv.minute() && _lhv.second() == _rhv.second() && _lhv.msec() == _rhv.msec();
-}
-bool ak::operator == (const ak::aTime & _lhv, const QTime & _rhv) {
-	return _lhv.hour() == _rhv.hour() && _lhv.minute() == _rhv.minute() && _lhv.second() == _rhv.second() && _lhv.msec() == _rhv.msec();
-}
-bool ak::operator == (const QTime & _lhv, const ak::aTime & _rhv) {
-	return _rhv.hour() == _lhv.hour() && _rhv.minute() == _lhv.minute() && _rhv.second() == _lhv.second() && _rhv.msec() == _lhv.msec();
-}
+// ############################################################################################################
 
-bool ak::operator != (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	return _lhv.hour() != _rhv.hour() || _lhv.minute() != _rhv.minute() || _lhv.second() != _rhv.second() || _lhv.msec() != _rhv.msec();
-}
-bool ak::operator != (const ak::aTime & _lhv, const QTime & _rhv) {
-	return _lhv.hour() != _rhv.hour() || _lhv.minute() != _rhv.minute() || _lhv.second() != _rhv.second() || _lhv.msec() != _rhv.msec();
-}
-bool ak::operator != (const QTime & _lhv, const ak::aTime & _rhv) {
-	return _rhv.hour() != _lhv.hour() || _rhv.minute() != _lhv.minute() || _rhv.second() != _lhv.second() || _rhv.msec() != _lhv.msec();
-}
+// Operators
 
-bool ak::operator < (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() < _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() < _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() < _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() < _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator < (const ak::aTime & _lhv, const QTime & _rhv) {
-	if (_lhv.hour() < _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() < _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() < _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() < _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator < (const QTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() < _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() < _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() < _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() < _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
+ak::aTime & ak::aTime::operator = (const QTime & _time) {
+	set(_time);
+	return *this;
 }
 
-bool ak::operator <= (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() < _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() < _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() < _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() <= _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator <= (const ak::aTime & _lhv, const QTime & _rhv) {
-	if (_lhv.hour() < _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() < _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() < _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() <= _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator <= (const QTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() < _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() < _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() < _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() <= _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
+ak::aTime & ak::aTime::operator += (const QTime & _time) { return *this += aTime(_time); }
 
-bool ak::operator > (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() > _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() > _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() > _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() > _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator > (const ak::aTime & _lhv, const QTime & _rhv) {
-	if (_lhv.hour() > _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() > _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() > _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() > _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator > (const QTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() > _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() > _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() > _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() > _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
+ak::aTime & ak::aTime::operator -= (const QTime & _time) { return *this -= aTime(_time); }
 
-bool ak::operator >= (const ak::aTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() > _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() > _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() > _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() >= _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator >= (const ak::aTime & _lhv, const QTime & _rhv) {
-	if (_lhv.hour() > _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() > _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() > _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() >= _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
-bool ak::operator >= (const QTime & _lhv, const ak::aTime & _rhv) {
-	if (_lhv.hour() > _rhv.hour()) { return true; }
-	else if (_lhv.hour() == _rhv.hour()) {
-		if (_lhv.minute() > _rhv.minute()) { return true; }
-		else if (_lhv.minute() == _rhv.minute()) {
-			if (_lhv.second() > _rhv.second()) { return true; }
-			else if (_lhv.second() == _rhv.second()) {
-				if (_lhv.msec() >= _rhv.msec()) { return true; }
-			}
-		}
-	}
-	return false;
-}
\ No newline at end of file
+ak::aTime ak::operator + (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv + aTime(_rhv); }
+ak::aTime ak::operator + (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) + _rhv; }
+
+ak::aTime ak::operator - (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv - aTime(_rhv); }
+ak::aTime ak::operator - (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) - _rhv; }
+
+bool ak::operator == (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv == aTime(_rhv); }
+bool ak::operator == (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) == _rhv; }
+
+bool ak::operator != (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv != aTime(_rhv); }
+bool ak::operator != (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) != _rhv; }
+
+bool ak::operator < (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv < aTime(_rhv); }
+bool ak::operator < (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) < _rhv; }
+
+bool ak::operator <= (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv <= aTime(_rhv); }
+bool ak::operator <= (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) <= _rhv; }
+
+bool ak::operator > (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv > aTime(_rhv); }
+bool ak::operator > (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) > _rhv; }
+
+bool ak::operator >= (const ak::aTime & _lhv, const QTime & _rhv) { return _lhv >= aTime(_rhv); }
+bool ak::operator >= (const QTime & _lhv, const ak::aTime & _rhv) { return aTime(_lhv) >= _rhv; }
@@ -12,10 +12,14 @@
 
 // AK header
 #include <akCore/akCore.h>		// Corresponding header
+#include <akCore/aHash.h>
 
 // Qt header
 #include <qevent.h>				// QKeyEvent
 
+// C++ header
+#include <locale>
+
 
 QString ak::toQString(
 	eventType				_eventType
@@ -68,6 +72,7 @@ QString ak::toQString(
 	case srecAppVersionMismatch: return QString("AppVersionMismatch");
 	case srecSettingsVersionMismatch: return QString("SettingsVersionMismatch");
 	case srecEmptySettingsString: return QString("EmptySettingsString");
+	case srecInvalidFormat: return QString("InvalidFormat");
 	default: assert(0); // not implemented yet
 		return QString("");
 	}
@@ -101,6 +106,157 @@ QString ak::toQString(
 	return QString("");
 }
 
+namespace {
+
+	inline unsigned codeUnit(char _c) { return static_cast<unsigned char>(_c); }
+	inline unsigned codeUnit(QChar _c) { return _c.unicode(); }
+
+	inline bool isSpace(unsigned _c) { return _c == ' ' || (_c >= '\t' && _c <= '\r'); }
+	inline bool isDigit(unsigned _c) { return _c >= '0' && _c <= '9'; }
+
+	//! Will skip the leading and trailing whitespace of the range
+	template <class C> void trim(const C *& _begin, const C *& _end) {
+		while (_begin < _end && isSpace(codeUnit(*_begin))) { _begin++; }
+		while (_end > _begin && isSpace(codeUnit(*(_end - 1)))) { _end--; }
+	}
+
+	//! Will parse the digits and return false if there are none or on overflow
+	template <class C> bool parseDigits(const C *& _p, const C * _end, unsigned long long & _value) {
+		const C * start = _p;
+		_value = 0;
+		for (; _p < _end && isDigit(codeUnit(*_p)); _p++) {
+			unsigned digit = codeUnit(*_p) - '0';
+			if (_value > (std::numeric_limits<unsigned long long>::max() - digit) / 10) { return false; }
+			_value = _value * 10 + digit;
+		}
+		return _p != start;
+	}
+
+	template <class C> bool parseIntegerImpl(const C * _begin, const C * _end, long long & _value) {
+		trim(_begin, _end);
+		bool negative{ false };
+		if (_begin < _end && (codeUnit(*_begin) == '-' || codeUnit(*_begin) == '+')) { negative = codeUnit(*_begin++) == '-'; }
+		unsigned long long v;
+		if (!parseDigits(_begin, _end, v) || _begin != _end) { return false; }
+		if (negative) {
+			if (v > static_cast<unsigned long long>(std::numeric_limits<long long>::max()) + 1) { return false; }
+			_value = static_cast<long long>(0 - v);
+		}
+		else {
+			if (v > static_cast<unsigned long long>(std::numeric_limits<long long>::max())) { return false; }
+			_value = static_cast<long long>(v);
+		}
+		return true;
+	}
+
+	template <class C> bool parseUnsignedImpl(const C * _begin, const C * _end, unsigned long long & _value) {
+		trim(_begin, _end);
+		if (_begin < _end && codeUnit(*_begin) == '+') { _begin++; }
+		return parseDigits(_begin, _end, _value) && _begin == _end;
+	}
+
+	template <class C> bool parseDoubleImpl(const C * _begin, const C * _end, double & _value) {
+		static const double powersOf10[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		trim(_begin, _end);
+		const C * p = _begin;
+		bool negative{ false };
+		if (p < _end && (codeUnit(*p) == '-' || codeUnit(*p) == '+')) { negative = codeUnit(*p++) == '-'; }
+
+		// Mantissa, only the first 19 significant digits fit into the integer
+		unsigned long long mantissa{ 0 };
+		int significantDigits{ 0 };
+		int exponent{ 0 };
+		bool truncated{ false };
+		bool hasDigits{ false };
+		bool afterPoint{ false };
+		for (; p < _end; p++) {
+			unsigned c = codeUnit(*p);
+			if (c == '.' && !afterPoint) { afterPoint = true; continue; }
+			if (!isDigit(c)) { break; }
+			hasDigits = true;
+			if (mantissa == 0 && c == '0') {
+				if (afterPoint) { exponent--; }
+				continue;
+			}
+			if (significantDigits < 19) {
+				mantissa = mantissa * 10 + (c - '0');
+				significantDigits++;
+				if (afterPoint) { exponent--; }
+			}
+			else {
+				if (c != '0') { truncated = true; }
+				if (!afterPoint) { exponent++; }
+			}
+		}
+		if (!hasDigits) { return false; }
+
+		// Exponent
+		if (p < _end && (codeUnit(*p) == 'e' || codeUnit(*p) == 'E')) {
+			p++;
+			bool negativeExponent{ false };
+			if (p < _end && (codeUnit(*p) == '-' || codeUnit(*p) == '+')) { negativeExponent = codeUnit(*p++) == '-'; }
+			unsigned long long e;
+			if (!parseDigits(p, _end, e) || e > 100000) { return false; }
+			exponent += (negativeExponent ? -static_cast<int>(e) : static_cast<int>(e));
+		}
+		if (p != _end) { return false; }
+
+		if (mantissa == 0) {
+			_value = (negative ? -0.0 : 0.0);
+			return true;
+		}
+
+		// The result is exact if both the mantissa and the power of 10 are exactly representable
+		if (!truncated && mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+			double v = static_cast<double>(mantissa);
+			v = (exponent < 0 ? v / powersOf10[-exponent] : v * powersOf10[exponent]);
+			_value = (negative ? -v : v);
+			return true;
+		}
+
+		// Rare case, let the stream do the correct rounding. The range only contains ASCII characters at this point
+		std::string str;
+		str.reserve(_end - _begin);
+		for (const C * c = _begin; c < _end; c++) { str.push_back(static_cast<char>(codeUnit(*c))); }
+		std::istringstream ss(str);
+		ss.imbue(std::locale::classic());
+		double v;
+		ss >> v;
+		if (ss.fail() || std::isinf(v)) { return false; }
+		_value = v;
+		return true;
+	}
+
+	//! Returns true if all 8 bytes of the word are ASCII digits
+	inline bool isDigitWord8(unsigned long long _word) {
+		const unsigned long long highBits{ 0x8080808080808080ULL };
+		return ((~_word & (_word + 0x5050505050505050ULL) & ~(_word + 0x4646464646464646ULL)) & highBits) == highBits;
+	}
+
+	//! Returns true if all 4 UTF-16 units of the word are ASCII digits
+	inline bool isDigitWord16(unsigned long long _word) {
+		const unsigned long long highBits{ 0x8000800080008000ULL };
+		return ((~_word & (_word + 0x7FD07FD07FD07FD0ULL) & ~(_word + 0x7FC67FC67FC67FC6ULL)) & highBits) == highBits;
+	}
+
+}
+
+bool ak::parseInteger(const char * _begin, const char * _end, long long & _value) { return parseIntegerImpl(_begin, _end, _value); }
+
+bool ak::parseInteger(const QChar * _begin, const QChar * _end, long long & _value) { return parseIntegerImpl(_begin, _end, _value); }
+
+bool ak::parseUnsigned(const char * _begin, const char * _end, unsigned long long & _value) { return parseUnsignedImpl(_begin, _end, _value); }
+
+bool ak::parseUnsigned(const QChar * _begin, const QChar * _end, unsigned long long & _value) { return parseUnsignedImpl(_begin, _end, _value); }
+
+bool ak::parseDouble(const char * _begin, const char * _end, double & _value) { return parseDoubleImpl(_begin, _end, _value); }
+
+bool ak::parseDouble(const QChar * _begin, const QChar * _end, double & _value) { return parseDoubleImpl(_begin, _end, _value); }
+
 bool ak::isDecimal(const char *str) {
 	bool failed;
 	toNumber<double>(str, failed);
@@ -115,7 +271,13 @@ bool ak::isDecimal(const std::string &str) {
 
 bool ak::isDecimal(const QString &str) {
 	bool failed;
-	toNumber<double>(str.toStdString(), failed);
+	toNumber<double>(str, failed);
+	return !failed;
+}
+
+bool ak::isDecimal(const QChar *str, int length) {
+	bool failed;
+	toNumber<double>(str, str + length, failed);
 	return !failed;
 }
 
@@ -133,29 +295,55 @@ bool ak::isInteger(const std::string &str) {
 
 bool ak::isInteger(const QString &str) {
 	bool failed;
-	toNumber<int>(str.toStdString(), failed);
+	toNumber<int>(str, failed);
 	return !failed;
 }
 
-bool ak::isNumericOnly(const char *str) {
-	QString s{ str };
-	for (auto c : s) {
-		if (!c.isNumber()) { return false; }
-	}
-	return true;
+bool ak::isInteger(const QChar *str, int length) {
+	bool failed;
+	toNumber<int>(str, str + length, failed);
+	return !failed;
 }
 
-bool ak::isNumericOnly(const std::string &str) {
-	QString s{ str.c_str() };
-	for (auto c : s) {
-		if (!c.isNumber()) { return false; }
+bool ak::isNumericOnly(const char *str) { return isNumericOnly(str, strlen(str)); }
+
+bool ak::isNumericOnly(const std::string &str) { return isNumericOnly(str.data(), str.length()); }
+
+bool ak::isNumericOnly(const QString &str) { return isNumericOnly(str.constData(), str.length()); }
+
+bool ak::isNumericOnly(const char *str, size_t length) {
+	// Check 8 characters at once as long as they are ASCII digits
+	size_t i{ 0 };
+	for (; i + 8 <= length; i += 8) {
+		unsigned long long word;
+		memcpy(&word, str + i, sizeof(word));
+		if (!isDigitWord8(word)) { break; }
+	}
+	for (; i < length; i++) {
+		unsigned char c = static_cast<unsigned char>(str[i]);
+		if (c >= 0x80) {
+			// Other unicode numbers are checked by Qt
+			QString rest{ QString::fromUtf8(str + i, static_cast<int>(length - i)) };
+			for (auto qc : rest) {
+				if (!qc.isNumber()) { return false; }
+			}
+			return true;
+		}
+		if (!isDigit(c)) { return false; }
 	}
 	return true;
 }
 
-bool ak::isNumericOnly(const QString &str) {
-	for (auto c : str) {
-		if (!c.isNumber()) { return false; }
+bool ak::isNumericOnly(const QChar *str, int length) {
+	// Check 4 characters at once as long as they are ASCII digits
+	int i{ 0 };
+	for (; i + 4 <= length; i += 4) {
+		unsigned long long word;
+		memcpy(&word, str + i, sizeof(word));
+		if (!isDigitWord16(word)) { break; }
+	}
+	for (; i < length; i++) {
+		if (!isDigit(str[i].unicode()) && !str[i].isNumber()) { return false; }
 	}
 	return true;
 }
@@ -188,15 +376,7 @@ QCryptographicHash::Algorithm ak::toQCryptographicHashAlgorithm(HashAlgorithm _a
 	}
 }
 
-QString ak::hashString(const QString & _str, HashAlgorithm _algorhitm) {
-	QCryptographicHash hash(toQCryptographicHashAlgorithm(_algorhitm));
-	std::string str(_str.toStdString());
-	hash.addData(str.c_str(), str.length());
-	QByteArray arr(hash.result());
-	QByteArray result(arr.toHex());
-	std::string ret(result.toStdString());
-	return QString(ret.c_str());
-}
+QString ak::hashString(const QString & _str, HashAlgorithm _algorhitm) { return aHash::hashHex(_str, _algorhitm); }
 
 // ########################################################################################
 
@@ -255,6 +435,8 @@ QString ak::toQString(
 	case otToolButton: return QString("ToolButton");
 	case otTree: return QString("Tree");
 	case otTreeItem: return QString("TreeItem");
+	case otTableView: return QString("TableView");
+	case otLogView: return QString("LogView");
 	default: assert(0); // Not implemented yet
 	}
 	return QString("");
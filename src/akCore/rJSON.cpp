@@ -15,6 +15,8 @@
 #include <rapidjson/stringbuffer.h>		// StringBuffer
 #include <rapidjson/writer.h>			// Writer
 
+#include <iterator>
+
 void ak::rJSON::memberCheck(AK_rJSON_doc & _doc, const char * _member) {
 	if (!_doc.HasMember(_member)) {
 		std::string error("Member \"");
@@ -82,44 +84,48 @@ unsigned long long ak::rJSON::getULongLong(AK_rJSON_doc & _doc, const char * _me
 }
 
 std::list<unsigned long long> ak::rJSON::getULongLongList(AK_rJSON_doc & _doc, const char * _member) {
+	std::vector<unsigned long long> result(getULongLongVector(_doc, _member));
+	return std::list<unsigned long long>(std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+}
+
+std::vector<unsigned long long> ak::rJSON::getULongLongVector(AK_rJSON_doc & _doc, const char * _member) {
 	memberCheck(_doc, _member);
-	if (!_doc[_member].IsArray()) {
+	const rapidjson::Value & list = _doc[_member];
+	if (!list.IsArray()) {
 		std::string error("Member \"");
 		error.append(_member);
 		error.append("\" is not a unsigned long long list type");
 		throw std::exception(error.c_str());
 	}
 
-	std::list<unsigned long long> result;
-
-	rapidjson::Value list = _doc[_member].GetArray();
-
-	for (unsigned int i = 0; i < list.Size(); i++)
-	{
-		result.push_back(list[i].GetUint64());
+	std::vector<unsigned long long> result;
+	result.reserve(list.Size());
+	for (rapidjson::Value::ConstValueIterator itm = list.Begin(); itm != list.End(); itm++) {
+		result.push_back(itm->GetUint64());
 	}
-
 	return result;
 }
 
 std::list<std::string> ak::rJSON::getStringList(AK_rJSON_doc & _doc, const char * _member) {
+	std::vector<std::string> result(getStringVector(_doc, _member));
+	return std::list<std::string>(std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+}
+
+std::vector<std::string> ak::rJSON::getStringVector(AK_rJSON_doc & _doc, const char * _member) {
 	memberCheck(_doc, _member);
-	if (!_doc[_member].IsArray()) {
+	const rapidjson::Value & list = _doc[_member];
+	if (!list.IsArray()) {
 		std::string error("Member \"");
 		error.append(_member);
 		error.append("\" is not a string list type");
 		throw std::exception(error.c_str());
 	}
 
-	std::list<std::string> result;
-
-	rapidjson::Value list = _doc[_member].GetArray();
-
-	for (unsigned int i = 0; i < list.Size(); i++)
-	{
-		result.push_back(list[i].GetString());
+	std::vector<std::string> result;
+	result.reserve(list.Size());
+	for (rapidjson::Value::ConstValueIterator itm = list.Begin(); itm != list.End(); itm++) {
+		result.push_back(std::string(itm->GetString(), itm->GetStringLength()));
 	}
-
 	return result;
 }
 
@@ -249,44 +255,48 @@ unsigned long long ak::rJSON::getULongLong(AK_rJSON_val & _doc, const char * _me
 }
 
 std::list<unsigned long long> ak::rJSON::getULongLongList(AK_rJSON_val & _doc, const char * _member) {
+	std::vector<unsigned long long> result(getULongLongVector(_doc, _member));
+	return std::list<unsigned long long>(std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+}
+
+std::vector<unsigned long long> ak::rJSON::getULongLongVector(AK_rJSON_val & _doc, const char * _member) {
 	memberCheck(_doc, _member);
-	if (!_doc[_member].IsArray()) {
+	const rapidjson::Value & list = _doc[_member];
+	if (!list.IsArray()) {
 		std::string error("Member \"");
 		error.append(_member);
 		error.append("\" is not a unsigned long long list type");
 		throw std::exception(error.c_str());
 	}
 
-	std::list<unsigned long long> result;
-
-	rapidjson::Value list = _doc[_member].GetArray();
-
-	for (unsigned int i = 0; i < list.Size(); i++)
-	{
-		result.push_back(list[i].GetUint64());
+	std::vector<unsigned long long> result;
+	result.reserve(list.Size());
+	for (rapidjson::Value::ConstValueIterator itm = list.Begin(); itm != list.End(); itm++) {
+		result.push_back(itm->GetUint64());
 	}
-
 	return result;
 }
 
 std::list<std::string> ak::rJSON::getStringList(AK_rJSON_val & _doc, const char * _member) {
+	std::vector<std::string> result(getStringVector(_doc, _member));
+	return std::list<std::string>(std::make_move_iterator(result.begin()), std::make_move_iterator(result.end()));
+}
+
+std::vector<std::string> ak::rJSON::getStringVector(AK_rJSON_val & _doc, const char * _member) {
 	memberCheck(_doc, _member);
-	if (!_doc[_member].IsArray()) {
+	const rapidjson::Value & list = _doc[_member];
+	if (!list.IsArray()) {
 		std::string error("Member \"");
 		error.append(_member);
 		error.append("\" is not a string list type");
 		throw std::exception(error.c_str());
 	}
 
-	std::list<std::string> result;
-
-	rapidjson::Value list = _doc[_member].GetArray();
-
-	for (unsigned int i = 0; i < list.Size(); i++)
-	{
-		result.push_back(list[i].GetString());
+	std::vector<std::string> result;
+	result.reserve(list.Size());
+	for (rapidjson::Value::ConstValueIterator itm = list.Begin(); itm != list.End(); itm++) {
+		result.push_back(std::string(itm->GetString(), itm->GetStringLength()));
 	}
-
 	return result;
 }
 
@@ -0,0 +1,169 @@
+/*
+ *	File:		rJSONStream.cpp
+ *	Package:	akCore
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akCore/rJSONStream.h>
+
+// C++ header
+#include <cstdint>
+
+ak::rJSONStreamWriter::rJSONStreamWriter()
+	: m_writer(m_buffer)
+{}
+
+ak::rJSONStreamWriter::~rJSONStreamWriter() {}
+
+void ak::rJSONStreamWriter::intArray(const int * _values, size_t _count) {
+	m_writer.StartArray();
+	for (size_t i = 0; i < _count; i++) { m_writer.Int(_values[i]); }
+	m_writer.EndArray(static_cast<rapidjson::SizeType>(_count));
+}
+
+void ak::rJSONStreamWriter::clear(void) {
+	m_buffer.Clear();
+	m_writer.Reset(m_buffer);
+}
+
+// ###########################################################################################################################################
+
+namespace ak {
+
+	//! Receives the SAX events of the rapidjson reader and stores them as the current token
+	struct rJSONStreamReaderHandler {
+		rJSONStreamReaderHandler(rJSONStreamReader & _reader) : r(_reader) {}
+
+		bool Null() { r.m_token = rJSONStreamReader::tkNull; return true; }
+		bool Bool(bool _v) { r.m_token = rJSONStreamReader::tkBool; r.m_bool = _v; return true; }
+		bool Int(int _v) { return Int64(_v); }
+		bool Uint(unsigned _v) { return Uint64(_v); }
+		bool Int64(int64_t _v) {
+			r.m_token = rJSONStreamReader::tkInt;
+			r.m_int = _v;
+			r.m_uint = static_cast<unsigned long long>(_v);
+			r.m_double = static_cast<double>(_v);
+			return true;
+		}
+		bool Uint64(uint64_t _v) {
+			r.m_token = (_v > static_cast<uint64_t>(INT64_MAX) ? rJSONStreamReader::tkUint64 : rJSONStreamReader::tkInt);
+			r.m_int = static_cast<long long>(_v);
+			r.m_uint = _v;
+			r.m_double = static_cast<double>(_v);
+			return true;
+		}
+		bool Double(double _v) { r.m_token = rJSONStreamReader::tkDouble; r.m_double = _v; return true; }
+		bool RawNumber(const char * _str, rapidjson::SizeType _length, bool _copy) { return String(_str, _length, _copy); }
+		bool String(const char * _str, rapidjson::SizeType _length, bool) {
+			r.m_token = rJSONStreamReader::tkString;
+			r.m_string.assign(_str, _length);
+			return true;
+		}
+		bool StartObject() { r.m_token = rJSONStreamReader::tkStartObject; r.m_depth++; return true; }
+		bool Key(const char * _str, rapidjson::SizeType _length, bool) {
+			r.m_token = rJSONStreamReader::tkKey;
+			r.m_string.assign(_str, _length);
+			return true;
+		}
+		bool EndObject(rapidjson::SizeType) { r.m_token = rJSONStreamReader::tkEndObject; r.m_depth--; return true; }
+		bool StartArray() { r.m_token = rJSONStreamReader::tkStartArray; r.m_depth++; return true; }
+		bool EndArray(rapidjson::SizeType) { r.m_token = rJSONStreamReader::tkEndArray; r.m_depth--; return true; }
+
+		rJSONStreamReader & r;
+	};
+
+	//! Forwards the SAX events to another handler while keeping the reader state up to date
+	template <class Handler> struct rJSONStreamForwarder {
+		rJSONStreamForwarder(rJSONStreamReader & _reader, Handler & _target) : state(_reader), target(_target) {}
+
+		bool Null() { return state.Null() && target.Null(); }
+		bool Bool(bool _v) { return state.Bool(_v) && target.Bool(_v); }
+		bool Int(int _v) { return state.Int(_v) && target.Int(_v); }
+		bool Uint(unsigned _v) { return state.Uint(_v) && target.Uint(_v); }
+		bool Int64(int64_t _v) { return state.Int64(_v) && target.Int64(_v); }
+		bool Uint64(uint64_t _v) { return state.Uint64(_v) && target.Uint64(_v); }
+		bool Double(double _v) { return state.Double(_v) && target.Double(_v); }
+		bool RawNumber(const char * _str, rapidjson::SizeType _length, bool _copy) { return state.RawNumber(_str, _length, _copy) && target.RawNumber(_str, _length, _copy); }
+		bool String(const char * _str, rapidjson::SizeType _length, bool _copy) { return state.String(_str, _length, _copy) && target.String(_str, _length, _copy); }
+		bool StartObject() { return state.StartObject() && target.StartObject(); }
+		bool Key(const char * _str, rapidjson::SizeType _length, bool _copy) { return state.Key(_str, _length, _copy) && target.Key(_str, _length, _copy); }
+		bool EndObject(rapidjson::SizeType _count) { return state.EndObject(_count) && target.EndObject(_count); }
+		bool StartArray() { return state.StartArray() && target.StartArray(); }
+		bool EndArray(rapidjson::SizeType _count) { return state.EndArray(_count) && target.EndArray(_count); }
+
+		rJSONStreamReaderHandler	state;
+		Handler &					target;
+	};
+
+}
+
+ak::rJSONStreamReader::rJSONStreamReader(const char * _json)
+	: m_stream(_json), m_token(tkNone), m_depth(0), m_bool(false), m_int(0), m_uint(0), m_double(0.0)
+{
+	m_reader.IterativeParseInit();
+}
+
+ak::rJSONStreamReader::~rJSONStreamReader() {}
+
+ak::rJSONStreamReader::tokenType ak::rJSONStreamReader::next(void) {
+	if (m_token == tkEnd || m_token == tkError) { return m_token; }
+	if (m_reader.IterativeParseComplete()) { m_token = tkEnd; return m_token; }
+
+	m_token = tkNone;
+	rJSONStreamReaderHandler handler(*this);
+	if (!m_reader.IterativeParseNext<rapidjson::kParseDefaultFlags>(m_stream, handler)) { m_token = tkError; }
+	else if (m_token == tkNone) { m_token = tkEnd; }
+	return m_token;
+}
+
+bool ak::rJSONStreamReader::skipValue(void) {
+	rapidjson::BaseReaderHandler<> handler;
+	return forward(handler);
+}
+
+bool ak::rJSONStreamReader::readValue(rapidjson::Document & _doc) {
+	bool result{ false };
+	auto generator = [this, &result](rapidjson::Document & _handler) {
+		result = forward(_handler);
+		return result;
+	};
+	_doc.Populate(generator);
+	return result;
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+template <class Handler> bool ak::rJSONStreamReader::forward(Handler & _handler) {
+	// Replay the current token
+	bool ok{ true };
+	switch (m_token)
+	{
+	case tkNull: return _handler.Null();
+	case tkBool: return _handler.Bool(m_bool);
+	case tkInt: return _handler.Int64(m_int);
+	case tkUint64: return _handler.Uint64(m_uint);
+	case tkDouble: return _handler.Double(m_double);
+	case tkString: return _handler.String(m_string.c_str(), static_cast<rapidjson::SizeType>(m_string.length()), true);
+	case tkStartObject: ok = _handler.StartObject(); break;
+	case tkStartArray: ok = _handler.StartArray(); break;
+	default: return false;
+	}
+
+	// Forward the events until the object or array is closed
+	int targetDepth{ m_depth - 1 };
+	rJSONStreamForwarder<Handler> forwarder(*this, _handler);
+	while (ok && m_depth > targetDepth) {
+		ok = m_reader.IterativeParseNext<rapidjson::kParseDefaultFlags>(m_stream, forwarder);
+		if (!ok) { m_token = tkError; }
+	}
+	return ok;
+}
@@ -0,0 +1,214 @@
+/*
+ *	File:		aMSSQLConnectionPool.cpp
+ *	Package:	akDB
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#include <akDB/aMSSQLConnectionPool.h>
+#include <akDB/aMSSQLWrapper.h>
+#include <akCore/aMessenger.h>
+
+#include <cassert>
+#include <chrono>
+
+#define MSSQL_POOL_DEFAULT_HEALTH_CHECK_INTERVAL 30000
+
+ak::aMSSQLConnectionPool::aMSSQLConnectionPool(
+	const std::wstring &		_connectionString,
+	int							_size,
+	aMessenger *				_messenger,
+	UID							_uid,
+	QObject *					_parent
+) : QObject(_parent), m_messenger(_messenger), m_uid(_uid), m_connectionString(_connectionString), m_nextId(0), m_pendingCount(0),
+	m_healthCheckInterval(MSSQL_POOL_DEFAULT_HEALTH_CHECK_INTERVAL), m_stop(false)
+{
+	assert(_size > 0);	// Invalid pool size
+	for (int i = 0; i < _size; i++) {
+		m_workers.push_back(std::unique_ptr<worker>(new worker));
+		m_workers.back()->connection.reset(new aMSSQLWrapper);
+	}
+	for (auto & w : m_workers) { w->thread = std::thread(&aMSSQLConnectionPool::run, this, w.get()); }
+}
+
+ak::aMSSQLConnectionPool::~aMSSQLConnectionPool() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+		m_queue.clear();
+		for (auto & w : m_workers) {
+			if (w->currentJob != invalidID) { cancelWorker(w.get()); }
+		}
+	}
+	m_condition.notify_all();
+	for (auto & w : m_workers) {
+		if (w->thread.joinable()) { w->thread.join(); }
+	}
+}
+
+ak::ID ak::aMSSQLConnectionPool::submit(
+	const jobFunction &			_job,
+	const callbackFunction &	_callback
+) {
+	assert(_job);	// No job provided
+	ID id{ m_nextId++ };
+	if (_callback) { m_callbacks[id] = _callback; }
+	m_pendingCount++;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queue.push_back(job{ id, _job });
+	}
+	m_condition.notify_one();
+	return id;
+}
+
+bool ak::aMSSQLConnectionPool::cancel(
+	ID							_jobId
+) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto itm = m_queue.begin(); itm != m_queue.end(); itm++) {
+		if (itm->id == _jobId) {
+			m_queue.erase(itm);
+			jobResult result;
+			result.cancelled = true;
+			result.error = "Cancelled";
+			finishJob(_jobId, result);
+			return true;
+		}
+	}
+	for (auto & w : m_workers) {
+		if (w->currentJob == _jobId) {
+			cancelWorker(w.get());
+			return true;
+		}
+	}
+	return false;
+}
+
+void ak::aMSSQLConnectionPool::cancelAll(void) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	jobResult result;
+	result.cancelled = true;
+	result.error = "Cancelled";
+	for (auto const & j : m_queue) { finishJob(j.id, result); }
+	m_queue.clear();
+	for (auto & w : m_workers) {
+		if (w->currentJob != invalidID) { cancelWorker(w.get()); }
+	}
+}
+
+void ak::aMSSQLConnectionPool::setHealthCheckInterval(int _interval) {
+	assert(_interval > 0);	// Invalid interval
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_healthCheckInterval = _interval;
+}
+
+// ###########################################################################################################################################
+
+// Private slots
+
+void ak::aMSSQLConnectionPool::slotJobFinished(int _jobId) {
+	jobResult result;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto itm = m_results.find(_jobId);
+		if (itm == m_results.end()) { return; }
+		result = std::move(itm->second);
+		m_results.erase(itm);
+	}
+	m_pendingCount--;
+
+	auto callback = m_callbacks.find(_jobId);
+	if (callback != m_callbacks.end()) {
+		callbackFunction function{ std::move(callback->second) };
+		m_callbacks.erase(callback);
+		function(_jobId, result.success, result.error);
+	}
+	if (m_messenger != nullptr) {
+		m_messenger->sendMessage(m_uid, (result.success ? etChanged : etInvalidEntry), _jobId, (result.cancelled ? 1 : 0));
+	}
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+void ak::aMSSQLConnectionPool::run(worker * _worker) {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (!m_stop) {
+		if (m_queue.empty()) {
+			// Check the connection if no job arrived within the interval
+			if (m_condition.wait_for(lock, std::chrono::milliseconds(m_healthCheckInterval)) == std::cv_status::timeout && m_queue.empty() && !m_stop) {
+				lock.unlock();
+				if (_worker->connection->isConnected() && !_worker->connection->isConnectionAlive()) { resetConnection(_worker); }
+				lock.lock();
+			}
+			continue;
+		}
+
+		job current{ std::move(m_queue.front()) };
+		m_queue.pop_front();
+		_worker->currentJob = current.id;
+		lock.unlock();
+
+		jobResult result{ runJob(_worker, current) };
+
+		lock.lock();
+		_worker->currentJob = invalidID;
+		if (!m_stop) { finishJob(current.id, result); }
+	}
+}
+
+ak::aMSSQLConnectionPool::jobResult ak::aMSSQLConnectionPool::runJob(worker * _worker, const job & _job) {
+	jobResult result;
+	if (!ensureConnected(_worker, result.error)) { return result; }
+
+	_worker->connection->resetStatementCancelled();
+	try {
+		_job.function(*_worker->connection);
+		result.success = true;
+	}
+	catch (const std::exception & _e) { result.error = _e.what(); }
+	catch (...) { result.error = "Unknown error"; }
+
+	// A cancel request only counts if a statement of the job was actually cancelled, a job that completed its work succeeded
+	if (!result.success && _worker->connection->statementCancelled()) {
+		result.cancelled = true;
+		if (result.error.empty()) { result.error = "Cancelled"; }
+	}
+
+	// The next job will reconnect if the connection was lost
+	if (!result.success && !_worker->connection->isConnectionAlive()) { resetConnection(_worker); }
+	return result;
+}
+
+bool ak::aMSSQLConnectionPool::ensureConnected(worker * _worker, std::string & _error) {
+	if (_worker->connection->isConnected()) { return true; }
+	try {
+		if (_worker->connection->connect(m_connectionString)) { return true; }
+		_error = "Failed to connect to the database";
+	}
+	catch (const std::exception & _e) { _error = std::string("Failed to connect to the database: ") + _e.what(); }
+	_worker->connection->disconnect();
+	return false;
+}
+
+void ak::aMSSQLConnectionPool::resetConnection(worker * _worker) {
+	_worker->connection->disconnect();
+}
+
+void ak::aMSSQLConnectionPool::finishJob(ID _jobId, const jobResult & _result) {
+	// m_mutex is locked, the notification is forwarded to the thread of the pool
+	m_results[_jobId] = _result;
+	QMetaObject::invokeMethod(this, "slotJobFinished", Qt::QueuedConnection, Q_ARG(int, _jobId));
+}
+
+void ak::aMSSQLConnectionPool::cancelWorker(worker * _worker) {
+	// m_mutex is locked, the cancel only uses the active statement of the connection and never waits for the worker
+	_worker->connection->cancel();
+}
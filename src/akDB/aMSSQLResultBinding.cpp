@@ -0,0 +1,259 @@
+/*
+ *	File:		aMSSQLResultBinding.cpp
+ *	Package:	akDB
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#include <akDB/aMSSQLResultBinding.h>
+#include <akDB/aMSSQLStatement.h>
+#include <akWidgets/aTableViewWidget.h>
+#include <akWidgets/aTreeWidget.h>
+
+// Qt header
+#include <qabstractscrollarea.h>
+#include <qscrollbar.h>
+
+#include <cassert>
+
+#define MSSQL_BINDING_DEFAULT_PREFETCH_DISTANCE 50
+
+namespace {
+
+	void appendCellTexts(const ak::aMSSQLStatement & _statement, size_t _row, std::vector<QString> & _cells) {
+		for (size_t c = 0; c < _statement.columnCount(); c++) {
+			switch (_statement.columnType(c))
+			{
+			case SQL_C_SLONG:
+			{
+				auto column = _statement.intColumn(c);
+				_cells.push_back(column.isNull(_row) ? QString() : QString::number(column[_row]));
+			}
+				break;
+			case SQL_C_SBIGINT:
+			{
+				auto column = _statement.bigIntColumn(c);
+				_cells.push_back(column.isNull(_row) ? QString() : QString::number(static_cast<qlonglong>(column[_row])));
+			}
+				break;
+			case SQL_C_DOUBLE:
+			{
+				auto column = _statement.doubleColumn(c);
+				_cells.push_back(column.isNull(_row) ? QString() : QString::number(column[_row]));
+			}
+				break;
+			default:
+			{
+				auto column = _statement.stringColumn(c);
+				_cells.push_back(column.isNull(_row) ? QString() : column.toQString(_row));
+				// Mark texts that were cut off at the column width
+				if (column.isTruncated(_row)) { _cells.back().append(QChar(0x2026)); }
+			}
+				break;
+			}
+		}
+	}
+
+}
+
+ak::aMSSQLResultBinding::aMSSQLResultBinding(QObject * _parent)
+	: QObject(_parent), m_textColumn(0), m_pathColumn(-1), m_delimiter('|'), m_rowCount(0),
+	m_prefetchDistance(MSSQL_BINDING_DEFAULT_PREFETCH_DISTANCE), m_isFetching(false), m_isFetchingAll(false), m_hasHeaders(false),
+	m_generation(0)
+{}
+
+ak::aMSSQLResultBinding::~aMSSQLResultBinding() { reset(); }
+
+void ak::aMSSQLResultBinding::bindTable(
+	aTableViewWidget *							_table,
+	const std::shared_ptr<aMSSQLStatement> &	_statement,
+	int											_pageSize
+) {
+	assert(_table != nullptr);	// No table provided
+	reset();
+	m_table = _table;
+
+	_table->tableModel()->setDimensions(0, 0);
+	attach(_table, _statement, _pageSize);
+	fetchMore();
+}
+
+void ak::aMSSQLResultBinding::bindTree(
+	aTreeWidget *								_tree,
+	const std::shared_ptr<aMSSQLStatement> &	_statement,
+	int											_textColumn,
+	int											_pathColumn,
+	char										_delimiter,
+	int											_pageSize
+) {
+	assert(_tree != nullptr);	// No tree provided
+	reset();
+	m_tree = _tree;
+	m_textColumn = _textColumn;
+	m_pathColumn = _pathColumn;
+	m_delimiter = _delimiter;
+
+	attach(_tree->widget()->findChild<QAbstractScrollArea *>(), _statement, _pageSize);
+	if (m_statement != nullptr) { fetchMore(); }
+}
+
+bool ak::aMSSQLResultBinding::fetchMore(void) {
+	if (m_statement == nullptr || m_isFetching) { return false; }
+	if (m_table.isNull() && m_tree.isNull()) {
+		reset();
+		return false;
+	}
+
+	// The statement is only used by the fetch thread until the page was handed over
+	m_isFetching = true;
+	if (m_fetchThread.joinable()) { m_fetchThread.join(); }
+	std::shared_ptr<aMSSQLStatement> statement{ m_statement };
+	bool withHeaders{ !m_hasHeaders };
+	int generation{ m_generation };
+	m_fetchThread = std::thread([this, statement, withHeaders, generation]() {
+		page result;
+		fetchPage(*statement, withHeaders, result);
+		{
+			std::lock_guard<std::mutex> lock(m_pageMutex);
+			m_page = std::move(result);
+		}
+		QMetaObject::invokeMethod(this, "slotPageFetched", Qt::QueuedConnection, Q_ARG(int, generation));
+	});
+	return true;
+}
+
+void ak::aMSSQLResultBinding::fetchAll(void) {
+	if (m_statement == nullptr) { return; }
+	m_isFetchingAll = true;
+	fetchMore();
+}
+
+void ak::aMSSQLResultBinding::reset(void) {
+	m_generation++;
+	waitForFetch();
+	if (m_view != nullptr) { disconnect(m_view->verticalScrollBar(), &QScrollBar::valueChanged, this, &aMSSQLResultBinding::slotScrolled); }
+	if (m_statement != nullptr) { m_statement->close(); }
+	m_statement.reset();
+	m_view = nullptr;
+	m_table = nullptr;
+	m_tree = nullptr;
+	m_rowCount = 0;
+	m_isFetchingAll = false;
+	m_hasHeaders = false;
+}
+
+// ###########################################################################################################################################
+
+// Private slots
+
+void ak::aMSSQLResultBinding::slotScrolled(int _value) {
+	if (m_view == nullptr || m_statement == nullptr) { return; }
+	QScrollBar * bar = m_view->verticalScrollBar();
+	// Table and tree scroll per item, the value is in rows. A hidden view is not filled
+	if (bar->maximum() == 0 ? m_view->isVisible() : bar->maximum() - _value <= m_prefetchDistance) { fetchMore(); }
+}
+
+void ak::aMSSQLResultBinding::slotPageFetched(int _generation) {
+	if (_generation != m_generation) { return; }	// Dropped by reset
+	waitForFetch();
+	page fetched;
+	{
+		std::lock_guard<std::mutex> lock(m_pageMutex);
+		fetched = std::move(m_page);
+	}
+
+	if (fetched.failed) {
+		reset();
+		emit fetchFailed(fetched.error);
+		return;
+	}
+	if (m_table.isNull() && m_tree.isNull()) {
+		reset();
+		return;
+	}
+
+	if (fetched.rows > 0) {
+		addRows(fetched);
+		emit pageFetched(m_rowCount);
+		if (m_isFetchingAll) { fetchMore(); }
+		// A page that does not fill the view would never be followed by a scroll event
+		else if (m_view != nullptr && m_view->verticalScrollBar()->maximum() == 0) {
+			QMetaObject::invokeMethod(this, "slotScrolled", Qt::QueuedConnection, Q_ARG(int, 0));
+		}
+		return;
+	}
+
+	m_statement->close();
+	m_statement.reset();
+	m_isFetchingAll = false;
+	if (m_view != nullptr) { disconnect(m_view->verticalScrollBar(), &QScrollBar::valueChanged, this, &aMSSQLResultBinding::slotScrolled); }
+	emit finished(m_rowCount);
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+void ak::aMSSQLResultBinding::attach(QAbstractScrollArea * _view, const std::shared_ptr<aMSSQLStatement> & _statement, int _pageSize) {
+	assert(_statement != nullptr);	// No statement provided
+	assert(_pageSize > 0);	// Invalid page size
+	m_statement = _statement;
+	m_statement->setRowArraySize(static_cast<size_t>(_pageSize));
+	m_view = _view;
+	if (m_view != nullptr) { connect(m_view->verticalScrollBar(), &QScrollBar::valueChanged, this, &aMSSQLResultBinding::slotScrolled); }
+}
+
+void ak::aMSSQLResultBinding::addRows(const page & _page) {
+	if (!m_table.isNull()) {
+		aTableModel * model = m_table->tableModel();
+		if (!_page.headers.empty()) {
+			m_hasHeaders = true;
+			if (model->columnCount() < static_cast<int>(_page.headers.size())) { model->setColumnCount(static_cast<int>(_page.headers.size())); }
+			for (size_t c = 0; c < _page.headers.size(); c++) { model->setColumnHeader(static_cast<int>(c), _page.headers[c]); }
+		}
+		model->setRows(model->rowCount(), _page.cells.data(), static_cast<int>(_page.rows), static_cast<int>(_page.columns));
+	}
+	else if (!m_tree.isNull()) {
+		int textColumn{ m_textColumn };
+		int pathColumn{ m_pathColumn };
+		for (size_t r = 0; r < _page.rows; r++) {
+			const QString * cells = _page.cells.data() + r * _page.columns;
+			if (textColumn < 0 || textColumn >= static_cast<int>(_page.columns)) { continue; }
+			// The path and the text are added separately, a text containing the delimiter must not create further levels
+			ID parent{ -1 };
+			if (pathColumn >= 0 && pathColumn < static_cast<int>(_page.columns) && !cells[pathColumn].isEmpty()) {
+				parent = m_tree->add(cells[pathColumn], m_delimiter);
+			}
+			m_tree->add(parent, cells[textColumn]);
+		}
+	}
+	m_rowCount += static_cast<int>(_page.rows);
+}
+
+void ak::aMSSQLResultBinding::waitForFetch(void) {
+	if (m_fetchThread.joinable()) { m_fetchThread.join(); }
+	m_isFetching = false;
+}
+
+void ak::aMSSQLResultBinding::fetchPage(aMSSQLStatement & _statement, bool _withHeaders, page & _page) {
+	try {
+		_page.rows = _statement.fetchBlock();
+		_page.columns = _statement.columnCount();
+		if (_page.rows == 0) { return; }
+		if (_withHeaders) {
+			_page.headers.reserve(_page.columns);
+			for (size_t c = 0; c < _page.columns; c++) { _page.headers.push_back(QString::fromStdWString(_statement.columnName(c))); }
+		}
+		_page.cells.reserve(_page.rows * _page.columns);
+		for (size_t r = 0; r < _page.rows; r++) { appendCellTexts(_statement, r, _page.cells); }
+	}
+	catch (const std::exception & _e) {
+		_page.failed = true;
+		_page.error = QString::fromStdString(_e.what());
+	}
+}
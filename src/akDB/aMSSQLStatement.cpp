@@ -0,0 +1,305 @@
+/*
+ *	File:		aMSSQLStatement.cpp
+ *	Package:	akDB
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+#include <akDB/aMSSQLStatement.h>
+#include <akDB/aMSSQLWrapper.h>
+
+#include <cassert>
+
+#define MSSQL_STATEMENT_DEFAULT_ROW_ARRAY_SIZE 1024
+#define MSSQL_STATEMENT_DEFAULT_MAX_STRING_LENGTH 256
+
+ak::aMSSQLStatement::aMSSQLStatement(
+	aMSSQLWrapper &			_connection,
+	const std::wstring &	_query
+) : m_connection(&_connection), m_handle(nullptr), m_query(_query), m_columnsBound(false), m_rowsFetched(0), m_hasTruncatedText(false),
+	m_rowArraySize(MSSQL_STATEMENT_DEFAULT_ROW_ARRAY_SIZE), m_maxStringLength(MSSQL_STATEMENT_DEFAULT_MAX_STRING_LENGTH)
+{
+	if (!SQL_SUCCEEDED(SQLAllocHandle(SQL_HANDLE_STMT, _connection.connectionHandle(), &m_handle))) {
+		m_handle = nullptr;
+		throw aMSSQLConnectionException("An error occured while allocating the statement handle");
+	}
+	QString query{ QString::fromStdWString(m_query) };
+	if (!SQL_SUCCEEDED(SQLPrepareW(m_handle, (SQLWCHAR*)sqlText(query), SQL_NTS))) {
+		try { throwError("Failed to prepare statement"); }
+		catch (...) {
+			release();
+			throw;
+		}
+	}
+}
+
+ak::aMSSQLStatement::~aMSSQLStatement() { release(); }
+
+// ###################################################################################################################################
+
+// Parameters
+
+void ak::aMSSQLStatement::bind(size_t _index, int _value) {
+	parameter & p = parameterAt(_index);
+	p.cType = SQL_C_SBIGINT;
+	p.sqlType = SQL_INTEGER;
+	p.intValue = _value;
+	p.indicator = 0;
+}
+
+void ak::aMSSQLStatement::bind(size_t _index, long long _value) {
+	parameter & p = parameterAt(_index);
+	p.cType = SQL_C_SBIGINT;
+	p.sqlType = SQL_BIGINT;
+	p.intValue = _value;
+	p.indicator = 0;
+}
+
+void ak::aMSSQLStatement::bind(size_t _index, double _value) {
+	parameter & p = parameterAt(_index);
+	p.cType = SQL_C_DOUBLE;
+	p.sqlType = SQL_DOUBLE;
+	p.doubleValue = _value;
+	p.indicator = 0;
+}
+
+void ak::aMSSQLStatement::bind(size_t _index, const std::wstring & _value) {
+	parameter & p = parameterAt(_index);
+	p.cType = SQL_C_WCHAR;
+	p.sqlType = SQL_WVARCHAR;
+	p.textValue = QString::fromStdWString(_value);
+	p.indicator = static_cast<SQLLEN>(p.textValue.length() * sizeof(SQLWCHAR));
+}
+
+void ak::aMSSQLStatement::bindNull(size_t _index) {
+	parameter & p = parameterAt(_index);
+	p.cType = SQL_C_WCHAR;
+	p.sqlType = SQL_WVARCHAR;
+	p.textValue.clear();
+	p.indicator = SQL_NULL_DATA;
+}
+
+void ak::aMSSQLStatement::clearParameters(void) {
+	m_parameters.clear();
+	if (m_handle != nullptr) { SQLFreeStmt(m_handle, SQL_RESET_PARAMS); }
+}
+
+// ###################################################################################################################################
+
+// Execution
+
+void ak::aMSSQLStatement::execute(void) {
+	assert(m_handle != nullptr);	// Statement was released
+	close();
+	bindParameters();
+
+	m_connection->beginStatement(m_handle);
+	SQLRETURN result = SQLExecute(m_handle);
+	m_connection->endStatement(result);
+	if (!SQL_SUCCEEDED(result) && result != SQL_NO_DATA) { throwError("Failed to execute statement"); }
+
+	// Describe the result right away so the columns are known before the first fetch
+	if (!m_columnsBound) { bindColumns(); }
+}
+
+size_t ak::aMSSQLStatement::fetchBlock(void) {
+	assert(m_handle != nullptr);	// Statement was released
+	if (!m_columnsBound) { bindColumns(); }
+	if (m_columns.empty()) { return 0; }
+
+	m_connection->beginStatement(m_handle);
+	SQLRETURN result = SQLFetchScroll(m_handle, SQL_FETCH_NEXT, 0);
+	m_connection->endStatement(result);
+	m_hasTruncatedText = false;
+	if (result == SQL_NO_DATA) {
+		m_rowsFetched = 0;
+		return 0;
+	}
+	if (!SQL_SUCCEEDED(result)) { throwError("Failed to fetch rows"); }
+
+	// Truncation is reported with a warning, only then the text columns are checked
+	if (result == SQL_SUCCESS_WITH_INFO) {
+		for (size_t i = 0; i < m_columns.size() && !m_hasTruncatedText; i++) {
+			if (m_columns[i].cType != SQL_C_WCHAR) { continue; }
+			aMSSQLStringColumn texts{ stringColumn(i) };
+			for (size_t r = 0; r < texts.size(); r++) {
+				if (texts.isTruncated(r)) { m_hasTruncatedText = true; break; }
+			}
+		}
+	}
+	return static_cast<size_t>(m_rowsFetched);
+}
+
+void ak::aMSSQLStatement::close(void) {
+	if (m_handle != nullptr) { SQLFreeStmt(m_handle, SQL_CLOSE); }
+	m_rowsFetched = 0;
+	m_hasTruncatedText = false;
+}
+
+long long ak::aMSSQLStatement::affectedRows(void) const {
+	SQLLEN count = 0;
+	if (m_handle == nullptr || !SQL_SUCCEEDED(SQLRowCount(m_handle, &count))) { return -1; }
+	return static_cast<long long>(count);
+}
+
+// ###################################################################################################################################
+
+// Columns of the current block
+
+ak::aMSSQLColumn<SQLINTEGER> ak::aMSSQLStatement::intColumn(size_t _column) const {
+	const column & c = columnOfType(_column, SQL_C_SLONG);
+	return aMSSQLColumn<SQLINTEGER>(reinterpret_cast<const SQLINTEGER *>(c.buffer.data()), c.indicators.data(), rowCount());
+}
+
+ak::aMSSQLColumn<SQLBIGINT> ak::aMSSQLStatement::bigIntColumn(size_t _column) const {
+	const column & c = columnOfType(_column, SQL_C_SBIGINT);
+	return aMSSQLColumn<SQLBIGINT>(reinterpret_cast<const SQLBIGINT *>(c.buffer.data()), c.indicators.data(), rowCount());
+}
+
+ak::aMSSQLColumn<double> ak::aMSSQLStatement::doubleColumn(size_t _column) const {
+	const column & c = columnOfType(_column, SQL_C_DOUBLE);
+	return aMSSQLColumn<double>(reinterpret_cast<const double *>(c.buffer.data()), c.indicators.data(), rowCount());
+}
+
+ak::aMSSQLStringColumn ak::aMSSQLStatement::stringColumn(size_t _column) const {
+	const column & c = columnOfType(_column, SQL_C_WCHAR);
+	return aMSSQLStringColumn(reinterpret_cast<const SQLWCHAR *>(c.buffer.data()), c.width, c.indicators.data(), rowCount());
+}
+
+// ###################################################################################################################################
+
+// Settings
+
+void ak::aMSSQLStatement::setRowArraySize(size_t _rows) {
+	assert(_rows > 0);	// Invalid row count
+	m_rowArraySize = _rows;
+	m_columnsBound = false;
+}
+
+void ak::aMSSQLStatement::setMaxStringLength(size_t _length) {
+	assert(_length > 0);	// Invalid length
+	m_maxStringLength = _length;
+	m_columnsBound = false;
+}
+
+void ak::aMSSQLStatement::release(void) {
+	aMSSQLWrapper::freeHandle(m_handle, SQL_HANDLE_STMT);
+	m_columns.clear();
+	m_columnsBound = false;
+	m_rowsFetched = 0;
+}
+
+// ###################################################################################################################################
+
+// Private functions
+
+ak::aMSSQLStatement::parameter & ak::aMSSQLStatement::parameterAt(size_t _index) {
+	if (_index >= m_parameters.size()) { m_parameters.resize(_index + 1); }
+	return m_parameters[_index];
+}
+
+void ak::aMSSQLStatement::bindParameters(void) {
+	// The values are stored in the parameter vector, the pointers stay valid until the next bind call
+	for (size_t i = 0; i < m_parameters.size(); i++) {
+		parameter & p = m_parameters[i];
+		SQLPOINTER value = nullptr;
+		SQLULEN columnSize = 0;
+		SQLLEN bufferLength = 0;
+		switch (p.cType)
+		{
+		case SQL_C_SBIGINT: value = &p.intValue; break;
+		case SQL_C_DOUBLE: value = &p.doubleValue; break;
+		default:
+			value = (SQLPOINTER)sqlText(p.textValue);
+			columnSize = (p.textValue.empty() ? 1 : p.textValue.length());
+			bufferLength = static_cast<SQLLEN>((p.textValue.length() + 1) * sizeof(SQLWCHAR));
+			break;
+		}
+		SQLRETURN result = SQLBindParameter(m_handle, static_cast<SQLUSMALLINT>(i + 1), SQL_PARAM_INPUT, p.cType, p.sqlType,
+			columnSize, 0, value, bufferLength, &p.indicator);
+		if (!SQL_SUCCEEDED(result)) { throwError("Failed to bind parameter"); }
+	}
+}
+
+void ak::aMSSQLStatement::bindColumns(void) {
+	m_columns.clear();
+	m_columnsBound = true;
+
+	SQLSMALLINT count = 0;
+	if (!SQL_SUCCEEDED(SQLNumResultCols(m_handle, &count))) { throwError("Failed to read the result columns"); }
+	if (count <= 0) { return; }
+
+	// Bind column-wise, every column is a contiguous array with one element per row
+	SQLSetStmtAttr(m_handle, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)SQL_BIND_BY_COLUMN, 0);
+	SQLSetStmtAttr(m_handle, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)m_rowArraySize, 0);
+	SQLSetStmtAttr(m_handle, SQL_ATTR_ROWS_FETCHED_PTR, &m_rowsFetched, 0);
+
+	m_columns.resize(count);
+	for (SQLSMALLINT i = 0; i < count; i++) {
+		column & c = m_columns[i];
+		SQLWCHAR name[256];
+		SQLSMALLINT nameLength = 0, dataType = 0, decimals = 0, nullable = 0;
+		SQLULEN size = 0;
+		if (!SQL_SUCCEEDED(SQLDescribeColW(m_handle, i + 1, name, 256, &nameLength, &dataType, &size, &decimals, &nullable))) {
+			throwError("Failed to describe a result column");
+		}
+		c.name = sqlTextToWString(name, (nameLength < 256 ? nameLength : 255));
+
+		switch (dataType)
+		{
+		case SQL_BIT:
+		case SQL_TINYINT:
+		case SQL_SMALLINT:
+		case SQL_INTEGER:
+			c.cType = SQL_C_SLONG; c.width = 0; c.elementSize = sizeof(SQLINTEGER); break;
+		case SQL_BIGINT:
+			c.cType = SQL_C_SBIGINT; c.width = 0; c.elementSize = sizeof(SQLBIGINT); break;
+		case SQL_REAL:
+		case SQL_FLOAT:
+		case SQL_DOUBLE:
+			c.cType = SQL_C_DOUBLE; c.width = 0; c.elementSize = sizeof(double); break;
+		case SQL_DECIMAL:
+		case SQL_NUMERIC:
+			// Fetched as text, a double would lose digits of money and identifier columns. The size is the precision, add sign and decimal point
+			c.cType = SQL_C_WCHAR;
+			c.width = static_cast<size_t>(size) + 2;
+			c.elementSize = (c.width + 1) * sizeof(SQLWCHAR);
+			break;
+		default:
+			// Everything else (text, date, time, guid, ...) is fetched as text
+			c.cType = SQL_C_WCHAR;
+			c.width = ((size == 0 || size > m_maxStringLength) ? m_maxStringLength : static_cast<size_t>(size));
+			c.elementSize = (c.width + 1) * sizeof(SQLWCHAR);
+			break;
+		}
+		c.buffer.resize(c.elementSize * m_rowArraySize);
+		c.indicators.resize(m_rowArraySize);
+
+		if (!SQL_SUCCEEDED(SQLBindCol(m_handle, i + 1, c.cType, c.buffer.data(), static_cast<SQLLEN>(c.elementSize), c.indicators.data()))) {
+			throwError("Failed to bind a result column");
+		}
+	}
+}
+
+const ak::aMSSQLStatement::column & ak::aMSSQLStatement::columnOfType(size_t _column, SQLSMALLINT _cType) const {
+	assert(_column < m_columns.size());	// Index out of range
+	const column & c = m_columns[_column];
+	if (c.cType != _cType) { throw aMSSQLQueryException("The column is fetched as a different type"); }
+	return c;
+}
+
+void ak::aMSSQLStatement::throwError(const char * _text) const {
+	std::string message{ _text };
+	SQLWCHAR state[8];
+	SQLWCHAR text[1024];
+	SQLSMALLINT length = 0;
+	if (m_handle != nullptr && SQL_SUCCEEDED(SQLGetDiagRecW(SQL_HANDLE_STMT, m_handle, 1, state, NULL, text, 1024, &length))) {
+		message.append(": ").append(sqlTextToQString(text, (length < 1024 ? length : 1023)).toStdString());
+	}
+	throw aMSSQLQueryException(message.c_str());
+}
@@ -14,11 +14,14 @@
 
 #include <cassert>
 #include <sstream>
+#include <thread>
 #include <codecvt>
 
+#define MSSQL_DEFAULT_STATEMENT_CACHE_SIZE 32
+
 ak::aMSSQLWrapper::aMSSQLWrapper()
-	: m_environmentHandle(nullptr), m_connectionHandle(nullptr), m_lastQueryHandle(nullptr),
-	m_isConnected(false)
+	: m_environmentHandle(nullptr), m_connectionHandle(nullptr), m_lastQueryHandle(nullptr), m_activeStatement(nullptr), m_cancelsInProgress(0), m_statementCancelled(false),
+	m_isConnected(false), m_statementCacheSize(MSSQL_DEFAULT_STATEMENT_CACHE_SIZE), m_statementUseCounter(0)
 {}
 
 ak::aMSSQLWrapper::aMSSQLWrapper(
@@ -26,8 +29,8 @@ ak::aMSSQLWrapper::aMSSQLWrapper(
 	const std::string &		_port,
 	const std::string &		_userName,
 	const std::string &		_password
-) : m_environmentHandle(nullptr), m_connectionHandle(nullptr), m_lastQueryHandle(nullptr),
-	m_isConnected(false)
+) : m_environmentHandle(nullptr), m_connectionHandle(nullptr), m_lastQueryHandle(nullptr), m_activeStatement(nullptr), m_cancelsInProgress(0), m_statementCancelled(false),
+	m_isConnected(false), m_statementCacheSize(MSSQL_DEFAULT_STATEMENT_CACHE_SIZE), m_statementUseCounter(0)
 {
 	if (!connect(_ipAddress, _port, _userName, _password)) {
 		assert(0);
@@ -99,7 +102,8 @@ bool ak::aMSSQLWrapper::connect(
 	if (SQL_SUCCESS != SQLAllocHandle(SQL_HANDLE_DBC, m_environmentHandle, &m_connectionHandle)) { return false; }
 
 	// Try to connect
-	switch (SQLDriverConnect(m_connectionHandle, NULL, (SQLWCHAR*)_connectionString.c_str(),
+	QString connectionString{ QString::fromStdWString(_connectionString) };
+	switch (SQLDriverConnectW(m_connectionHandle, NULL, (SQLWCHAR*)sqlText(connectionString),
 		SQL_NTS, retconstring, 1024, NULL, SQL_DRIVER_NOPROMPT))
 	{
 	case SQL_SUCCESS:
@@ -115,6 +119,7 @@ bool ak::aMSSQLWrapper::connect(
 		throw std::exception("Unknown error");
 		break;
 	}
+	m_isConnected = true;
 	return true;
 }
 
@@ -131,8 +136,11 @@ SQLHANDLE ak::aMSSQLWrapper::executeQuery(const std::wstring & _query) {
 	}
 
 	// Executes a preparable statement
-	auto result = SQLExecDirectW(m_lastQueryHandle, (SQLWCHAR*)_query.c_str(), SQL_NTS);
-	if (SQL_SUCCESS != result) {
+	QString query{ QString::fromStdWString(_query) };
+	beginStatement(m_lastQueryHandle);
+	auto result = SQLExecDirectW(m_lastQueryHandle, (SQLWCHAR*)sqlText(query), SQL_NTS);
+	endStatement(result);
+	if (!SQL_SUCCEEDED(result) && result != SQL_NO_DATA) {
 		throw aMSSQLQueryException("Failed to execute query");
 	}
 	else {
@@ -140,20 +148,77 @@ SQLHANDLE ak::aMSSQLWrapper::executeQuery(const std::wstring & _query) {
 	}
 }
 
+std::shared_ptr<ak::aMSSQLStatement> ak::aMSSQLWrapper::prepare(const std::wstring & _query) {
+	auto itm = m_statementCache.find(_query);
+	if (itm != m_statementCache.end()) {
+		// The cached statement is only handed out if no other caller holds it, otherwise the caller gets its own statement
+		if (itm->second.statement.use_count() > 1) { return std::make_shared<aMSSQLStatement>(*this, _query); }
+		itm->second.lastUse = ++m_statementUseCounter;
+		return itm->second.statement;
+	}
+
+	if (m_statementCacheSize > 0) { trimStatementCache(m_statementCacheSize - 1); }
+	std::shared_ptr<aMSSQLStatement> statement = std::make_shared<aMSSQLStatement>(*this, _query);
+	if (m_statementCacheSize > 0) { m_statementCache[_query] = cachedStatement{ statement, ++m_statementUseCounter }; }
+	return statement;
+}
+
+void ak::aMSSQLWrapper::setStatementCacheSize(size_t _size) {
+	m_statementCacheSize = _size;
+	trimStatementCache(_size);
+}
+
 // ###################################################################################################################################
 
 // Getter
 
-bool ak::aMSSQLWrapper::tableExists(const std::wstring & _table) {
-	std::wstring query{ L"SELECT name FROM SYSOBJECTS WHERE xtype = 'U' AND name = '" };
-	query.append(_table).append(L"'");
+bool ak::aMSSQLWrapper::isConnectionAlive(void) {
+	if (!m_isConnected) { return false; }
+	SQLUINTEGER dead = SQL_CD_FALSE;
+	if (SQL_SUCCEEDED(SQLGetConnectAttr(m_connectionHandle, SQL_ATTR_CONNECTION_DEAD, &dead, 0, NULL))) { return dead == SQL_CD_FALSE; }
+
+	try {
+		auto statement = prepare(L"SELECT 1");
+		statement->execute();
+		statement->close();
+		return true;
+	}
+	catch (...) { return false; }
+}
 
-	auto handle = executeQuery(query);
+bool ak::aMSSQLWrapper::cancel(void) {
+	// The counter keeps the statement handle alive, endStatement() waits until it drops to zero
+	m_cancelsInProgress++;
+	SQLHANDLE statement = m_activeStatement.load();
+	bool cancelled{ statement != nullptr && SQL_SUCCEEDED(SQLCancel(statement)) };
+	m_cancelsInProgress--;
+	return cancelled;
+}
+
+void ak::aMSSQLWrapper::beginStatement(SQLHANDLE _statement) {
+	assert(m_activeStatement.load() == nullptr);	// Another statement is running
+	m_activeStatement.store(_statement);
+}
 
-	if (handle != NULL) {
-		return SQLFetch(handle) == SQL_SUCCESS;
+void ak::aMSSQLWrapper::endStatement(SQLRETURN _result) {
+	SQLHANDLE statement = m_activeStatement.exchange(nullptr);
+	while (m_cancelsInProgress.load() > 0) { std::this_thread::yield(); }
+
+	// Only a statement that failed with "Operation canceled" was actually cancelled, a cancel that arrived too late has no effect
+	if (_result != SQL_ERROR || statement == nullptr) { return; }
+	SQLWCHAR state[8];
+	if (SQL_SUCCEEDED(SQLGetDiagRecW(SQL_HANDLE_STMT, statement, 1, state, NULL, NULL, 0, NULL))) {
+		if (sqlTextToQString(state, 5) == "HY008") { m_statementCancelled = true; }
 	}
-	return false;
+}
+
+bool ak::aMSSQLWrapper::tableExists(const std::wstring & _table) {
+	auto statement = prepare(L"SELECT name FROM SYSOBJECTS WHERE xtype = 'U' AND name = ?");
+	statement->bind(0, _table);
+	statement->execute();
+	bool exists{ statement->fetchBlock() > 0 };
+	statement->close();
+	return exists;
 }
 
 // ####################################################################################################################################
@@ -176,14 +241,14 @@ std::wstring ak::aMSSQLWrapper::getSQLError(unsigned int _handleType, const SQLH
 {
 	SQLWCHAR SQLState[1024];
 	SQLWCHAR message[1024];
-	if (SQL_SUCCESS == SQLGetDiagRec(_handleType, _handle, 1, SQLState, NULL, message, 1024, NULL)) {
+	if (SQL_SUCCESS == SQLGetDiagRecW(_handleType, _handle, 1, SQLState, NULL, message, 1024, NULL)) {
 		// Returns the current values of multiple fields of a diagnostic record that contains error, warning, and status information
 		std::wstringstream ss;
 		if (_includeState) {
-			ss << L"SQL state: " << SQLState << L", SQL driver message: " << message << L"\n";
+			ss << L"SQL state: " << sqlTextToWString(SQLState) << L", SQL driver message: " << sqlTextToWString(message) << L"\n";
 		}
 		else {
-			ss << message;
+			ss << sqlTextToWString(message);
 		}
 		return ss.str();
 	}
@@ -212,15 +277,30 @@ void ak::aMSSQLWrapper::freeHandle(SQLHANDLE & _handle, unsigned int _handleType
 
 // Private functions
 
+void ak::aMSSQLWrapper::trimStatementCache(size_t _size) {
+	while (m_statementCache.size() > _size) {
+		auto oldest = m_statementCache.begin();
+		for (auto itm = m_statementCache.begin(); itm != m_statementCache.end(); itm++) {
+			if (itm->second.lastUse < oldest->second.lastUse) { oldest = itm; }
+		}
+		m_statementCache.erase(oldest);
+	}
+}
+
 void ak::aMSSQLWrapper::deallocateHandles(void) {
 	freeLastQueryHandle();
 
+	// The statement handles must be freed before the connection, statements still referenced elsewhere become unusable
+	for (auto & itm : m_statementCache) { itm.second.statement->release(); }
+	m_statementCache.clear();
+
 	if (m_connectionHandle != NULL) {
 		// Free the resources and disconnect
-		SQLDisconnect(m_connectionHandle);
+		if (m_isConnected) { SQLDisconnect(m_connectionHandle); }
 		freeHandle(m_connectionHandle, SQL_HANDLE_DBC);
-		freeHandle(m_environmentHandle, SQL_HANDLE_ENV);
 	}
+	// The environment is also allocated if the connection failed
+	freeHandle(m_environmentHandle, SQL_HANDLE_ENV);
 	m_isConnected = false;
 }
 
@@ -0,0 +1,100 @@
+/*
+ *	File:		aChunkedPopulator.cpp
+ *	Package:	akGui
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akGui/aChunkedPopulator.h>
+
+// Qt header
+#include <qelapsedtimer.h>
+
+#define CHUNKED_POPULATOR_DEFAULT_BUDGET 8
+#define CHUNKED_POPULATOR_CLOCK_INTERVAL 16
+
+ak::aChunkedPopulator::aChunkedPopulator(QObject * _parent)
+	: QObject(_parent), m_count(0), m_expectedCount(-1), m_timeBudget(CHUNKED_POPULATOR_DEFAULT_BUDGET), m_isRunning(false)
+{
+	// A zero interval timer times out once per event loop iteration
+	m_timer.setInterval(0);
+	connect(&m_timer, &QTimer::timeout, this, &aChunkedPopulator::slotProcessChunk);
+}
+
+ak::aChunkedPopulator::~aChunkedPopulator() { m_timer.stop(); }
+
+void ak::aChunkedPopulator::start(
+	const stepFunction &		_step,
+	int							_expectedCount
+) {
+	assert(_step);	// No step function provided
+	if (m_isRunning) { cancel(); }
+	m_step = _step;
+	m_count = 0;
+	m_expectedCount = _expectedCount;
+	m_isRunning = true;
+	m_timer.start();
+}
+
+void ak::aChunkedPopulator::cancel(void) {
+	if (m_isRunning) { stop(true); }
+}
+
+void ak::aChunkedPopulator::setTimeBudget(
+	int							_milliseconds
+) {
+	assert(_milliseconds > 0);	// Invalid budget
+	m_timeBudget = _milliseconds;
+}
+
+// ###########################################################################################################################################
+
+// Private slots
+
+void ak::aChunkedPopulator::slotProcessChunk(void) {
+	emit chunkStarted();
+
+	QElapsedTimer clock;
+	clock.start();
+	int next = m_count + CHUNKED_POPULATOR_CLOCK_INTERVAL;
+	for (;;) {
+		bool hasMore{ false };
+		try { hasMore = m_step(m_count); }
+		catch (...) {
+			// Stop the population so the receivers restore their state (e.g. the updates disabled at chunkStarted)
+			if (m_isRunning) { stop(true); }
+			throw;
+		}
+		if (!hasMore) {
+			emit progress(m_count, m_expectedCount);
+			stop(false);
+			return;
+		}
+
+		// The step may have cancelled the population
+		if (!m_isRunning) { return; }
+
+		// Only query the clock every few items
+		if (++m_count == next) {
+			if (clock.elapsed() >= m_timeBudget) { break; }
+			next += CHUNKED_POPULATOR_CLOCK_INTERVAL;
+		}
+	}
+	emit progress(m_count, m_expectedCount);
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+void ak::aChunkedPopulator::stop(bool _cancelled) {
+	m_timer.stop();
+	m_isRunning = false;
+	emit finished(m_count, _cancelled);
+}
@@ -16,7 +16,53 @@
 
 // C++ header
 #include <string>				// C++ string
-#include <sstream>				// string stream
+
+namespace {
+
+	const char hexDigits[] = "0123456789abcdef";
+
+	//! @brief Writes the two digit hex representation of the channel value and returns the position after it
+	inline char * writeHexChannel(char * _pos, int _value) {
+		_pos[0] = hexDigits[(_value >> 4) & 0xf];
+		_pos[1] = hexDigits[_value & 0xf];
+		return _pos + 2;
+	}
+
+	//! @brief Returns the decimal representation of the channel value (0 - 255)
+	const char * channelString(int _value) {
+		// All strings are built once, channel values are limited to 256 entries
+		static const struct channelStrings {
+			char		str[256][4];
+			channelStrings() {
+				for (int i = 0; i < 256; i++) {
+					int p{ 0 };
+					if (i >= 100) { str[i][p++] = static_cast<char>('0' + i / 100); }
+					if (i >= 10) { str[i][p++] = static_cast<char>('0' + (i / 10) % 10); }
+					str[i][p++] = static_cast<char>('0' + i % 10);
+					str[i][p] = 0;
+				}
+			}
+		} strings;
+		assert(_value >= 0 && _value <= 255);	// Invalid channel value
+		return strings.str[_value & 0xff];
+	}
+
+	//! @brief Writes the channel values separated by the delimiter, the output is truncated to the buffer size
+	int writeChannels(char * _buffer, int _bufferSize, const char * _delimiter, const int * _channels, int _count) {
+		assert(_buffer != nullptr && _bufferSize > 0);	// Invalid buffer
+		int length{ 0 };
+		auto write = [&](const char * _str) {
+			for (; *_str != 0 && length < _bufferSize - 1; _str++) { _buffer[length++] = *_str; }
+		};
+		for (int i = 0; i < _count; i++) {
+			if (i > 0 && _delimiter != nullptr) { write(_delimiter); }
+			write(channelString(_channels[i]));
+		}
+		_buffer[length] = 0;
+		return length;
+	}
+
+}
 
 ak::aColor::aColor()
 :	m_a(255),
@@ -32,7 +78,7 @@ ak::aColor::aColor(
 	int				_b,
 	int				_a
 ) : m_wasChanged(false) {
-	try {
+	A_TRY {
 		if (_a < 0 || _a > 255) { assert(0); throw aException("Value out of range", "Check alpha channel value"); }
 		if (_r < 0 || _r > 255) { assert(0); throw aException("Value out of range", "Check red channel value"); }
 		if (_g < 0 || _g > 255) { assert(0); throw aException("Value out of range", "Check green channel value"); }
@@ -42,9 +88,7 @@ ak::aColor::aColor(
 		m_g = _g;
 		m_b = _b;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColor::aColor()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColor::aColor()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColor::aColor()"); }
+	A_CATCH_FORWARD("ak::aColor::aColor()")
 }
 
 ak::aColor::aColor(
@@ -121,53 +165,45 @@ ak::aColor::~aColor(){}
 void ak::aColor::setA(
 	int					_a
 ) {
-	try {
+	A_TRY {
 		if (_a < 0 || _a > 255) { assert(0); throw aException("Value out of range", "Check alpha channel value"); }
 		m_a = _a;
 		m_wasChanged = true;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColor::setA()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColor::setA()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColor::setA()"); }
+	A_CATCH_FORWARD("ak::aColor::setA()")
 }
 
 void ak::aColor::setR(int
 	_r
 ) {
-	try {
+	A_TRY {
 		if (_r < 0 || _r > 255) { assert(0); throw aException("Value out of range", "Check red channel value"); }
 		m_r = _r;
 		m_wasChanged = true;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColor::setR()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColor::setR()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColor::setR()"); }
+	A_CATCH_FORWARD("ak::aColor::setR()")
 }
 
 void ak::aColor::setG(
 	int					_g
 ) {
-	try {
+	A_TRY {
 		if (_g < 0 || _g > 255) { assert(0); throw aException("Value out of range", "Check green channel value"); }
 		m_g = _g;
 		m_wasChanged = true;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColor::setG()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColor::setG()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColor::setG()"); }
+	A_CATCH_FORWARD("ak::aColor::setG()")
 }
 
 void ak::aColor::setB(int
 	_b
 ) {
-	try {
+	A_TRY {
 		if (_b < 0 || _b > 255) { assert(0); throw aException("Value out of range", "Check blue channel value"); }
 		m_b = _b;
 		m_wasChanged = true;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColor::setB()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColor::setB()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColor::setB()"); }
+	A_CATCH_FORWARD("ak::aColor::setB()")
 }
 
 void ak::aColor::setRGBA(
@@ -176,7 +212,7 @@ void ak::aColor::setRGBA(
 	int				_b,
 	int				_a
 ) {
-	try {
+	A_TRY {
 		if (_a < 0 || _a > 255) { assert(0); throw aException("Value out of range", "Check alpha channel value"); }
 		if (_r < 0 || _r > 255) { assert(0); throw aException("Value out of range", "Check red channel value"); }
 		if (_g < 0 || _g > 255) { assert(0); throw aException("Value out of range", "Check green channel value"); }
@@ -187,9 +223,7 @@ void ak::aColor::setRGBA(
 		m_b = _b;
 		m_wasChanged = true;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColor::setRGBA()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColor::setRGBA()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColor::setRGBA()"); }
+	A_CATCH_FORWARD("ak::aColor::setRGBA()")
 }
 
 // Get aColor
@@ -216,18 +250,12 @@ QString ak::aColor::toHexString(
 	bool				_includeA,
 	const QString &		_prefix
 ) {
-	QString out = _prefix;
-	QString v = "";
-	if (_includeA) {
-		v = ak::toHexString(_color.m_a, 2);
-		out.append(v);
-	}
-	v = ak::toHexString(_color.m_r, 2);
-	out.append(v);
-	v = ak::toHexString(_color.m_g, 2);
-	out.append(v);
-	v = ak::toHexString(_color.m_b, 2);
-	out.append(v);
+	char buffer[hexStringBufferSize];
+	int length{ _color.toHexString(buffer, _includeA) };
+	QString out;
+	out.reserve(_prefix.length() + length);
+	out.append(_prefix);
+	out.append(QLatin1String(buffer, length));
 	return out;
 }
 
@@ -236,45 +264,90 @@ QString ak::aColor::toHexString(
 	bool				_includeA,
 	const QString &		_prefix
 ) {
-	QString out = _prefix;
-	QString v = "";
-	if (_includeA) {
-		v = ak::toHexString(_color.alpha(), 2);
-		out.append(v);
-	}
-	v = ak::toHexString(_color.red(), 2);
-	out.append(v);
-	v = ak::toHexString(_color.green(), 2);
-	out.append(v);
-	v = ak::toHexString(_color.blue(), 2);
-	out.append(v);
+	char buffer[hexStringBufferSize];
+	int length{ toHexString(_color, buffer, _includeA) };
+	QString out;
+	out.reserve(_prefix.length() + length);
+	out.append(_prefix);
+	out.append(QLatin1String(buffer, length));
 	return out;
 }
 
 QString ak::aColor::toRGBString(
 	const QString &		_delimiter
 ) const {
-	QString out = QString::number(m_r);
+	QString out;
+	out.reserve(11 + 2 * _delimiter.length());
+	out.append(QLatin1String(channelString(m_r)));
 	out.append(_delimiter);
-	out.append(QString::number(m_g));
+	out.append(QLatin1String(channelString(m_g)));
 	out.append(_delimiter);
-	out.append(QString::number(m_b));
+	out.append(QLatin1String(channelString(m_b)));
 	return out;
 }
 
 QString ak::aColor::toARGBString(
 	const QString &		_delimiter
 ) const {
-	QString out = QString::number(m_a);
+	QString out;
+	out.reserve(15 + 3 * _delimiter.length());
+	out.append(QLatin1String(channelString(m_a)));
 	out.append(_delimiter);
-	out.append(QString::number(m_r));
+	out.append(QLatin1String(channelString(m_r)));
 	out.append(_delimiter);
-	out.append(QString::number(m_g));
+	out.append(QLatin1String(channelString(m_g)));
 	out.append(_delimiter);
-	out.append(QString::number(m_b));
+	out.append(QLatin1String(channelString(m_b)));
 	return out;
 }
 
+int ak::aColor::toHexString(
+	char *				_buffer,
+	bool				_includeA
+) const {
+	assert(_buffer != nullptr);	// Nullptr provided
+	char * pos{ _buffer };
+	if (_includeA) { pos = writeHexChannel(pos, m_a); }
+	pos = writeHexChannel(pos, m_r);
+	pos = writeHexChannel(pos, m_g);
+	pos = writeHexChannel(pos, m_b);
+	*pos = 0;
+	return static_cast<int>(pos - _buffer);
+}
+
+int ak::aColor::toHexString(
+	const QColor &		_color,
+	char *				_buffer,
+	bool				_includeA
+) {
+	assert(_buffer != nullptr);	// Nullptr provided
+	char * pos{ _buffer };
+	if (_includeA) { pos = writeHexChannel(pos, _color.alpha()); }
+	pos = writeHexChannel(pos, _color.red());
+	pos = writeHexChannel(pos, _color.green());
+	pos = writeHexChannel(pos, _color.blue());
+	*pos = 0;
+	return static_cast<int>(pos - _buffer);
+}
+
+int ak::aColor::toRGBString(
+	char *				_buffer,
+	int					_bufferSize,
+	const char *		_delimiter
+) const {
+	const int channels[] = { m_r, m_g, m_b };
+	return writeChannels(_buffer, _bufferSize, _delimiter, channels, 3);
+}
+
+int ak::aColor::toARGBString(
+	char *				_buffer,
+	int					_bufferSize,
+	const char *		_delimiter
+) const {
+	const int channels[] = { m_a, m_r, m_g, m_b };
+	return writeChannels(_buffer, _bufferSize, _delimiter, channels, 4);
+}
+
 QColor ak::aColor::toQColor(void) const
 { return QColor(m_r, m_g, m_b, m_a); }
 
@@ -284,10 +357,5 @@ QString ak::toHexString(
 	int					_value,
 	int					_minimumLength
 ) {
-	std::stringstream stream;
-	stream << std::hex << _value;
-	QString out = "";
-	std::string str = stream.str();
-	for (int i = str.length(); i < _minimumLength; i++) { out.append("0"); }
-	return QString(out.append(str.c_str()));
+	return QString::number(static_cast<uint>(_value), 16).rightJustified(_minimumLength, '0');
 }
@@ -21,7 +21,7 @@
 QString ak::aColorStyle::getFilePath(
 	const QString &			_fileName
 ) const {
-	try {
+	A_TRY {
 		// Search in all directories for the file
 		for (int i = 0; i < m_directories.size(); i++) {
 			try {
@@ -51,7 +51,63 @@ QString ak::aColorStyle::getFilePath(
 		throw aException(QString(QString("The requested file: \"") + QString(_fileName) + QString("\" does not exist in the icon search directories")).toStdString(),
 			"Find file", aException::exceptionType::FileNotFound);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aColorStyle::getFilePath()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aColorStyle::getFilePath()"); }
-	catch (...) { throw aException("Unknown error", "ak::aColorStyle::getFilePath()"); }
+	A_CATCH_FORWARD("ak::aColorStyle::getFilePath()")
+}
+
+const ak::aColorStyle::paletteEntry & ak::aColorStyle::getPaletteEntry(
+	colorRole					_role
+) const {
+	assert(_role >= 0 && _role < crCount);	// Invalid color role
+	if (!m_paletteIsValid) { buildPalette(); }
+	return m_palette[_role];
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+const ak::aColor & ak::aColorStyle::roleColor(colorRole _role) const {
+	switch (_role)
+	{
+	case crWindowMainForeground: return m_windowMainForecolor;
+	case crWindowMainBackground: return m_windowMainBackcolor;
+	case crControlsMainForeground: return m_controlsMainForecolor;
+	case crControlsMainBackground: return m_controlsMainBackcolor;
+	case crControlsErrorFrontForeground: return m_controlsErrorFrontForecolor;
+	case crControlsErrorBackForeground: return m_controlsErrorBackForecolor;
+	case crControlsErrorBackBackground: return m_controlsErrorBackBackcolor;
+	case crControlsFocusedBackground: return m_controlsFocusBackColor;
+	case crControlsFocusedForeground: return m_controlsFocusForeColor;
+	case crControlsPressedForeground: return m_controlsPressedForeColor;
+	case crControlsPressedBackground: return m_controlsPressedBackColor;
+	case crControlsBorder: return m_controlsBorderColor;
+	case crAlternateForeground: return m_alternateForeColor;
+	case crAlternateBackground: return m_alternateBackColor;
+	case crHeaderForeground: return m_headerForeColor;
+	case crHeaderBackground: return m_headerBackColor;
+	case crHeaderBorder: return m_headerBorderColor;
+	default:
+		assert(0);	// Unknown color role
+		return m_windowMainForecolor;
+	}
+}
+
+void ak::aColorStyle::buildPalette(void) const {
+	char buffer[aColor::channelStringBufferSize];
+	for (int i = 0; i < crCount; i++) {
+		const aColor & color = roleColor(static_cast<colorRole>(i));
+		paletteEntry & entry = m_palette[i];
+		entry.color = color.toQColor();
+
+		int length{ color.toHexString(buffer, true) };
+		entry.hexWithAlpha = QString::fromLatin1(buffer, length);
+		entry.hex = entry.hexWithAlpha.right(6);
+
+		// Stylesheets expect the RGBA order
+		int channels{ color.toRGBString(buffer, aColor::channelStringBufferSize, ", ") };
+		entry.rgba.clear();
+		entry.rgba.reserve(channels + 12);
+		entry.rgba.append("rgba(").append(QLatin1String(buffer, channels)).append(", ").append(QString::number(color.a())).append(")");
+	}
+	m_paletteIsValid = true;
 }
@@ -207,7 +207,7 @@ QIcon * ak::aIconManager::createIcon(
 	const QString &									_iconSize
 ) {
 	// Mutex not required, caller must take care of the mutex
-	try {
+	A_TRY {
 		for (int i = 0; i < m_directories.size(); i++) {
 			QFile file(m_directories.at(i) + _iconSize + '/' + _iconName + m_fileExtension);
 			// Check if the file exist
@@ -219,16 +219,14 @@ QIcon * ak::aIconManager::createIcon(
 		}
 		throw aException("Icon does not exist", "Check status");
 	}
-	catch (const aException & e) { throw aException(e, "ak::aIconManager::createIcon()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aIconManager::createIcon()"); }
-	catch (...) { throw aException("Unknown error", "ak::aIconManager::createIcon()"); }
+	A_CATCH_FORWARD("ak::aIconManager::createIcon()")
 }
 
 QPixmap * ak::aIconManager::createPixmap(
 	const QString &									_imageName
 ) {
 	// Mutex not required, caller must take care of the mutex
-	try {
+	A_TRY {
 		for (int i = 0; i < m_directories.size(); i++) {
 			QFile file(m_directories.at(i) + PATH_PIXMAPS + _imageName + m_fileExtension);
 			// Check if the file exist
@@ -241,16 +239,14 @@ QPixmap * ak::aIconManager::createPixmap(
 		}
 		throw aException("Image does not exist", "Check status");
 	}
-	catch (const aException & e) { throw aException(e, "ak::aIconManager::createPixmap()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aIconManager::createPixmap()"); }
-	catch (...) { throw aException("Unknown error", "ak::aIconManager::createPixmap()"); }
+	A_CATCH_FORWARD("ak::aIconManager::createPixmap()")
 }
 
 QMovie * ak::aIconManager::createMovie(
 	const QString &									_imageName
 ) {
 	// Mutex not required, caller must take care of the mutex
-	try {
+	A_TRY {
 		for (int i = 0; i < m_directories.size(); i++) {
 			QFile file(m_directories.at(i) + PATH_MOVIES + _imageName + ".gif");
 			// Check if the file exist
@@ -263,9 +259,7 @@ QMovie * ak::aIconManager::createMovie(
 		}
 		throw aException("Movie does not exist", "Check status");
 	}
-	catch (const aException & e) { throw aException(e, "ak::aIconManager::createMovie()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aIconManager::createMovie()"); }
-	catch (...) { throw aException("Unknown error", "ak::aIconManager::createMovie()"); }
+	A_CATCH_FORWARD("ak::aIconManager::createMovie()")
 }
 
 std::vector<QString> ak::aIconManager::searchDirectories(void) const { return m_directories; }
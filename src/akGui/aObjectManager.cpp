@@ -12,6 +12,7 @@
 
 // C++ header
 #include <string>
+#include <list>
 
 // AK Core header
 #include <akCore/akCore.h>
@@ -19,6 +20,8 @@
 #include <akCore/aNotifierObjectManager.h>
 #include <akCore/aObject.h>
 #include <akCore/rJSON.h>
+#include <akCore/rJSONStream.h>
+#include <akCore/aStateSnapshot.h>
 #include <akCore/aUidMangager.h>
 
 // AK Dialogs
@@ -35,6 +38,7 @@
 #include <akGui/aObjectManager.h>
 #include <akGui/aPaintable.h>
 #include <akGui/aRestorable.h>
+#include <akGui/aTtbLayout.h>
 #include <akGui/aSignalLinker.h>
 #include <akGui/aSpecialTabBar.h>
 #include <akGui/aTimer.h>
@@ -50,10 +54,12 @@
 #include <akWidgets/aLabelWidget.h>
 #include <akWidgets/aLineEditWidget.h>
 #include <akWidgets/aListWidget.h>
+#include <akWidgets/aLogViewWidget.h>
 #include <akWidgets/aNiceLineEditWidget.h>
 #include <akWidgets/aPropertyGridWidget.h>
 #include <akWidgets/aPushButtonWidget.h>
 #include <akWidgets/aTableWidget.h>
+#include <akWidgets/aTableViewWidget.h>
 #include <akWidgets/aTabWidget.h>
 #include <akWidgets/aTextEditWidget.h>
 #include <akWidgets/aToolButtonWidget.h>
@@ -79,7 +85,8 @@ ak::aObjectManager::aObjectManager(
 	m_messenger(nullptr),
 	m_signalLinker(nullptr),
 	m_uidManager(nullptr),
-	m_notifier(nullptr)
+	m_notifier(nullptr),
+	m_stateSnapshot(nullptr)
 {
 	// Check parameter
 	assert(_messenger != nullptr); // nullptr provided
@@ -100,7 +107,7 @@ ak::aObjectManager::aObjectManager(
 	m_colorStyles.push_back(new aColorStyleDefaultDark);
 }
 
-ak::aObjectManager::~aObjectManager() {}
+ak::aObjectManager::~aObjectManager() { if (m_stateSnapshot != nullptr) { delete m_stateSnapshot; } }
 
 // ###############################################################################################################################################
 
@@ -300,6 +307,21 @@ ak::UID ak::aObjectManager::createLogInDialog(
 	return obj->uid();
 }
 
+ak::UID ak::aObjectManager::createLogView(
+	UID												_creatorUid,
+	int													_maximumLineCount
+) {
+	// Create object
+	aLogViewWidget * obj = new aLogViewWidget(_maximumLineCount);
+	// Set parameter
+	m_signalLinker->addLink(obj);
+	if (m_currentColorStyle != nullptr) { obj->setColorStyle(m_currentColorStyle); }
+	// Store data
+	m_mapObjects.insert_or_assign(obj->uid(), obj);
+	addCreatedUid(_creatorUid, obj->uid());
+	return obj->uid();
+}
+
 ak::UID ak::aObjectManager::createNiceLineEdit(
 	UID												_creatorUid,
 	const QString &										_initialText,
@@ -404,6 +426,22 @@ ak::UID ak::aObjectManager::createTable(
 	return obj->uid();
 }
 
+ak::UID ak::aObjectManager::createTableView(
+	UID												_creatorUid,
+	int													_rows,
+	int													_columns
+) {
+	// Create object
+	aTableViewWidget * obj = new aTableViewWidget(_rows, _columns);
+	// Set parameter
+	if (m_currentColorStyle != nullptr) { obj->setColorStyle(m_currentColorStyle); }
+	m_signalLinker->addLink(obj);
+	// Store data
+	m_mapObjects.insert_or_assign(obj->uid(), obj);
+	addCreatedUid(_creatorUid, obj->uid());
+	return obj->uid();
+}
+
 ak::UID ak::aObjectManager::createTextEdit(
 	UID												_creatorUid,
 	const QString &										_initialText
@@ -583,6 +621,36 @@ ak::UID ak::aObjectManager::createTabToolBarPage(
 	return cont->uid();
 }
 
+void ak::aObjectManager::buildTabToolBar(
+	UID												_creatorUid,
+	UID												_uiManagerUid,
+	const aTtbLayout &								_layout,
+	bool											_deferHiddenPages
+) {
+	// Find object
+	auto itm = m_mapObjects.find(_uiManagerUid);
+	assert(itm != m_mapObjects.end()); // Invalid object UID provided
+	assert(itm->second->type() == otMainWindow); // Invalid object type provided
+	aWindowManager * ui = nullptr;
+	ui = dynamic_cast<aWindowManager *>(itm->second);
+	assert(ui != nullptr); // Cast failed
+
+	ui->beginTabToolBarUpdate();
+	for (auto const & page : _layout.pages()) {
+		UID pageUid = createTabToolBarPage(_creatorUid, _uiManagerUid, page.text);
+		aTtbPage * p = dynamic_cast<aTtbPage *>(m_mapObjects.find(pageUid)->second);
+		assert(p != nullptr); // Cast failed
+
+		if (_deferHiddenPages && p->index() != ui->currentTabToolbarTab()) {
+			// The page entry is copied, the layout may be gone when the page is shown
+			aTtbLayout::pageEntry entry{ page };
+			p->setDeferredBuild([this, _creatorUid, pageUid, entry]() { buildTabToolBarPage(_creatorUid, pageUid, entry); });
+		}
+		else { buildTabToolBarPage(_creatorUid, pageUid, page); }
+	}
+	ui->endTabToolBarUpdate();
+}
+
 /*
 ak::UID ak::aObjectManager::createWelcomeScreen(
 	UID												_creatorUid
@@ -805,22 +873,44 @@ void ak::aObjectManager::destroyAll(void) {
 std::string ak::aObjectManager::saveStateWindow(
 	const std::string &									_applicationVersion
 ) {
-	// Prepare document
-	AK_rJSON_createDOC(doc);
-	ak::rJSON::add(doc, SETTING_VERSION_APPLICATION, _applicationVersion);
-	ak::rJSON::add(doc, SETTING_VERSION_WINDOWSTATE, CONFIG_VERSION_WINDOWSTATE);
-
-	AK_rJSON_createValueArray(items);
+	// The state is written directly to the output buffer, no document is created
+	rJSONStreamWriter writer;
+	writer.startObject();
+	writer.member(SETTING_VERSION_APPLICATION, _applicationVersion);
+	writer.member(SETTING_VERSION_WINDOWSTATE, CONFIG_VERSION_WINDOWSTATE);
+
+	writer.key(RESTORABLE_UI_SETTINGS);
+	writer.startArray();
 	for (auto itm = m_mapAliases.begin(); itm != m_mapAliases.end(); itm++) {
 		auto obj = m_mapObjects.find(itm->second);
 		ak::aRestorable * restorable = nullptr;
 		restorable = dynamic_cast<ak::aRestorable *>(obj->second);
 		assert(restorable != nullptr); // Upps
-		restorable->addObjectSettingsToValue(items, doc.GetAllocator());
+		restorable->writeObjectSettings(writer);
 	}
+	writer.endArray();
+	writer.endObject();
 
-	ak::rJSON::add(doc, RESTORABLE_UI_SETTINGS, items);
-	return ak::rJSON::toJSON(doc);
+	assert(writer.isComplete());	// A restorable wrote an incomplete value
+	return writer.toString();
+}
+
+std::string ak::aObjectManager::saveStateWindowBinary(
+	const std::string &									_applicationVersion,
+	bool												_compress
+) {
+	aStateSnapshot snapshot;
+	snapshot.setApplicationVersion(_applicationVersion);
+
+	// Every restorable writes its entries directly into the snapshot
+	for (auto itm = m_mapAliases.begin(); itm != m_mapAliases.end(); itm++) {
+		auto obj = m_mapObjects.find(itm->second);
+		ak::aRestorable * restorable = nullptr;
+		restorable = dynamic_cast<ak::aRestorable *>(obj->second);
+		assert(restorable != nullptr); // Upps
+		restorable->writeObjectSettings(snapshot);
+	}
+	return snapshot.toBinary(_compress);
 }
 
 std::string ak::aObjectManager::saveStateColorStyle(
@@ -846,61 +936,127 @@ ak::settingsRestoreErrorCode ak::aObjectManager::restoreStateWindow(
 	const char *										_json,
 	const std::string &									_applicationVersion
 ) {
-	rapidjson::Document doc;
-	doc.Parse(_json);
+	// The state is read token by token, only the settings object of every entry is materialized.
+	// All entries are read before the first one is applied, so malformed input does not leave a partially restored UI
+	rJSONStreamReader reader(_json);
+	if (reader.next() != rJSONStreamReader::tkStartObject) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+
+	struct stateEntry {
+		QString					alias;
+		QString					type;
+		rapidjson::Document		settings;
+	};
+
+	std::string settingVersionApp;
+	std::string settingVersionWindowState;
+	std::list<stateEntry> entries;
+
+	while (reader.next() == rJSONStreamReader::tkKey) {
+		if (reader.is(SETTING_VERSION_APPLICATION) || reader.is(SETTING_VERSION_WINDOWSTATE)) {
+			std::string & version = (reader.is(SETTING_VERSION_APPLICATION) ? settingVersionApp : settingVersionWindowState);
+			if (reader.next() != rJSONStreamReader::tkString) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+			version = reader.string();
+		}
+		else if (reader.is(RESTORABLE_UI_SETTINGS)) {
+			if (reader.next() != rJSONStreamReader::tkStartArray) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+
+			// Go trough all items in the array
+			while (reader.next() == rJSONStreamReader::tkStartObject) {
+				stateEntry entry;
+				bool hasSettings{ false };
+				while (reader.next() == rJSONStreamReader::tkKey) {
+					if (reader.is(RESTORABLE_NAME_ALIAS)) {
+						if (reader.next() != rJSONStreamReader::tkString) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+						entry.alias = QString::fromStdString(reader.string());
+					}
+					else if (reader.is(RESTORABLE_NAME_TYPE)) {
+						if (reader.next() != rJSONStreamReader::tkString) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+						entry.type = QString::fromStdString(reader.string());
+					}
+					else if (reader.is(RESTORABLE_NAME_SETTINGS)) {
+						if (reader.next() != rJSONStreamReader::tkStartObject) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+						hasSettings = reader.readValue(entry.settings);
+					}
+					else {
+						reader.next();
+						reader.skipValue();
+					}
+				}
+				if (reader.token() != rJSONStreamReader::tkEndObject) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+				assert(!entry.alias.isEmpty());								// Does not contain name
+				assert(!entry.type.isEmpty());								// Does not contain type
+				assert(hasSettings);										// Does not contain settings
+				if (!hasSettings) { continue; }
+				entries.push_back(std::move(entry));
+			}
+			if (reader.token() != rJSONStreamReader::tkEndArray) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
+		}
+		else {
+			reader.next();
+			reader.skipValue();
+		}
+	}
+	if (reader.token() != rJSONStreamReader::tkEndObject) { return ak::settingsRestoreErrorCode::srecInvalidFormat; }
 
-	// Check version
-	if (!doc.HasMember(SETTING_VERSION_APPLICATION) ||
-		!doc.HasMember(SETTING_VERSION_WINDOWSTATE)) {
+	if (settingVersionApp.empty() || settingVersionWindowState.empty()) {
+		// The versions are missing
 		return ak::settingsRestoreErrorCode::srecSettingsVersionMismatch;
 	}
-	assert(doc[SETTING_VERSION_APPLICATION].IsString());
-	assert(doc[SETTING_VERSION_WINDOWSTATE].IsString());
-	std::string settingVersionApp(doc[SETTING_VERSION_APPLICATION].GetString());
-	std::string settingVersionWindowState(doc[SETTING_VERSION_WINDOWSTATE].GetString());
-	if (_applicationVersion != settingVersionApp) { return ak::settingsRestoreErrorCode::srecAppVersionMismatch; }
-	if (CONFIG_VERSION_WINDOWSTATE != settingVersionWindowState) { return ak::settingsRestoreErrorCode::srecSettingsVersionMismatch; }
-
-	// Check document
-	assert(doc.HasMember(RESTORABLE_UI_SETTINGS));	// Member missing
-	assert(doc[RESTORABLE_UI_SETTINGS].IsArray());	// Invalid type
-	rapidjson::Value UIsettings = doc[RESTORABLE_UI_SETTINGS].GetArray();
+	settingsRestoreErrorCode result = checkStateVersion(settingVersionApp, settingVersionWindowState, _applicationVersion);
+	if (result != ak::settingsRestoreErrorCode::srecNone) { return result; }
 
-	// Go trough all items in the array
-	for (rapidjson::Value::ConstValueIterator itm = UIsettings.Begin(); itm != UIsettings.End(); itm++) {
-		const rapidjson::Value & obj = *itm;
-		assert(obj.IsObject());									// Stored item is not an object
-		assert(obj.HasMember(RESTORABLE_NAME_ALIAS));			// Does not contain name
-		assert(obj.HasMember(RESTORABLE_NAME_TYPE));			// Does not contain type
-		assert(obj.HasMember(RESTORABLE_NAME_SETTINGS));		// Does not contain settings
-		assert(obj[RESTORABLE_NAME_ALIAS].IsString());			// Alias is not a string
-		assert(obj[RESTORABLE_NAME_TYPE].IsString());			// Type is not a string
-		assert(obj[RESTORABLE_NAME_SETTINGS].IsObject());		// Settins is not an object
+	for (auto & entry : entries) { restoreObjectSettings(entry.alias, entry.type, entry.settings); }
+	return ak::settingsRestoreErrorCode::srecNone;
+}
 
-		QString objAlias = QString(obj[RESTORABLE_NAME_ALIAS].GetString());
-		QString objType = QString(obj[RESTORABLE_NAME_TYPE].GetString());
+ak::settingsRestoreErrorCode ak::aObjectManager::restoreStateWindowBinary(
+	const std::string &									_data,
+	const std::string &									_applicationVersion
+) {
+	aStateSnapshot * snapshot = new aStateSnapshot;
+	aStateSnapshot::readResult readResult = snapshot->fromBinary(_data.c_str(), _data.length());
+	if (readResult != aStateSnapshot::rrOk) {
+		delete snapshot;
+		return (readResult == aStateSnapshot::rrUnsupportedVersion ? ak::settingsRestoreErrorCode::srecSettingsVersionMismatch : ak::settingsRestoreErrorCode::srecInvalidFormat);
+	}
+	if (snapshot->applicationVersion() != _applicationVersion) {
+		delete snapshot;
+		return ak::settingsRestoreErrorCode::srecAppVersionMismatch;
+	}
 
-		// Check if an object with the provided alias exist
-		auto oAlias = m_mapAliases.find(objAlias);
-		assert(oAlias != m_mapAliases.end()); // No object with specified alias exists
+	// Replace the previous snapshot
+	if (m_stateSnapshot != nullptr) { delete m_stateSnapshot; }
+	m_stateSnapshot = snapshot;
+	m_pendingStateAliases.clear();
+
+	rapidjson::Document settings;
+	for (auto & entry : m_stateSnapshot->entries()) {
+		QString alias = QString::fromStdString(entry.alias);
+		auto oAlias = m_mapAliases.find(alias);
+		if (oAlias == m_mapAliases.end()) {
+			// The object will be restored as soon as its alias is added
+			m_pendingStateAliases.insert(alias);
+			continue;
+		}
 
-		// Get the object
+		// Resolve the restorable once per entry
 		auto object = m_mapObjects.find(oAlias->second);
 		assert(object != m_mapObjects.end()); // Registered alias is not stored
-
-		// Check the object type
-		assert(ak::toQString(object->second->type()) == objType); // Current object type differs from saved object type
-
-		// Check object
-		ak::aRestorable * restorable = nullptr;
-		restorable = dynamic_cast<ak::aRestorable *>(object->second);
+		ak::aRestorable * restorable = dynamic_cast<ak::aRestorable *>(object->second);
 		assert(restorable != nullptr); // Cast failed
+		assert(ak::toQString(object->second->type()).toStdString() == entry.objectType); // Current object type differs from saved object type
 
-		// Apply the settings
-		const rapidjson::Value & settings = obj[RESTORABLE_NAME_SETTINGS];
+		if (!m_stateSnapshot->readSettings(entry, settings)) {
+			assert(0);	// Invalid entry
+			continue;
+		}
 		assert(settings.IsObject()); // Not a setting
 		restorable->restoreSettings(settings);
+	}
 
+	if (m_pendingStateAliases.empty()) {
+		delete m_stateSnapshot;
+		m_stateSnapshot = nullptr;
 	}
 	return ak::settingsRestoreErrorCode::srecNone;
 }
@@ -949,6 +1105,19 @@ void ak::aObjectManager::addAlias(
 	auto obj = m_mapAliases.find(_alias);
 	assert(obj == m_mapAliases.end()); // Object with the specified alias already exists
 	m_mapAliases.insert_or_assign(_alias, _UID);
+
+	// Apply the settings of a previously restored snapshot
+	if (m_stateSnapshot != nullptr && m_pendingStateAliases.erase(_alias) > 0) {
+		const aStateSnapshot::entry * entry = m_stateSnapshot->findEntry(_alias.toStdString());
+		rapidjson::Document settings;
+		if (entry != nullptr && m_stateSnapshot->readSettings(*entry, settings)) {
+			restoreObjectSettings(_alias, QString::fromStdString(entry->objectType), settings);
+		}
+		if (m_pendingStateAliases.empty()) {
+			delete m_stateSnapshot;
+			m_stateSnapshot = nullptr;
+		}
+	}
 }
 
 void ak::aObjectManager::setObjectUniqueName(
@@ -1056,6 +1225,30 @@ void ak::aObjectManager::addCreatedUid(
 
 }
 
+void ak::aObjectManager::buildTabToolBarPage(
+	UID												_creatorUid,
+	UID												_pageUid,
+	const aTtbLayout::pageEntry &					_page
+) {
+	// Adds all objects that still exist (a deferred build may run after some of them were destroyed)
+	auto addObjects = [this](UID _containerUid, const std::vector<UID> & _objects) {
+		aTtbContainer * cont = dynamic_cast<aTtbContainer *>(m_mapObjects.find(_containerUid)->second);
+		assert(cont != nullptr); // Cast failed
+		for (auto uid : _objects) {
+			auto obj = m_mapObjects.find(uid);
+			if (obj != m_mapObjects.end()) { cont->addChild(obj->second); }
+		}
+	};
+
+	for (auto const & group : _page.groups) {
+		UID groupUid = createTabToolBarSubContainer(_creatorUid, _pageUid, group.text);
+		addObjects(groupUid, group.objects);
+		for (auto const & subgroup : group.subgroups) {
+			addObjects(createTabToolBarSubContainer(_creatorUid, groupUid, subgroup.text), subgroup.objects);
+		}
+	}
+}
+
 QWidget * ak::aObjectManager::castToWidget(
 	UID												_objectUid
 ) {
@@ -1068,3 +1261,39 @@ QWidget * ak::aObjectManager::castToWidget(
 	assert(widget != nullptr); // Cast failed
 	return widget->widget();
 }
+
+ak::settingsRestoreErrorCode ak::aObjectManager::checkStateVersion(
+	const std::string &									_settingVersionApp,
+	const std::string &									_settingVersionWindowState,
+	const std::string &									_applicationVersion
+) const {
+	if (_applicationVersion != _settingVersionApp) { return ak::settingsRestoreErrorCode::srecAppVersionMismatch; }
+	if (CONFIG_VERSION_WINDOWSTATE != _settingVersionWindowState) { return ak::settingsRestoreErrorCode::srecSettingsVersionMismatch; }
+	return ak::settingsRestoreErrorCode::srecNone;
+}
+
+void ak::aObjectManager::restoreObjectSettings(
+	const QString &										_alias,
+	const QString &										_objectType,
+	const rapidjson::Value &							_settings
+) {
+	// Check if an object with the provided alias exist
+	auto oAlias = m_mapAliases.find(_alias);
+	assert(oAlias != m_mapAliases.end()); // No object with specified alias exists
+
+	// Get the object
+	auto object = m_mapObjects.find(oAlias->second);
+	assert(object != m_mapObjects.end()); // Registered alias is not stored
+
+	// Check the object type
+	assert(ak::toQString(object->second->type()) == _objectType); // Current object type differs from saved object type
+
+	// Check object
+	ak::aRestorable * restorable = nullptr;
+	restorable = dynamic_cast<ak::aRestorable *>(object->second);
+	assert(restorable != nullptr); // Cast failed
+
+	// Apply the settings
+	assert(_settings.IsObject()); // Not a setting
+	restorable->restoreSettings(_settings);
+}
@@ -0,0 +1,84 @@
+/*
+ *	File:		aRepaintScheduler.cpp
+ *	Package:	akGui
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akGui/aRepaintScheduler.h>
+
+// Qt header
+#include <qguiapplication.h>
+#include <qscreen.h>
+
+// C++ header
+#include <algorithm>
+
+#define REPAINT_SCHEDULER_DEFAULT_FRAME_INTERVAL 16
+
+ak::aRepaintScheduler * ak::aRepaintScheduler::instance(void) {
+	// Owned by the application, deleted with it
+	static QPointer<aRepaintScheduler> scheduler;
+	if (scheduler.isNull()) {
+		scheduler = new aRepaintScheduler;
+		if (QCoreApplication::instance() != nullptr) { scheduler->setParent(QCoreApplication::instance()); }
+	}
+	return scheduler.data();
+}
+
+void ak::aRepaintScheduler::setFrameInterval(int _interval) {
+	assert(_interval > 0);	// Invalid interval
+	m_frameInterval = _interval;
+}
+
+// ###########################################################################################################################################
+
+// Private slots
+
+void ak::aRepaintScheduler::slotFrame(void) {
+	m_lastFrame.restart();
+	std::vector<QPointer<QWidget>> pending;
+	pending.swap(m_pending);
+	for (auto const & widget : pending) {
+		if (!widget.isNull()) { widget->update(); }
+	}
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+ak::aRepaintScheduler::aRepaintScheduler()
+	: m_frameInterval(REPAINT_SCHEDULER_DEFAULT_FRAME_INTERVAL)
+{
+	QScreen * screen = QGuiApplication::primaryScreen();
+	if (screen != nullptr && screen->refreshRate() >= 1.) { m_frameInterval = std::max(1, qRound(1000. / screen->refreshRate())); }
+
+	m_timer.setSingleShot(true);
+	m_timer.setTimerType(Qt::PreciseTimer);
+	connect(&m_timer, &QTimer::timeout, this, &aRepaintScheduler::slotFrame);
+	m_lastFrame.start();
+}
+
+ak::aRepaintScheduler::~aRepaintScheduler() {}
+
+void ak::aRepaintScheduler::add(QWidget * _widget) {
+	assert(_widget != nullptr);	// Nullptr provided
+	// Only a few widgets are pending per frame, a linear search is cheaper than a hash
+	for (auto const & widget : m_pending) {
+		if (widget.data() == _widget) { return; }
+	}
+	m_pending.push_back(_widget);
+
+	if (!m_timer.isActive()) {
+		// Start with the next frame, the remaining time of the current frame is waited for
+		qint64 elapsed{ m_lastFrame.elapsed() };
+		m_timer.start(elapsed >= m_frameInterval ? 0 : static_cast<int>(m_frameInterval - elapsed));
+	}
+}
@@ -12,7 +12,32 @@
 
 // AK header
 #include <akGui/aRestorable.h>
+#include <akCore/rJSONStream.h>
+#include <akCore/aStateSnapshot.h>
 
 ak::aRestorable::aRestorable() {}
 
 ak::aRestorable::~aRestorable() {}
+
+void ak::aRestorable::writeObjectSettings(
+	rJSONStreamWriter &						_writer
+) {
+	rapidjson::Document doc;
+	rapidjson::Value items(rapidjson::kArrayType);
+	addObjectSettingsToValue(items, doc.GetAllocator());
+	for (rapidjson::Value::ConstValueIterator itm = items.Begin(); itm != items.End(); itm++) {
+		_writer.value(*itm);
+	}
+}
+
+void ak::aRestorable::writeObjectSettings(
+	aStateSnapshot &						_snapshot
+) {
+	rapidjson::Document doc;
+	rapidjson::Value items(rapidjson::kArrayType);
+	addObjectSettingsToValue(items, doc.GetAllocator());
+	for (rapidjson::Value::ConstValueIterator itm = items.Begin(); itm != items.End(); itm++) {
+		assert(itm->IsObject() && itm->HasMember(RESTORABLE_NAME_ALIAS) && itm->HasMember(RESTORABLE_NAME_TYPE) && itm->HasMember(RESTORABLE_NAME_SETTINGS));	// Invalid entry
+		_snapshot.addEntry((*itm)[RESTORABLE_NAME_ALIAS].GetString(), (*itm)[RESTORABLE_NAME_TYPE].GetString(), (*itm)[RESTORABLE_NAME_SETTINGS]);
+	}
+}
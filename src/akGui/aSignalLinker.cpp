@@ -31,10 +31,12 @@
 #include <akWidgets/aComboButtonWidget.h>
 #include <akWidgets/aDockWidget.h>
 #include <akWidgets/aLineEditWidget.h>
+#include <akWidgets/aLogViewWidget.h>
 #include <akWidgets/aNiceLineEditWidget.h>
 #include <akWidgets/aPropertyGridWidget.h>
 #include <akWidgets/aPushButtonWidget.h>
 #include <akWidgets/aTableWidget.h>
+#include <akWidgets/aTableViewWidget.h>
 #include <akWidgets/aTabWidget.h>
 #include <akWidgets/aTextEditWidget.h>
 #include <akWidgets/aToolButtonWidget.h>
@@ -54,16 +56,14 @@ ak::aSignalLinker::aSignalLinker(
 	m_uidManager(nullptr),
 	m_uid(0)
 {
-	try {
+	A_TRY {
 		if (_uidManager == nullptr) { throw aException("Is nullptr", "Check UID manager"); }
 		if (_messanger == nullptr) { throw aException("Is nullptr", "Check messanger"); }
 		m_uidManager = _uidManager;
 		m_messanger = _messanger;
 		m_uid = m_uidManager->getId();
 	}
-	catch (const aException & e) { throw aException(e, "ak::aSignalLinker::aSignalLinker()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aSignalLinker::aSignalLinker()"); }
-	catch (...) { throw aException("Unknown error", "ak::aSignalLinker::aSignalLinker()"); }
+	A_CATCH_FORWARD("ak::aSignalLinker::aSignalLinker()")
 }
 
 ak::aSignalLinker::~aSignalLinker()
@@ -134,6 +134,7 @@ ak::aSignalLinker::~aSignalLinker()
 			itm->second.object->disconnect(itm->second.object, SIGNAL(keyReleased(QKeyEvent *)), this, SLOT(slotKeyReleased(QKeyEvent *)));
 			break;
 		case otTable:
+		case otTableView:
 			itm->second.object->disconnect(itm->second.object, SIGNAL(cellActivated(int, int)), this, SLOT(tableCellActivated(int, int)));
 			itm->second.object->disconnect(itm->second.object, SIGNAL(cellChanged(int, int)), this, SLOT(tableCellChanged(int, int)));
 			itm->second.object->disconnect(itm->second.object, SIGNAL(cellClicked(int, int)), this, SLOT(tableCellClicked(int, int)));
@@ -156,6 +157,10 @@ ak::aSignalLinker::~aSignalLinker()
 			itm->second.object->disconnect(itm->second.object, SIGNAL(keyReleased(QKeyEvent *)), this, SLOT(slotKeyReleased(QKeyEvent *)));
 			itm->second.object->disconnect(itm->second.object, SIGNAL(contextMenuItemClicked(ak::ID)), this, SLOT(slotContextMenuItemClicked(ak::ID)));
 			break;
+		case otLogView:
+			itm->second.object->disconnect(itm->second.object, SIGNAL(keyPressed(QKeyEvent *)), this, SLOT(slotKeyPressed(QKeyEvent *)));
+			itm->second.object->disconnect(itm->second.object, SIGNAL(keyReleased(QKeyEvent *)), this, SLOT(slotKeyReleased(QKeyEvent *)));
+			break;
 		case otTimer:
 			itm->second.object->disconnect(itm->second.object, SIGNAL(timeout()), this, SLOT(slotTimeout()));
 			break;
@@ -318,6 +323,19 @@ ak::UID ak::aSignalLinker::addLink(
 	return _objectUid;
 }
 
+ak::UID ak::aSignalLinker::addLink(
+	aLogViewWidget *								_object,
+	UID												_objectUid
+) {
+	if (_objectUid == ak::invalidUID) { _objectUid = m_uidManager->getId(); }
+	assert(m_objects.count(_objectUid) == 0); // Object with the provided UID already exists
+	_object->setUid(_objectUid);
+	m_objects.insert_or_assign(_objectUid, struct_object{ _object, otLogView });
+	_object->connect(_object, &aLogViewWidget::keyPressed, this, &aSignalLinker::slotKeyPressed);
+	_object->connect(_object, &aLogViewWidget::keyReleased, this, &aSignalLinker::slotKeyReleased);
+	return _objectUid;
+}
+
 ak::UID ak::aSignalLinker::addLink(
 	aNiceLineEditWidget *							_object,
 	UID												_objectUid
@@ -399,6 +417,24 @@ ak::UID ak::aSignalLinker::addLink(
 	return _objectUid;
 }
 
+ak::UID ak::aSignalLinker::addLink(
+	aTableViewWidget *								_object,
+	UID												_objectUid
+) {
+	if (_objectUid == ak::invalidUID) { _objectUid = m_uidManager->getId(); }
+	assert(m_objects.count(_objectUid) == 0); // Object with the provided UID already exists
+	_object->setUid(_objectUid);
+	m_objects.insert_or_assign(_objectUid, struct_object{ _object, otTableView });
+	_object->connect(_object, &aTableViewWidget::cellActivated, this, &aSignalLinker::tableCellActivated);
+	_object->connect(_object, &aTableViewWidget::cellChanged, this, &aSignalLinker::tableCellChanged);
+	_object->connect(_object, &aTableViewWidget::cellClicked, this, &aSignalLinker::tableCellClicked);
+	_object->connect(_object, &aTableViewWidget::cellDoubleClicked, this, &aSignalLinker::tableCellDoubleClicked);
+	_object->connect(_object, &aTableViewWidget::cellEntered, this, &aSignalLinker::tableCellEntered);
+	_object->connect(_object, &aTableViewWidget::keyPressed, this, &aSignalLinker::slotKeyPressed);
+	_object->connect(_object, &aTableViewWidget::keyReleased, this, &aSignalLinker::slotKeyReleased);
+	return _objectUid;
+}
+
 ak::UID ak::aSignalLinker::addLink(
 	aTabWidget *										_object,
 	UID													_objectUid
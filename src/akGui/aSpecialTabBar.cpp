@@ -12,10 +12,12 @@
 
 #include <akGui/aSpecialTabBar.h>
 
+#include <akGui/aRepaintScheduler.h>
+
 #include <qstylepainter.h>
 #include <QStyleOptionTab>
 
-ak::aSpecialTabBar::aSpecialTabBar() : aObject{ otSpecialTabBar }, m_repaintIsBlocked{ false } {}
+ak::aSpecialTabBar::aSpecialTabBar() : aObject{ otSpecialTabBar }, m_repaintIsBlocked{ false }, m_repaintIsPending{ false } {}
 
 ak::aSpecialTabBar::~aSpecialTabBar() { A_OBJECT_DESTROYING }
 
@@ -24,12 +26,12 @@ void ak::aSpecialTabBar::paintEvent(QPaintEvent * _event) {
 	QStylePainter painter(this);
 	QStyleOptionTab opt;
 
+	int colors{ static_cast<int>(m_colors.size()) };
 	for (int i = 0; i < count(); i++)
 	{
 		initStyleOption(&opt, i);
-		auto itm = m_colors.find(i);
-		if (itm != m_colors.end()) {
-			opt.palette.setColor(QPalette::Button, itm->second.toQColor());
+		if (i < colors && m_colors[i].isValid()) {
+			opt.palette.setColor(QPalette::Button, m_colors[i]);
 		}
 		painter.drawControl(QStyle::CE_TabBarTabShape, opt);
 		painter.drawControl(QStyle::CE_TabBarTabLabel, opt);
@@ -39,15 +41,36 @@ void ak::aSpecialTabBar::paintEvent(QPaintEvent * _event) {
 
 void ak::aSpecialTabBar::clearColors(bool _repaint) {
 	m_colors.clear();
-	if (_repaint && !m_repaintIsBlocked) { repaint(); }
+	if (_repaint) { scheduleRepaint(); }
 }
 
 void ak::aSpecialTabBar::clearColor(int _index, bool _repaint) {
-	m_colors.erase(_index);
-	if (_repaint && !m_repaintIsBlocked) { repaint(); }
+	if (_index < 0 || _index >= static_cast<int>(m_colors.size())) { return; }
+	m_colors[_index] = QColor();
+	if (_repaint) { scheduleRepaint(); }
 }
 
 void ak::aSpecialTabBar::addColor(int _index, const aColor & _color, bool _repaint) {
-	m_colors.insert_or_assign(_index, _color);
-	if (_repaint && !m_repaintIsBlocked) { repaint(); }
-}
\ No newline at end of file
+	assert(_index >= 0);	// Invalid index
+	if (_index >= static_cast<int>(m_colors.size())) { m_colors.resize(_index + 1); }
+	m_colors[_index] = _color.toQColor();
+	if (_repaint) { scheduleRepaint(); }
+}
+
+void ak::aSpecialTabBar::setRepaintBlocked(bool _blocked) {
+	m_repaintIsBlocked = _blocked;
+	if (!m_repaintIsBlocked && m_repaintIsPending) { scheduleRepaint(); }
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+void ak::aSpecialTabBar::scheduleRepaint(void) {
+	if (m_repaintIsBlocked) {
+		m_repaintIsPending = true;
+		return;
+	}
+	m_repaintIsPending = false;
+	aRepaintScheduler::schedule(this);
+}
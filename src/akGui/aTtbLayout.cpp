@@ -0,0 +1,72 @@
+/*
+ *	File:		aTtbLayout.cpp
+ *	Package:	akGui
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akGui/aTtbLayout.h>
+
+ak::aTtbLayout::aTtbLayout() {}
+
+ak::aTtbLayout::~aTtbLayout() {}
+
+void ak::aTtbLayout::addPage(
+	const QString &				_page
+) { page(_page); }
+
+void ak::aTtbLayout::addGroup(
+	const QString &				_page,
+	const QString &				_group
+) { group(page(_page), _group); }
+
+void ak::aTtbLayout::addObject(
+	const QString &				_page,
+	const QString &				_group,
+	UID							_objectUid
+) {
+	assert(_objectUid != invalidUID);	// Invalid UID provided
+	group(page(_page), _group).objects.push_back(_objectUid);
+}
+
+void ak::aTtbLayout::addObject(
+	const QString &				_page,
+	const QString &				_group,
+	const QString &				_subgroup,
+	UID							_objectUid
+) {
+	assert(_objectUid != invalidUID);	// Invalid UID provided
+	subgroup(group(page(_page), _group), _subgroup).objects.push_back(_objectUid);
+}
+
+void ak::aTtbLayout::clear(void) { m_pages.clear(); }
+
+// ###########################################################################################################################################
+
+// Private functions
+
+// A ribbon only has a handful of pages and groups per level, a linear search is sufficient
+
+ak::aTtbLayout::pageEntry & ak::aTtbLayout::page(const QString & _text) {
+	for (auto & itm : m_pages) { if (itm.text == _text) { return itm; } }
+	m_pages.push_back(pageEntry{ _text, {} });
+	return m_pages.back();
+}
+
+ak::aTtbLayout::groupEntry & ak::aTtbLayout::group(pageEntry & _page, const QString & _text) {
+	for (auto & itm : _page.groups) { if (itm.text == _text) { return itm; } }
+	_page.groups.push_back(groupEntry{ _text, {}, {} });
+	return _page.groups.back();
+}
+
+ak::aTtbLayout::subgroupEntry & ak::aTtbLayout::subgroup(groupEntry & _group, const QString & _text) {
+	for (auto & itm : _group.subgroups) { if (itm.text == _text) { return itm; } }
+	_group.subgroups.push_back(subgroupEntry{ _text, {} });
+	return _group.subgroups.back();
+}
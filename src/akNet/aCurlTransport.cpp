@@ -0,0 +1,266 @@
+/*
+ *	File:		aCurlTransport.cpp
+ *	Package:	akNet
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// uiCore header
+#include <akNet/aCurlTransport.h>
+
+// Curl header
+#include <curl/curl.h>
+
+// C++ header
+#include <algorithm>
+#include <cstring>
+
+#define CURL_TRANSPORT_POLL_TIMEOUT 1000		// Upper limit in ms, the poll is woken up when a transfer is submitted
+#define CURL_TRANSPORT_MAX_IDLE_HANDLES 16
+
+struct ak::aCurlTransport::transfer {
+	aCurlRequest					request;
+	aCurlResult						result;
+	std::promise<aCurlResult>		promise;
+	callbackFunction				callback;
+	bool							usePromise = false;
+	CURL *							handle = nullptr;
+	struct curl_slist *				headers = nullptr;
+	struct curl_slist *				recipients = nullptr;
+	size_t							bodyOffset = 0;
+	char							errorBuffer[CURL_ERROR_SIZE];
+};
+
+ak::aCurlTransport::aCurlTransport(int _maxConnectionsPerHost, int _maxTotalConnections)
+	: m_multi(nullptr), m_stop(false), m_pending(0)
+{
+	curl_global_init(CURL_GLOBAL_ALL);
+	m_multi = curl_multi_init();
+	if (m_multi == nullptr) { return; }
+
+	curl_multi_setopt(m_multi, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(_maxConnectionsPerHost));
+	curl_multi_setopt(m_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(_maxTotalConnections));
+	curl_multi_setopt(m_multi, CURLMOPT_MAXCONNECTS, static_cast<long>(_maxTotalConnections));
+	curl_multi_setopt(m_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+	m_thread = std::thread(&aCurlTransport::run, this);
+}
+
+ak::aCurlTransport::~aCurlTransport() {
+	if (m_multi != nullptr) {
+		m_stop = true;
+		curl_multi_wakeup(m_multi);
+		if (m_thread.joinable()) { m_thread.join(); }
+		curl_multi_cleanup(m_multi);
+	}
+	for (auto h : m_idleHandles) { curl_easy_cleanup(h); }
+	curl_global_cleanup();
+}
+
+std::future<ak::aCurlResult> ak::aCurlTransport::submit(
+	const aCurlRequest &			_request
+) {
+	transfer * t = new transfer;
+	t->request = _request;
+	t->usePromise = true;
+	std::future<aCurlResult> ret{ t->promise.get_future() };
+	enqueue(t);
+	return ret;
+}
+
+void ak::aCurlTransport::submit(
+	const aCurlRequest &			_request,
+	const callbackFunction &		_callback
+) {
+	transfer * t = new transfer;
+	t->request = _request;
+	t->callback = _callback;
+	enqueue(t);
+}
+
+ak::aCurlTransport & ak::aCurlTransport::defaultTransport(void) {
+	// Never destroyed: joining the transport thread while the library is unloaded would dead lock
+	static aCurlTransport * transport = new aCurlTransport;
+	return *transport;
+}
+
+// #####################################################################################
+
+// Private functions
+
+void ak::aCurlTransport::enqueue(transfer * _transfer) {
+	m_pending++;
+	if (m_multi == nullptr || m_stop) {
+		finishTransfer(_transfer, CURLE_FAILED_INIT, "Transport not available");
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_queue.push_back(_transfer);
+	}
+	curl_multi_wakeup(m_multi);
+}
+
+void ak::aCurlTransport::run(void) {
+	while (!m_stop) {
+		std::deque<transfer *> queue;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			queue.swap(m_queue);
+		}
+		for (auto t : queue) { startTransfer(t); }
+
+		int running = 0;
+		curl_multi_perform(m_multi, &running);
+
+		CURLMsg * msg = nullptr;
+		int left = 0;
+		while ((msg = curl_multi_info_read(m_multi, &left)) != nullptr) {
+			if (msg->msg != CURLMSG_DONE) { continue; }
+			char * data = nullptr;
+			curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &data);
+			finishTransfer(reinterpret_cast<transfer *>(data), msg->data.result);
+		}
+
+		curl_multi_poll(m_multi, nullptr, 0, CURL_TRANSPORT_POLL_TIMEOUT, nullptr);
+	}
+
+	// Cancel everything that did not finish
+	std::deque<transfer *> queue;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		queue.swap(m_queue);
+	}
+	for (auto t : queue) { finishTransfer(t, CURLE_ABORTED_BY_CALLBACK, "Transport stopped"); }
+	while (!m_active.empty()) { finishTransfer(m_active.back(), CURLE_ABORTED_BY_CALLBACK, "Transport stopped"); }
+}
+
+void ak::aCurlTransport::startTransfer(transfer * _transfer) {
+	CURL * h = nullptr;
+	if (m_idleHandles.empty()) { h = curl_easy_init(); }
+	else {
+		h = m_idleHandles.back();
+		m_idleHandles.pop_back();
+	}
+	if (h == nullptr) {
+		finishTransfer(_transfer, CURLE_FAILED_INIT, "Failed to create the curl handle");
+		return;
+	}
+	_transfer->handle = h;
+	_transfer->errorBuffer[0] = 0;
+	const aCurlRequest & request = _transfer->request;
+
+	curl_easy_setopt(h, CURLOPT_URL, request.url.c_str());
+	curl_easy_setopt(h, CURLOPT_PRIVATE, _transfer);
+	curl_easy_setopt(h, CURLOPT_ERRORBUFFER, _transfer->errorBuffer);
+	curl_easy_setopt(h, CURLOPT_NOSIGNAL, 1L);
+	if (request.timeout > 0) { curl_easy_setopt(h, CURLOPT_TIMEOUT_MS, static_cast<long>(request.timeout)); }
+
+	curl_write_callback write = [](char * _ptr, size_t _size, size_t _nmemb, void * _userdata) -> size_t {
+		transfer * t = static_cast<transfer *>(_userdata);
+		size_t length = _size * _nmemb;
+		t->result.bytesReceived += static_cast<long long>(length);
+		if (t->request.responseWriter) { return (t->request.responseWriter(_ptr, length) ? length : 0); }
+		t->result.response.append(_ptr, length);
+		return length;
+	};
+	curl_easy_setopt(h, CURLOPT_WRITEFUNCTION, write);
+	curl_easy_setopt(h, CURLOPT_WRITEDATA, _transfer);
+
+	curl_read_callback read = [](char * _buffer, size_t _size, size_t _nitems, void * _userdata) -> size_t {
+		transfer * t = static_cast<transfer *>(_userdata);
+		size_t length = _size * _nitems;
+		if (t->request.bodyReader) { return t->request.bodyReader(_buffer, length); }
+		length = std::min(length, t->request.body.size() - t->bodyOffset);
+		std::memcpy(_buffer, t->request.body.data() + t->bodyOffset, length);
+		t->bodyOffset += length;
+		return length;
+	};
+	curl_off_t bodySize = (request.bodyReader ? request.bodySize : static_cast<curl_off_t>(request.body.size()));
+
+	if (!request.mailRecipients.empty()) {
+		// SMTP, the message is uploaded through the read callback
+		curl_easy_setopt(h, CURLOPT_MAIL_FROM, request.mailFrom.c_str());
+		for (auto const & r : request.mailRecipients) { _transfer->recipients = curl_slist_append(_transfer->recipients, r.c_str()); }
+		curl_easy_setopt(h, CURLOPT_MAIL_RCPT, _transfer->recipients);
+		curl_easy_setopt(h, CURLOPT_UPLOAD, 1L);
+		curl_easy_setopt(h, CURLOPT_READFUNCTION, read);
+		curl_easy_setopt(h, CURLOPT_READDATA, _transfer);
+		if (bodySize >= 0) { curl_easy_setopt(h, CURLOPT_INFILESIZE_LARGE, bodySize); }
+	}
+	else {
+		for (auto const & header : request.headers) { _transfer->headers = curl_slist_append(_transfer->headers, header.c_str()); }
+		if (_transfer->headers != nullptr) { curl_easy_setopt(h, CURLOPT_HTTPHEADER, _transfer->headers); }
+
+		// Keep idle connections alive and prefer waiting for a multiplexed connection over opening a new one
+		curl_easy_setopt(h, CURLOPT_TCP_KEEPALIVE, 1L);
+		curl_easy_setopt(h, CURLOPT_PIPEWAIT, 1L);
+
+		if (request.customMethod == "PUT") {
+			curl_easy_setopt(h, CURLOPT_UPLOAD, 1L);
+			curl_easy_setopt(h, CURLOPT_READFUNCTION, read);
+			curl_easy_setopt(h, CURLOPT_READDATA, _transfer);
+			if (bodySize >= 0) { curl_easy_setopt(h, CURLOPT_INFILESIZE_LARGE, bodySize); }
+		}
+		else {
+			if (request.bodyReader) {
+				// Streamed body, sent chunked if the size is unknown
+				curl_easy_setopt(h, CURLOPT_POST, 1L);
+				curl_easy_setopt(h, CURLOPT_READFUNCTION, read);
+				curl_easy_setopt(h, CURLOPT_READDATA, _transfer);
+				if (bodySize >= 0) { curl_easy_setopt(h, CURLOPT_POSTFIELDSIZE_LARGE, bodySize); }
+			}
+			else if (!request.body.empty()) {
+				// The request is owned by the transfer, curl does not need to copy the body
+				curl_easy_setopt(h, CURLOPT_POSTFIELDSIZE_LARGE, bodySize);
+				curl_easy_setopt(h, CURLOPT_POSTFIELDS, request.body.data());
+			}
+			if (!request.customMethod.empty()) { curl_easy_setopt(h, CURLOPT_CUSTOMREQUEST, request.customMethod.c_str()); }
+		}
+	}
+
+	if (curl_multi_add_handle(m_multi, h) != CURLM_OK) {
+		finishTransfer(_transfer, CURLE_FAILED_INIT, "Failed to start the transfer");
+		return;
+	}
+	m_active.push_back(_transfer);
+}
+
+void ak::aCurlTransport::finishTransfer(transfer * _transfer, int _curlCode, const char * _error) {
+	auto active = std::find(m_active.begin(), m_active.end(), _transfer);
+	if (active != m_active.end()) {
+		*active = m_active.back();
+		m_active.pop_back();
+		curl_multi_remove_handle(m_multi, _transfer->handle);
+	}
+
+	if (_transfer->handle != nullptr) {
+		curl_easy_getinfo(_transfer->handle, CURLINFO_RESPONSE_CODE, &_transfer->result.responseCode);
+		// Keep the handle, it caches DNS and TLS session information for the next transfer
+		if (m_idleHandles.size() < CURL_TRANSPORT_MAX_IDLE_HANDLES) {
+			curl_easy_reset(_transfer->handle);
+			m_idleHandles.push_back(_transfer->handle);
+		}
+		else { curl_easy_cleanup(_transfer->handle); }
+		_transfer->handle = nullptr;
+	}
+	curl_slist_free_all(_transfer->headers);
+	curl_slist_free_all(_transfer->recipients);
+
+	_transfer->result.success = (_curlCode == CURLE_OK);
+	if (!_transfer->result.success) {
+		if (_error != nullptr) { _transfer->result.error = _error; }
+		else if (_transfer->errorBuffer[0] != 0) { _transfer->result.error = _transfer->errorBuffer; }
+		else { _transfer->result.error = curl_easy_strerror(static_cast<CURLcode>(_curlCode)); }
+	}
+
+	if (_transfer->usePromise) { _transfer->promise.set_value(std::move(_transfer->result)); }
+	else if (_transfer->callback) { _transfer->callback(_transfer->result); }
+	delete _transfer;
+	m_pending--;
+}
@@ -13,21 +13,23 @@
 // uiCore header
 #include <akNet/aCurlWrapper.h>
 
-// Curl header
-#include <curl/curl.h>
-
-// C++ header
-#include <mutex>
-
-static std::mutex g_mutex;
+namespace {
+	//! @brief Will append the header line with all mail addresses of the list
+	void appendAddressHeader(std::string & _message, const char * _name, const std::list<std::string> & _addresses) {
+		if (_addresses.empty()) { return; }
+		_message.append(_name).append(": ");
+		bool first{ true };
+		for (auto const & address : _addresses) {
+			if (!first) { _message.append(", "); }
+			_message.append(address);
+			first = false;
+		}
+		_message.append("\r\n");
+	}
+}
 
 // #####################################################################################
 
-size_t writeFunction(void *ptr, size_t size, size_t nmemb, std::string* data) {
-	data->append((char*)ptr, size * nmemb);
-	return size * nmemb;
-}
-
 bool ak::aCurlWrapper::sendMail(
 	const std::string &				_mailserver,
 	const std::string &				_senderMail,
@@ -39,48 +41,55 @@ bool ak::aCurlWrapper::sendMail(
 	std::string&					_response,
 	int								_timeout
 ) {
-	g_mutex.lock();
-
-	std::string curlMessage;
-
-	auto curl = curl_easy_init();
-	if (!curl)
-	{
-		g_mutex.unlock();
-		return false;
-	}
-
-	curl_easy_setopt(curl, CURLOPT_URL, _mailserver.c_str());
-	curl_easy_setopt(curl, CURLOPT_MAIL_FROM, _senderMail.c_str());
-
-	// Add receiver
-	struct curl_slist * recipients{ nullptr };
-	for (auto receiver : _receiverMails) {
-		recipients = curl_slist_append(recipients, receiver.c_str());
-	}
-	for (auto receiver : _ccMails) {
-		recipients = curl_slist_append(recipients, receiver.c_str());
-	}
-	curl_easy_setopt(curl, CURLOPT_MAIL_RCPT, recipients);
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDS, _messageBody);
-
-	std::string header_string;
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeFunction);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &_response);
-	curl_easy_setopt(curl, CURLOPT_HEADERDATA, &header_string);
+	aCurlResult result{ sendMailAsync(_mailserver, _senderMail, _receiverMails, _ccMails, _subject, _messageBody, _date, _timeout).get() };
+	_response = (result.success ? result.response : result.error);
+	return result.success;
+}
 
-	// Send the message
-	auto res = curl_easy_perform(curl);
+std::future<ak::aCurlResult> ak::aCurlWrapper::sendMailAsync(
+	const std::string &				_mailserver,
+	const std::string &				_senderMail,
+	const std::list<std::string> &	_receiverMails,
+	const std::list<std::string> &	_ccMails,
+	const std::string &				_subject,
+	const std::string &				_messageBody,
+	const std::string &				_date,
+	int								_timeout
+) {
+	return aCurlTransport::defaultTransport().submit(
+		createMailRequest(_mailserver, _senderMail, _receiverMails, _ccMails, _subject, _messageBody, _date, _timeout));
+}
 
-	if (res != CURLE_OK) {
-		_response = curl_easy_strerror(res);
+ak::aCurlRequest ak::aCurlWrapper::createMailRequest(
+	const std::string &				_mailserver,
+	const std::string &				_senderMail,
+	const std::list<std::string> &	_receiverMails,
+	const std::list<std::string> &	_ccMails,
+	const std::string &				_subject,
+	const std::string &				_messageBody,
+	const std::string &				_date,
+	int								_timeout
+) {
+	aCurlRequest request;
+	request.url = _mailserver;
+	request.mailFrom = _senderMail;
+	request.mailRecipients = _receiverMails;
+	request.mailRecipients.insert(request.mailRecipients.end(), _ccMails.begin(), _ccMails.end());
+	request.timeout = _timeout;
+
+	// Compose the message (RFC 5322 requires CRLF line endings)
+	std::string & message = request.body;
+	message.reserve(_messageBody.size() + _subject.size() + 256);
+	if (!_date.empty()) { message.append("Date: ").append(_date).append("\r\n"); }
+	appendAddressHeader(message, "To", _receiverMails);
+	message.append("From: ").append(_senderMail).append("\r\n");
+	appendAddressHeader(message, "Cc", _ccMails);
+	message.append("Subject: ").append(_subject).append("\r\n\r\n");
+	for (size_t i = 0; i < _messageBody.size(); i++) {
+		char c = _messageBody[i];
+		if (c == '\n' && (i == 0 || _messageBody[i - 1] != '\r')) { message.push_back('\r'); }
+		message.push_back(c);
 	}
-
-	// Clean up the memory
-	curl_slist_free_all(recipients);
-	curl_easy_cleanup(curl);
-
-	g_mutex.unlock();
-
-	return res == CURLE_OK;
-}
\ No newline at end of file
+	message.append("\r\n");
+	return request;
+}
@@ -0,0 +1,270 @@
+/*
+ *	File:		aHttpClient.cpp
+ *	Package:	akNet
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// uiCore header
+#include <akNet/aHttpClient.h>
+#include <akCore/aMessenger.h>
+
+// Qt header
+#include <qfile.h>
+
+// C++ header
+#include <map>
+#include <mutex>
+#include <cstring>
+
+namespace {
+
+	//! @brief The caller buffer of a buffer download, the mutex is locked while data is written
+	struct bufferTarget {
+		std::mutex		mutex;
+		char *			buffer = nullptr;
+		size_t			capacity = 0;
+		size_t			written = 0;
+		bool			cancelled = false;
+	};
+
+	void cancelTarget(bufferTarget & _target) {
+		std::lock_guard<std::mutex> lock(_target.mutex);
+		_target.cancelled = true;
+		_target.buffer = nullptr;
+	}
+
+}
+
+struct ak::aHttpClient::sharedData {
+	std::mutex										mutex;
+	aHttpClient *									client = nullptr;		//! Set to nullptr when the client is destroyed
+	std::map<ID, aCurlResult>						results;
+	std::map<ID, std::shared_ptr<bufferTarget>>		buffers;				//! The running buffer downloads
+};
+
+ak::aHttpClient::aHttpClient(
+	aMessenger *						_messenger,
+	UID									_uid,
+	aCurlTransport *					_transport,
+	QObject *							_parent
+) : QObject(_parent), m_messenger(_messenger), m_uid(_uid), m_transport(_transport), m_data(std::make_shared<sharedData>()),
+	m_nextId(0), m_pendingCount(0), m_timeout(0)
+{
+	if (m_transport == nullptr) { m_transport = &aCurlTransport::defaultTransport(); }
+	m_data->client = this;
+}
+
+ak::aHttpClient::~aHttpClient() {
+	std::lock_guard<std::mutex> lock(m_data->mutex);
+	m_data->client = nullptr;
+	m_data->results.clear();
+	for (auto & itm : m_data->buffers) { cancelTarget(*itm.second); }
+	m_data->buffers.clear();
+}
+
+// ###########################################################################################################################################
+
+// Requests
+
+ak::ID ak::aHttpClient::get(
+	const std::string &					_url,
+	const std::list<std::string> &		_headers
+) {
+	aCurlRequest request;
+	request.url = _url;
+	request.headers = _headers;
+	return submit(request, nullptr);
+}
+
+ak::ID ak::aHttpClient::post(
+	const std::string &					_url,
+	const std::string &					_body,
+	const std::string &					_contentType,
+	const std::list<std::string> &		_headers
+) {
+	aCurlRequest request;
+	request.url = _url;
+	request.headers = _headers;
+	request.headers.push_back("Content-Type: " + _contentType);
+	request.body = _body;
+	// An empty body would otherwise be sent as GET
+	if (_body.empty()) { request.customMethod = "POST"; }
+	return submit(request, nullptr);
+}
+
+ak::ID ak::aHttpClient::put(
+	const std::string &					_url,
+	const std::string &					_body,
+	const std::string &					_contentType,
+	const std::list<std::string> &		_headers
+) {
+	aCurlRequest request;
+	request.url = _url;
+	request.customMethod = "PUT";
+	request.headers = _headers;
+	request.headers.push_back("Content-Type: " + _contentType);
+	request.body = _body;
+	return submit(request, nullptr);
+}
+
+ak::ID ak::aHttpClient::download(
+	const std::string &					_url,
+	const QString &						_filePath,
+	const std::list<std::string> &		_headers
+) {
+	std::shared_ptr<QFile> file = std::make_shared<QFile>(_filePath);
+	if (!file->open(QIODevice::WriteOnly | QIODevice::Truncate)) { return invalidID; }
+
+	aCurlRequest request;
+	request.url = _url;
+	request.headers = _headers;
+	request.responseWriter = [file](const char * _data, size_t _size) {
+		return file->write(_data, static_cast<qint64>(_size)) == static_cast<qint64>(_size);
+	};
+	return submit(request, file);
+}
+
+ak::ID ak::aHttpClient::download(
+	const std::string &					_url,
+	char *								_buffer,
+	size_t								_capacity,
+	const std::list<std::string> &		_headers
+) {
+	assert(_buffer != nullptr || _capacity == 0);	// No buffer provided
+	std::shared_ptr<bufferTarget> target = std::make_shared<bufferTarget>();
+	target->buffer = _buffer;
+	target->capacity = _capacity;
+
+	aCurlRequest request;
+	request.url = _url;
+	request.headers = _headers;
+	// The transfer is aborted by returning false once the download was cancelled
+	request.responseWriter = [target](const char * _data, size_t _size) {
+		std::lock_guard<std::mutex> lock(target->mutex);
+		if (target->cancelled || _size > target->capacity - target->written) { return false; }
+		std::memcpy(target->buffer + target->written, _data, _size);
+		target->written += _size;
+		return true;
+	};
+
+	// Registered before the submit, the transfer may finish before submit returns
+	ID id{ m_nextId };
+	{
+		std::lock_guard<std::mutex> lock(m_data->mutex);
+		m_data->buffers[id] = target;
+	}
+	return submit(request, nullptr);
+}
+
+ak::ID ak::aHttpClient::upload(
+	const std::string &					_url,
+	const QString &						_filePath,
+	const std::string &					_method,
+	const std::string &					_contentType,
+	const std::list<std::string> &		_headers
+) {
+	std::shared_ptr<QFile> file = std::make_shared<QFile>(_filePath);
+	if (!file->open(QIODevice::ReadOnly)) { return invalidID; }
+
+	aCurlRequest request;
+	request.url = _url;
+	request.customMethod = _method;
+	request.headers = _headers;
+	request.headers.push_back("Content-Type: " + _contentType);
+	request.bodySize = file->size();
+	request.bodyReader = [file](char * _buffer, size_t _size) -> size_t {
+		qint64 length = file->read(_buffer, static_cast<qint64>(_size));
+		return (length > 0 ? static_cast<size_t>(length) : 0);
+	};
+	return submit(request, file);
+}
+
+ak::ID ak::aHttpClient::send(
+	const aCurlRequest &				_request
+) {
+	aCurlRequest request{ _request };
+	return submit(request, nullptr);
+}
+
+bool ak::aHttpClient::cancelDownload(
+	ID									_requestId
+) {
+	std::shared_ptr<bufferTarget> target;
+	{
+		std::lock_guard<std::mutex> lock(m_data->mutex);
+		auto itm = m_data->buffers.find(_requestId);
+		if (itm == m_data->buffers.end()) { return false; }
+		target = std::move(itm->second);
+		m_data->buffers.erase(itm);
+	}
+	// Waits for a write that is in progress on the transport thread
+	cancelTarget(*target);
+	return true;
+}
+
+// ###########################################################################################################################################
+
+// Getter and setter
+
+bool ak::aHttpClient::takeResult(
+	ID									_requestId,
+	aCurlResult &						_result
+) {
+	std::lock_guard<std::mutex> lock(m_data->mutex);
+	auto itm = m_data->results.find(_requestId);
+	if (itm == m_data->results.end()) { return false; }
+	_result = std::move(itm->second);
+	m_data->results.erase(itm);
+	return true;
+}
+
+// ###########################################################################################################################################
+
+// Private slots
+
+void ak::aHttpClient::slotRequestFinished(int _requestId) {
+	m_pendingCount--;
+	bool success{ false };
+	long responseCode{ 0 };
+	{
+		std::lock_guard<std::mutex> lock(m_data->mutex);
+		auto itm = m_data->results.find(_requestId);
+		if (itm == m_data->results.end()) { return; }
+		success = itm->second.success;
+		responseCode = itm->second.responseCode;
+	}
+	if (m_messenger != nullptr) {
+		m_messenger->sendMessage(m_uid, (success ? etChanged : etInvalidEntry), _requestId, static_cast<int>(responseCode));
+	}
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
+ak::ID ak::aHttpClient::submit(
+	aCurlRequest &						_request,
+	const std::shared_ptr<QFile> &		_file
+) {
+	ID id{ m_nextId++ };
+	if (_request.timeout <= 0) { _request.timeout = m_timeout; }
+	m_pendingCount++;
+
+	// The callback is called on the transport thread, the notification is forwarded to the thread of the client
+	std::shared_ptr<sharedData> data{ m_data };
+	m_transport->submit(_request, [data, id, _file](const aCurlResult & _result) {
+		if (_file != nullptr) { _file->close(); }
+		std::lock_guard<std::mutex> lock(data->mutex);
+		data->buffers.erase(id);
+		if (data->client == nullptr) { return; }
+		data->results[id] = _result;
+		QMetaObject::invokeMethod(data->client, "slotRequestFinished", Qt::QueuedConnection, Q_ARG(int, id));
+	});
+	return id;
+}
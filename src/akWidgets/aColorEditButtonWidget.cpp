@@ -32,7 +32,8 @@ ak::aColorEditButtonWidget::aColorEditButtonWidget(
 	: aWidget(otColorEditButton),
 	m_button(nullptr),
 	m_layout(nullptr),
-	m_view(nullptr)
+	m_view(nullptr),
+	m_backgroundIsFilled(false)
 {
 	// Check arguments
 
@@ -93,7 +94,12 @@ void ak::aColorEditButtonWidget::setColor(
 	const aColor &							_color
 ) {
 	m_color = _color;
-	m_view->setStyleSheet(m_color.toHexString(false, "background-color:#"));
+	char hex[aColor::hexStringBufferSize];
+	int hexLength{ m_color.toHexString(hex, false) };
+	QString sheet;
+	sheet.reserve(18 + hexLength);
+	sheet.append("background-color:#").append(QLatin1String(hex, hexLength));
+	m_view->setStyleSheet(sheet);
 	m_button->setText(m_color.toRGBString(","));
 }
 
@@ -118,13 +124,16 @@ void ak::aColorEditButtonWidget::overrideText(
 void ak::aColorEditButtonWidget::fillBackground(
 	const aColor &			_color
 ) {
-	/*QString sheet("#" m_OBJECTNAME "{background-color:#");
-	sheet.append(_color.toHexString(true));
-	sheet.append(";}\n");
-	*/
-	QString sheet("background-color:#");
-	sheet.append(_color.toHexString(true));
-	sheet.append(";}\n");
+	// Called on every repaint of the owner, only rebuild the sheet if the color changed
+	if (m_backgroundIsFilled && m_backgroundColor == _color) { return; }
+	m_backgroundColor = _color;
+	m_backgroundIsFilled = true;
+
+	char hex[aColor::hexStringBufferSize];
+	int hexLength{ _color.toHexString(hex, true) };
+	QString sheet;
+	sheet.reserve(21 + hexLength);
+	sheet.append("background-color:#").append(QLatin1String(hex, hexLength)).append(";}\n");
 	m_widget->setAutoFillBackground(true);
 	m_widget->setStyleSheet(sheet);
 }
@@ -17,6 +17,89 @@
 
 // Qt header
 #include <qmenu.h>					// dropDownMenu
+#include <qaction.h>
+#include <qstylepainter.h>
+#include <qstyleoption.h>
+#include <qpointer.h>
+
+namespace ak {
+
+	//! @brief A menu with its items that may be used by multiple combo buttons
+	struct aComboButtonMenuSet {
+		QMenu *					menu;
+		std::vector<QString>	items;
+		QString					key;			//! The key in the pool, empty if the set is not shared
+		QString					styleSheet;		//! The style sheet currently applied to the menu
+		int						refCount;
+	};
+
+}
+
+namespace {
+
+	//! @brief Will return the pool containing the shared menus, the key is created from the items
+	std::map<QString, ak::aComboButtonMenuSet *> & menuPool(void) {
+		static std::map<QString, ak::aComboButtonMenuSet *> pool;
+		return pool;
+	}
+
+	QString menuKey(const std::vector<QString> & _items) {
+		QString key;
+		for (auto itm : _items) { key.append(itm).append(QChar(0x1F)); }
+		return key;
+	}
+
+	void addMenuAction(ak::aComboButtonMenuSet * _set, const QString & _text) {
+		QAction * action = _set->menu->addAction(_text);
+		action->setData(static_cast<int>(_set->items.size()));
+		_set->items.push_back(_text);
+	}
+
+	//! @brief Will return the shared set for the provided items, the set is created if required
+	ak::aComboButtonMenuSet * acquireMenuSet(const std::vector<QString> & _items) {
+		QString key{ menuKey(_items) };
+		auto itm = menuPool().find(key);
+		if (itm != menuPool().end()) {
+			itm->second->refCount++;
+			return itm->second;
+		}
+		ak::aComboButtonMenuSet * set = new ak::aComboButtonMenuSet;
+		set->menu = new QMenu;
+		set->items.reserve(_items.size());
+		set->key = key;
+		set->refCount = 1;
+		for (auto text : _items) { addMenuAction(set, text); }
+		menuPool().insert_or_assign(key, set);
+		return set;
+	}
+
+	void releaseMenuSet(ak::aComboButtonMenuSet * _set) {
+		if (_set == nullptr || --_set->refCount > 0) { return; }
+		if (!_set->key.isEmpty()) { menuPool().erase(_set->key); }
+		delete _set->menu;
+		delete _set;
+	}
+
+	//! @brief Will return a set that is only used by the caller and contains the same items as the provided set
+	ak::aComboButtonMenuSet * detachMenuSet(ak::aComboButtonMenuSet * _set) {
+		if (_set->refCount == 1) {
+			// Only used by the caller, remove it from the pool
+			if (!_set->key.isEmpty()) {
+				menuPool().erase(_set->key);
+				_set->key.clear();
+			}
+			return _set;
+		}
+		ak::aComboButtonMenuSet * set = new ak::aComboButtonMenuSet;
+		set->menu = new QMenu;
+		set->items.reserve(_set->items.size() + 1);
+		set->refCount = 1;
+		for (auto text : _set->items) { addMenuAction(set, text); }
+		releaseMenuSet(_set);
+		return set;
+	}
+
+}
 
 ak::aComboButtonWidget::aComboButtonWidget(
 	const QString &				_initialText,
@@ -24,21 +107,11 @@ ak::aComboButtonWidget::aComboButtonWidget(
 	QWidget *					_parent
 ) : QPushButton(_initialText, _parent),
 	ak::aWidget(otComboButton, _colorStyle),
-	m_menu(nullptr)
+	m_menuSet(nullptr)
 {
-	try {
-		// Create new QMenu to be a dropdown menu of the pushbutton
-		m_menu = new QMenu;
-		if (m_menu == nullptr) { throw aException("Failed to create", "Create menu"); }
-
-		// Apply color style and menu
-		if (m_colorStyle != nullptr) { setColorStyle(_colorStyle); }
-		setMenu(m_menu);
-		m_itemsUIDmanager.setLatestUid(1);
-	}
-	catch (const aException & e) { throw aException(e, "ak::aComboButtonWidget::aComboButtonWidget()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aComboButtonWidget::aComboButtonWidget()"); }
-	catch (...) { throw aException("Unknown error", "ak::aComboButtonWidget::aComboButtonWidget()"); }
+	// The menu is shown by this button since it may be shared with other buttons
+	connect(this, &QPushButton::pressed, this, &aComboButtonWidget::slotShowMenu);
+	if (m_colorStyle != nullptr) { setColorStyle(_colorStyle); }
 }
 
 //! @brief Deconstructor
@@ -58,73 +131,50 @@ void ak::aComboButtonWidget::keyReleaseEvent(QKeyEvent * _event) {
 	emit keyReleased(_event);
 }
 
+void ak::aComboButtonWidget::paintEvent(QPaintEvent * _event) {
+	// The menu is not set at the QPushButton, the indicator must be requested here
+	QStylePainter painter(this);
+	QStyleOptionButton option;
+	initStyleOption(&option);
+	option.features |= QStyleOptionButton::HasMenu;
+	painter.drawControl(QStyle::CE_PushButton, option);
+}
+
 // #######################################################################################################
 
 void ak::aComboButtonWidget::clearItems(void) {
-	for (int i = 0; i < m_items.size(); i++){
-		// Remove the action from the menu of this combo button
-		m_menu->removeAction(m_items.at(i));
-		// Disconnect the signal
-		disconnect(m_items.at(i), SIGNAL(triggered()), this, SLOT(slotItemTriggered()));
-		// Remove entry from the vector
-		delete m_items.at(i);
-	}
-	m_items.clear();
-	m_itemUids.clear();
-	m_itemsUIDmanager.setLatestUid(1);
+	releaseMenuSet(m_menuSet);
+	m_menuSet = nullptr;
 }
 
 void ak::aComboButtonWidget::setItems(
 	const std::vector<QString> &		_menu
 ) {
-	try {
-		clearItems();
-		for (int i = 0; i < _menu.size(); i++) {
-			// Create new item
-			ak::aComboButtonWidgetItem * n_itm = nullptr;
-			n_itm = new ak::aComboButtonWidgetItem(_menu.at(i));
-			// Set the items UID
-			n_itm->setUid(m_itemsUIDmanager.getId());
-			// Add the new item to the menu
-			m_menu->addAction(n_itm);
-			// Store data
-			m_items.push_back(n_itm);
-			m_itemUids.insert_or_assign(n_itm->uid(), m_items.size() - 1);
-			// Connect the triggered signal of the new item
-			connect(n_itm, SIGNAL(triggered()), this, SLOT(slotItemTriggered()));
-		}
+	A_TRY {
+		aComboButtonMenuSet * set = acquireMenuSet(_menu);
+		releaseMenuSet(m_menuSet);
+		m_menuSet = set;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aComboButtonWidget::setItems()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aComboButtonWidget::setItems()"); }
-	catch (...) { throw aException("Unknown error", "ak::aComboButtonWidget::setItems()"); }
+	A_CATCH_FORWARD("ak::aComboButtonWidget::setItems()")
 }
 
 int ak::aComboButtonWidget::addItem(
 	const QString &						_other
 ) {
-	try {
-		// Create new item
-		ak::aComboButtonWidgetItem * n_itm = nullptr;
-		n_itm = new ak::aComboButtonWidgetItem(_other);
-		if (n_itm == nullptr) { throw aException("Failed to create", "Create aComboButtonWidgetItem"); }
-		// Set the items UID
-		n_itm->setUid(m_itemsUIDmanager.getId());
-		// Add the new item to the menu
-		m_menu->addAction(n_itm);
-		// Store data
-		m_items.push_back(n_itm);
-		m_itemUids.insert_or_assign(n_itm->uid(), m_items.size() - 1);
-		// Connect the triggered signal of the new item
-		connect(n_itm, SIGNAL(triggered()), this, SLOT(slotItemTriggered()));
+	A_TRY {
+		if (m_menuSet == nullptr) { m_menuSet = acquireMenuSet(std::vector<QString>()); }
+		// The menu may be shared, changing it requires an own copy
+		m_menuSet = detachMenuSet(m_menuSet);
+		addMenuAction(m_menuSet, _other);
 		// Return the new items index in the menu
-		return (m_items.size() - 1);
+		return (m_menuSet->items.size() - 1);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aComboButtonWidget::addItem()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aComboButtonWidget::addItem()"); }
-	catch (...) { throw aException("Unknown error", "ak::aComboButtonWidget::addItem()"); }
+	A_CATCH_FORWARD("ak::aComboButtonWidget::addItem()")
 }
 
-int ak::aComboButtonWidget::getItemCount(void) const { return m_items.size(); }
+int ak::aComboButtonWidget::getItemCount(void) const { return (m_menuSet == nullptr ? 0 : m_menuSet->items.size()); }
+
+int ak::aComboButtonWidget::sharedMenuCount(void) { return menuPool().size(); }
 
 void ak::aComboButtonWidget::setColorStyle(
 	aColorStyle *								_colorStyle
@@ -134,24 +184,48 @@ void ak::aComboButtonWidget::setColorStyle(
 	QString sheet(m_colorStyle->toStyleSheet(cafForegroundColorControls |
 		cafBackgroundColorControls));
 	this->setStyleSheet(sheet);
-
-	if (m_menu != nullptr) {
-		sheet = m_colorStyle->toStyleSheet(cafForegroundColorDialogWindow | cafBackgroundColorDialogWindow, "QMenu{", "}");
-		sheet.append(m_colorStyle->toStyleSheet(cafForegroundColorDialogWindow | cafBackgroundColorDialogWindow, "QMenu::item{", "}"));
-		sheet.append(m_colorStyle->toStyleSheet(cafForegroundColorFocus | cafBackgroundColorFocus, "QMenu::item:selected{", "}"));
-		sheet.append(m_colorStyle->toStyleSheet(cafForegroundColorSelected | cafBackgroundColorSelected, "QMenu::item:pressed{", "}"));
-		m_menu->setStyleSheet(sheet);
-	}
+	refreshMenuStyleSheet();
 }
 
-void ak::aComboButtonWidget::slotItemTriggered() {
-	// Cast the QObject to the aComboButtonWidgetItem
-	ak::aComboButtonWidgetItem * itm = dynamic_cast<ak::aComboButtonWidgetItem *>(sender());
-	assert(itm != nullptr); // failed to cast. but item was expected
-	auto obj = m_itemUids.find(itm->uid());
-	assert(obj != m_itemUids.end()); // Invalid data stored
-	setText(m_items.at(obj->second)->text());
+void ak::aComboButtonWidget::slotShowMenu() {
+	if (m_menuSet == nullptr || m_menuSet->items.empty()) { setDown(false); return; }
+
+	// Only restyle the shared menu if it was last shown with a different style
+	if (m_menuSet->styleSheet != m_menuStyleSheet) {
+		m_menuSet->menu->setStyleSheet(m_menuStyleSheet);
+		m_menuSet->styleSheet = m_menuStyleSheet;
+	}
+	m_menuSet->menu->setMinimumWidth(width());
+
+	// exec runs a nested event loop in which this button may be destroyed or its items may be replaced.
+	// The reference keeps the set (and the menu that is shown) alive until the loop returned
+	aComboButtonMenuSet * set = m_menuSet;
+	set->refCount++;
+	QPointer<aComboButtonWidget> guard(this);
+
+	QAction * action = set->menu->exec(mapToGlobal(QPoint(0, height())));
+	int index = (action == nullptr ? -1 : action->data().toInt());
+	bool isCurrent{ guard != nullptr && m_menuSet == set };
+	std::vector<QString>::size_type itemCount{ set->items.size() };
+	QString text{ (index >= 0 && index < static_cast<int>(itemCount)) ? set->items.at(index) : QString() };
+	releaseMenuSet(set);
+
+	if (guard == nullptr) { return; }
+	setDown(false);
+	if (!isCurrent || action == nullptr) { return; }
+	assert(index >= 0 && index < static_cast<int>(itemCount)); // Invalid data stored
+	if (index < 0 || index >= static_cast<int>(itemCount)) { return; }
+	setText(text);
 	emit changed();
 }
 
 QWidget * ak::aComboButtonWidget::widget(void) { return this; }
+
+void ak::aComboButtonWidget::refreshMenuStyleSheet(void) {
+	m_menuStyleSheet.clear();
+	if (m_colorStyle == nullptr) { return; }
+	m_menuStyleSheet = m_colorStyle->toStyleSheet(cafForegroundColorDialogWindow | cafBackgroundColorDialogWindow, "QMenu{", "}");
+	m_menuStyleSheet.append(m_colorStyle->toStyleSheet(cafForegroundColorDialogWindow | cafBackgroundColorDialogWindow, "QMenu::item{", "}"));
+	m_menuStyleSheet.append(m_colorStyle->toStyleSheet(cafForegroundColorFocus | cafBackgroundColorFocus, "QMenu::item:selected{", "}"));
+	m_menuStyleSheet.append(m_colorStyle->toStyleSheet(cafForegroundColorSelected | cafBackgroundColorSelected, "QMenu::item:pressed{", "}"));
+}
@@ -18,7 +18,7 @@
 #include <qmenu.h>
 
 ak::aDockWatcherWidget::aDockWatcherWidget(const QString & _title)
-	: m_isEnabled(true)
+	: m_visibleCount(0), m_isEnabled(true)
 {
 	setText(_title);
 	m_menu = new QMenu;
@@ -26,7 +26,7 @@ ak::aDockWatcherWidget::aDockWatcherWidget(const QString & _title)
 }
 
 ak::aDockWatcherWidget::aDockWatcherWidget(const QIcon & _icon, const QString & _title)
-	: m_isEnabled(true)
+	: m_visibleCount(0), m_isEnabled(true)
 {
 	setIcon(_icon);
 	setText(_title);
@@ -75,18 +75,39 @@ void ak::aDockWatcherWidget::setColorStyle(
 // #######################################################################################################
 
 void ak::aDockWatcherWidget::refreshData(void) {
-	for (auto itm : m_dockMap) {
-		itm.second->setChecked(itm.first->isVisible());
+	for (size_t i = 0; i < m_entries.size(); i++) {
+		const watchEntry & entry = m_entries[i];
+		if (entry.dock == nullptr) { continue; }
+		bool visible{ visibleBit(i) };
+		if (entry.action->isChecked() != visible) { entry.action->setChecked(visible); }
 	}
 }
 
 void ak::aDockWatcherWidget::addWatch(QDockWidget * _dock) {
+	assert(_dock != nullptr);	// Nullptr provided
+	assert(m_dockMap.find(_dock) == m_dockMap.end());	// Dock already watched
 	auto action = new aContextMenuItem(_dock->windowTitle(), cmrNone);
 	m_menu->addAction(action);
 	action->setCheckable(true);
-	action->setChecked(_dock->isVisible());
-	m_dockMap.insert_or_assign(_dock, action);
-	m_actionMap.insert_or_assign(action, _dock);
+
+	size_t index;
+	if (m_freeEntries.empty()) {
+		index = m_entries.size();
+		m_entries.push_back(watchEntry{ _dock, action });
+		if (m_visibleBits.size() * 64 < m_entries.size()) { m_visibleBits.push_back(0); }
+	}
+	else {
+		index = m_freeEntries.back();
+		m_freeEntries.pop_back();
+		m_entries[index] = watchEntry{ _dock, action };
+	}
+
+	// The visible state is only queried once, later changes are received with the visibility changed signal
+	bool visible{ _dock->isVisible() };
+	setVisibleBit(index, visible);
+	action->setChecked(visible);
+	m_dockMap[_dock] = index;
+	m_actionMap[action] = index;
 
 	connect(_dock, &QDockWidget::visibilityChanged, this, &aDockWatcherWidget::slotVisibilityChanged);
 	connect(action, &QAction::toggled, this, &aDockWatcherWidget::slotMenuItemChanged);
@@ -94,23 +115,48 @@ void ak::aDockWatcherWidget::addWatch(QDockWidget * _dock) {
 
 void ak::aDockWatcherWidget::removeWatch(QDockWidget * _dock) {
 	auto itm = m_dockMap.find(_dock);
-	assert(itm != m_dockMap.end());
-	m_actionMap.erase(itm->second);
+	assert(itm != m_dockMap.end());	// Dock is not watched
+	size_t index{ itm->second };
+	aContextMenuItem * action = m_entries[index].action;
+	m_actionMap.erase(action);
 	disconnect(_dock, &QDockWidget::visibilityChanged, this, &aDockWatcherWidget::slotVisibilityChanged);
-	disconnect(itm->second, &QAction::toggled, this, &aDockWatcherWidget::slotMenuItemChanged);
-	m_menu->removeAction(itm->second);
-	delete itm->second;
-	m_dockMap.erase(_dock);
+	disconnect(action, &QAction::toggled, this, &aDockWatcherWidget::slotMenuItemChanged);
+	m_menu->removeAction(action);
+	delete action;
+	m_dockMap.erase(itm);
+
+	setVisibleBit(index, false);
+	m_entries[index] = watchEntry{ nullptr, nullptr };
+	m_freeEntries.push_back(index);
+}
+
+void ak::aDockWatcherWidget::setWatcherEnabled(bool _isEnabled) {
+	if (m_isEnabled == _isEnabled) { return; }
+	m_isEnabled = _isEnabled;
+	if (m_isEnabled) { refreshData(); }
+}
+
+bool ak::aDockWatcherWidget::isDockVisible(QDockWidget * _dock) const {
+	auto itm = m_dockMap.find(_dock);
+	assert(itm != m_dockMap.end());	// Dock is not watched
+	if (itm == m_dockMap.end()) { return false; }
+	return visibleBit(itm->second);
 }
 
 void ak::aDockWatcherWidget::slotVisibilityChanged(bool _visible) {
-	if (!m_isEnabled) { return; }
 	QDockWidget * actualDock = nullptr;
 	actualDock = dynamic_cast<QDockWidget *>(sender());
 	assert(actualDock != nullptr);	// Sender is not a dock
 	auto itm = m_dockMap.find(actualDock);
-	assert(itm != m_dockMap.end());
-	itm->second->setChecked(actualDock->isVisible());
+	assert(itm != m_dockMap.end());	// Dock is not watched
+	if (itm == m_dockMap.end()) { return; }
+
+	// The state is always tracked, only the menu is not updated while the watcher is disabled
+	size_t index{ itm->second };
+	if (visibleBit(index) == _visible) { return; }
+	setVisibleBit(index, _visible);
+	if (!m_isEnabled) { return; }
+	m_entries[index].action->setChecked(_visible);
 }
 
 void ak::aDockWatcherWidget::slotClicked() {
@@ -125,5 +171,19 @@ void ak::aDockWatcherWidget::slotMenuItemChanged() {
 	assert(itm != nullptr);
 	auto d = m_actionMap.find(itm);
 	assert(d != m_actionMap.end());
-	d->second->setVisible(itm->isChecked());
-}
\ No newline at end of file
+	const watchEntry & entry = m_entries[d->second];
+	if (visibleBit(d->second) == itm->isChecked()) { return; }	// Already in the requested state
+	entry.dock->setVisible(itm->isChecked());
+}
+
+// #######################################################################################################
+
+// Private functions
+
+void ak::aDockWatcherWidget::setVisibleBit(size_t _index, bool _visible) {
+	bitBlock mask{ bitBlock(1) << (_index % 64) };
+	bitBlock & block = m_visibleBits[_index / 64];
+	if (((block & mask) != 0) == _visible) { return; }
+	if (_visible) { block |= mask; m_visibleCount++; }
+	else { block &= ~mask; m_visibleCount--; }
+}
@@ -58,12 +58,12 @@ void ak::aLineEditWidget::setErrorState(bool _error) {
 	{
 		if (m_colorStyle != nullptr) {
 			QString sheet{ "color: #" };
-			if (m_errorIsForeground) { sheet.append(m_colorStyle->getControlsErrorFrontForegroundColor().toHexString()); }
-			else { sheet.append(m_colorStyle->getControlsErrorBackForegroundColor().toHexString()); }
+			if (m_errorIsForeground) { sheet.append(m_colorStyle->getPaletteHexString(aColorStyle::crControlsErrorFrontForeground)); }
+			else { sheet.append(m_colorStyle->getPaletteHexString(aColorStyle::crControlsErrorBackForeground)); }
 			sheet.append("; background-color: #");
-			if (m_errorIsForeground) { sheet.append(m_colorStyle->getControlsMainBackgroundColor().toHexString()); }
-			else { sheet.append(m_colorStyle->getControlsErrorBackBackgroundColor().toHexString()); }
-			sheet.append("; border: 1px solid #").append(m_colorStyle->getControlsBorderColor().toHexString(true));
+			if (m_errorIsForeground) { sheet.append(m_colorStyle->getPaletteHexString(aColorStyle::crControlsMainBackground)); }
+			else { sheet.append(m_colorStyle->getPaletteHexString(aColorStyle::crControlsErrorBackBackground)); }
+			sheet.append("; border: 1px solid #").append(m_colorStyle->getPaletteHexString(aColorStyle::crControlsBorder, true));
 			sheet.append(";}");
 			setStyleSheet(sheet);
 		}
@@ -77,7 +77,7 @@ void ak::aLineEditWidget::setErrorState(bool _error) {
 	}
 	else if (m_colorStyle != nullptr)
 	{
-		QString Color = m_colorStyle->getControlsBorderColor().toHexString(true);
+		const QString & Color = m_colorStyle->getPaletteHexString(aColorStyle::crControlsBorder, true);
 		setStyleSheet(m_colorStyle->toStyleSheet(cafForegroundColorControls |
 			cafBackgroundColorControls | cafBorderColorControls, "", "border: 1px solid #" + Color + ";"));
 	}
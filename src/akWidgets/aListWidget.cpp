@@ -11,6 +11,7 @@
  */
 
 // AK header
+#include <akGui/aChunkedPopulator.h>
 #include <akGui/aColorStyle.h>
 #include <akWidgets/aListWidget.h>
 
@@ -19,11 +20,13 @@
 #include <qscrollbar.h>
 
 ak::aListWidget::aListWidget()
-	: aWidget(otList), m_currentId(invalidID), m_verticalScrollbarAlwaysVisible(true)
+	: aWidget(otList), m_currentId(invalidID), m_verticalScrollbarAlwaysVisible(true), m_populator(nullptr), m_sortingWasEnabled(false)
 {}
 
 ak::aListWidget::~aListWidget() {
 	A_OBJECT_DESTROYING
+	// Deleting the populator stops a running population without notifications
+	if (m_populator != nullptr) { delete m_populator; }
 	memFree();
 }
 
@@ -80,7 +83,9 @@ ak::ID ak::aListWidget::AddItem(
 	const QString &					_text
 ) {
 	aListWidgetItem * nItm = new aListWidgetItem(_text, ++m_currentId, this);
-	m_items.insert_or_assign(nItm->id(), nItm);
+	// IDs are ascending, the new item always belongs at the end of the map
+	m_items.emplace_hint(m_items.end(), nItm->id(), nItm);
+	m_textIndex.add(_text, nItm->id());
 	//addItem(nItm);
 	return m_currentId;
 }
@@ -93,7 +98,9 @@ ak::ID ak::aListWidget::AddItem(
 	const QString &					_text
 ) {
 	aListWidgetItem * nItm = new aListWidgetItem(_icon, _text, ++m_currentId, this);
-	m_items.insert_or_assign(nItm->id(), nItm);
+	// IDs are ascending, the new item always belongs at the end of the map
+	m_items.emplace_hint(m_items.end(), nItm->id(), nItm);
+	m_textIndex.add(_text, nItm->id());
 	//addItem(nItm);
 	return m_currentId;
 }
@@ -101,13 +108,10 @@ ak::ID ak::aListWidget::AddItem(
 ak::aListWidgetItem * ak::aListWidget::Item(
 	const QString &					_text
 ) {
-	for (auto itm : m_items) {
-		if (itm.second->text() == _text) {
-			return itm.second;
-		}
-	}
-	assert(0); // Item does not exist
-	return nullptr;
+	ID id = m_textIndex.find(_text);
+	assert(id != invalidID); // Item does not exist
+	if (id == invalidID) { return nullptr; }
+	return Item(id);
 }
 
 ak::aListWidgetItem * ak::aListWidget::Item(
@@ -131,6 +135,7 @@ void ak::aListWidget::setItemText(
 	const QString &					_text
 ) {
 	aListWidgetItem * itm = Item(_id);
+	m_textIndex.rename(itm->text(), _text, _id);
 	itm->setText(_text);
 }
 
@@ -146,12 +151,24 @@ void ak::aListWidget::removeItem(
 	ak::ID							_id
 ) {
 	aListWidgetItem * itm = Item(_id);
+	m_textIndex.remove(itm->text(), _id);
 	removeItemWidget(itm);
 	delete itm;
 	m_items.erase(_id);
 }
 
-void ak::aListWidget::Clear() { clear(); m_currentId = ak::invalidID; memFree(); }
+ak::ID ak::aListWidget::findItemByText(
+	const QString &					_text
+) const { return m_textIndex.find(_text); }
+
+void ak::aListWidget::setTextLookupCaseSensitivity(
+	Qt::CaseSensitivity				_caseSensitivity
+) {
+	m_textIndex.setCaseSensitivity(_caseSensitivity);
+	for (auto itm : m_items) { m_textIndex.add(itm.second->text(), itm.first); }
+}
+
+void ak::aListWidget::Clear() { cancelPopulation(); clear(); m_currentId = ak::invalidID; memFree(); }
 
 void ak::aListWidget::setVerticalScrollbarAlwaysVisible(
 	bool							_vis
@@ -160,6 +177,64 @@ void ak::aListWidget::setVerticalScrollbarAlwaysVisible(
 	verticalScrollBar()->setVisible(false);
 }
 
+// ###########################################################################################################################################
+
+// Population
+
+void ak::aListWidget::populate(
+	const itemProducer &			_producer,
+	int								_expectedItemCount
+) {
+	assert(_producer);	// No producer provided
+	cancelPopulation();
+
+	m_sortingWasEnabled = isSortingEnabled();
+	setSortingEnabled(false);
+
+	QString text;
+	QIcon icon;
+	itemProducer producer{ _producer };
+	populator()->start([this, producer, text, icon](int _index) mutable {
+		text.clear();
+		icon = QIcon();
+		if (!producer(_index, text, icon)) { return false; }
+		if (icon.isNull()) { AddItem(text); }
+		else { AddItem(icon, text); }
+		return true;
+	}, _expectedItemCount);
+}
+
+void ak::aListWidget::cancelPopulation(void) {
+	if (m_populator != nullptr) { m_populator->cancel(); }
+}
+
+bool ak::aListWidget::isPopulating(void) const { return (m_populator != nullptr && m_populator->isRunning()); }
+
+void ak::aListWidget::setPopulationTimeBudget(
+	int								_milliseconds
+) { populator()->setTimeBudget(_milliseconds); }
+
+// ###########################################################################################################################################
+
+// Private slots
+
+void ak::aListWidget::slotPopulationChunkStarted(void) { setUpdatesEnabled(false); }
+
+void ak::aListWidget::slotPopulationProgress(int _itemCount, int _expectedItemCount) {
+	setUpdatesEnabled(true);
+	emit populationProgress(_itemCount, _expectedItemCount);
+}
+
+void ak::aListWidget::slotPopulationFinished(int _itemCount, bool _cancelled) {
+	setUpdatesEnabled(true);
+	setSortingEnabled(m_sortingWasEnabled);
+	emit populationFinished(_itemCount, _cancelled);
+}
+
+// ###########################################################################################################################################
+
+// Private functions
+
 void ak::aListWidget::memFree(void) {
 	for (auto itm = m_items.begin(); itm != m_items.end(); itm++) {
 		aListWidgetItem * actualItem = itm->second;
@@ -167,6 +242,17 @@ void ak::aListWidget::memFree(void) {
 		delete actualItem;
 	}
 	m_items.clear();
+	m_textIndex.clear();
+}
+
+ak::aChunkedPopulator * ak::aListWidget::populator(void) {
+	if (m_populator == nullptr) {
+		m_populator = new aChunkedPopulator(this);
+		connect(m_populator, &aChunkedPopulator::chunkStarted, this, &aListWidget::slotPopulationChunkStarted);
+		connect(m_populator, &aChunkedPopulator::progress, this, &aListWidget::slotPopulationProgress);
+		connect(m_populator, &aChunkedPopulator::finished, this, &aListWidget::slotPopulationFinished);
+	}
+	return m_populator;
 }
 
 // ###########################################################################################################################################
@@ -0,0 +1,133 @@
+/*
+ *	File:		aLogViewWidget.cpp
+ *	Package:	akWidgets
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akGui/aColorStyle.h>
+#include <akWidgets/aLogViewWidget.h>
+
+// Qt header
+#include <qscrollbar.h>
+#include <qevent.h>
+#include <qtimer.h>
+#include <qtextcursor.h>
+#include <qtextdocument.h>
+
+#define LOG_FLUSH_INTERVAL 16
+
+// #######################################################################################################
+
+// aLogBuffer
+
+ak::aLogBuffer::aLogBuffer(aLogViewWidget * _view)
+	: m_view(_view), m_flushScheduled(false)
+{}
+
+void ak::aLogBuffer::append(
+	const QString &					_text
+) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_view == nullptr) { return; }
+	m_pendingText.append(_text);
+	if (m_flushScheduled) { return; }
+	m_flushScheduled = true;
+	// The timer lives in the UI thread, start it from there. The view can not be destroyed while the mutex is locked
+	QMetaObject::invokeMethod(m_view->m_flushTimer, "start", Qt::QueuedConnection);
+}
+
+QString ak::aLogBuffer::take(void) {
+	QString text;
+	std::lock_guard<std::mutex> lock(m_mutex);
+	text.swap(m_pendingText);
+	m_flushScheduled = false;
+	return text;
+}
+
+// #######################################################################################################
+
+// aLogViewWidget
+
+ak::aLogViewWidget::aLogViewWidget(int _maximumLineCount, QWidget * _parent)
+	: QPlainTextEdit(_parent), aWidget(otLogView), m_buffer(nullptr), m_flushTimer(nullptr)
+{
+	m_buffer = std::shared_ptr<aLogBuffer>(new aLogBuffer(this));
+	m_flushTimer = new QTimer(this);
+	m_flushTimer->setSingleShot(true);
+	m_flushTimer->setInterval(LOG_FLUSH_INTERVAL);
+	connect(m_flushTimer, SIGNAL(timeout()), this, SLOT(slotFlushTimeout()));
+
+	setReadOnly(true);
+	setUndoRedoEnabled(false);
+	setMaximumBlockCount(_maximumLineCount);
+}
+
+ak::aLogViewWidget::~aLogViewWidget()
+{
+	A_OBJECT_DESTROYING
+	// Detach the buffer, worker threads may still hold it
+	std::lock_guard<std::mutex> lock(m_buffer->m_mutex);
+	m_buffer->m_view = nullptr;
+	m_buffer->m_pendingText.clear();
+}
+
+// #######################################################################################################
+// Event handling
+
+void ak::aLogViewWidget::keyPressEvent(QKeyEvent * _event) { QPlainTextEdit::keyPressEvent(_event); emit keyPressed(_event); }
+
+void ak::aLogViewWidget::keyReleaseEvent(QKeyEvent * _event) { QPlainTextEdit::keyReleaseEvent(_event); emit keyReleased(_event); }
+
+void ak::aLogViewWidget::slotFlushTimeout() { flush(); }
+
+// #######################################################################################################
+
+QWidget * ak::aLogViewWidget::widget(void) { return this; }
+
+void ak::aLogViewWidget::setColorStyle(
+	aColorStyle *			_colorStyle
+) {
+	assert(_colorStyle != nullptr); // nullptr provided
+	m_colorStyle = _colorStyle;
+
+	QString sheet(m_colorStyle->toStyleSheet(cafForegroundColorControls |
+		cafBackgroundColorControls, "QPlainTextEdit{", "}"));
+	this->setStyleSheet(sheet);
+}
+
+// #######################################################################################################
+
+void ak::aLogViewWidget::clearLog(void) {
+	m_buffer->take();
+	m_flushTimer->stop();
+	clear();
+}
+
+void ak::aLogViewWidget::setMaximumLineCount(
+	int								_maximumLineCount
+) { setMaximumBlockCount(_maximumLineCount); }
+
+int ak::aLogViewWidget::maximumLineCount(void) const { return maximumBlockCount(); }
+
+void ak::aLogViewWidget::flush(void) {
+	QString text{ m_buffer->take() };
+	m_flushTimer->stop();
+	if (text.isEmpty()) { return; }
+
+	// Only follow the output if the user did not scroll up
+	QScrollBar * bar = verticalScrollBar();
+	bool wasAtBottom = bar->value() >= bar->maximum();
+
+	QTextCursor cursor(document());
+	cursor.movePosition(QTextCursor::End);
+	cursor.insertText(text);
+
+	if (wasAtBottom) { bar->setValue(bar->maximum()); }
+}
@@ -953,26 +953,31 @@ void ak::aPropertyGridGroup::rebuildStyleSheets() {
 	m_colorStyleAlt->setHeaderBackgroundColor(m_colorItemBackground);
 	m_colorStyleAlt->setHeaderForegroundColor(m_colorTextNormal);
 
-	// Set sheets
-	m_colorStyle->setSheet(cafBackgroundColorControls, aColor::toHexString(m_colorItemBackground, true, "background-color: #"));
-	m_colorStyle->setSheet(cafBackgroundColorWindow, aColor::toHexString(m_colorItemBackground, true, "background-color: #"));
-	m_colorStyle->setSheet(cafBackgroundColorButton, aColor::toHexString(m_colorItemBackground, true, "background-color: #"));
-	m_colorStyle->setSheet(cafBackgroundColorAlternate, aColor::toHexString(m_colorItemBackgroundAlternate, true, "alternate-background-color: #"));
-	m_colorStyle->setSheet(cafBackgroundColorDialogWindow, aColor::toHexString(m_colorItemBackgroundAlternate, true, "background-color: #"));
-	m_colorStyle->setSheet(cafForegroundColorControls, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-	m_colorStyle->setSheet(cafForegroundColorButton, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-	m_colorStyle->setSheet(cafForegroundColorWindow, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-	m_colorStyle->setSheet(cafForegroundColorDialogWindow, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-
-	m_colorStyleAlt->setSheet(cafBackgroundColorControls, aColor::toHexString(m_colorItemBackgroundAlternate, true, "background-color: #"));
-	m_colorStyleAlt->setSheet(cafBackgroundColorWindow, aColor::toHexString(m_colorItemBackgroundAlternate, true, "background-color: #"));
-	m_colorStyleAlt->setSheet(cafBackgroundColorButton, aColor::toHexString(m_colorItemBackgroundAlternate, true, "background-color: #"));
-	m_colorStyleAlt->setSheet(cafBackgroundColorAlternate, aColor::toHexString(m_colorItemBackgroundAlternate, true, "alternate-background-color: #"));
-	m_colorStyleAlt->setSheet(cafBackgroundColorDialogWindow, aColor::toHexString(m_colorItemBackgroundAlternate, true, "background-color: #"));
-	m_colorStyleAlt->setSheet(cafForegroundColorControls, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-	m_colorStyleAlt->setSheet(cafForegroundColorButton, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-	m_colorStyleAlt->setSheet(cafForegroundColorWindow, aColor::toHexString(m_colorTextNormal, true, "color: #"));
-	m_colorStyleAlt->setSheet(cafForegroundColorDialogWindow, aColor::toHexString(m_colorTextNormal, true, "color: #"));
+	// Set sheets, the hex strings are taken from the palette of the style which is only rebuilt if a color changed
+	const QString background{ "background-color: #" + m_colorStyle->getPaletteHexString(aColorStyle::crControlsMainBackground, true) };
+	const QString backgroundAlternate{ "background-color: #" + m_colorStyle->getPaletteHexString(aColorStyle::crAlternateBackground, true) };
+	const QString alternateBackground{ "alternate-background-color: #" + m_colorStyle->getPaletteHexString(aColorStyle::crAlternateBackground, true) };
+	const QString foreground{ "color: #" + m_colorStyle->getPaletteHexString(aColorStyle::crControlsMainForeground, true) };
+
+	m_colorStyle->setSheet(cafBackgroundColorControls, background);
+	m_colorStyle->setSheet(cafBackgroundColorWindow, background);
+	m_colorStyle->setSheet(cafBackgroundColorButton, background);
+	m_colorStyle->setSheet(cafBackgroundColorAlternate, alternateBackground);
+	m_colorStyle->setSheet(cafBackgroundColorDialogWindow, backgroundAlternate);
+	m_colorStyle->setSheet(cafForegroundColorControls, foreground);
+	m_colorStyle->setSheet(cafForegroundColorButton, foreground);
+	m_colorStyle->setSheet(cafForegroundColorWindow, foreground);
+	m_colorStyle->setSheet(cafForegroundColorDialogWindow, foreground);
+
+	m_colorStyleAlt->setSheet(cafBackgroundColorControls, backgroundAlternate);
+	m_colorStyleAlt->setSheet(cafBackgroundColorWindow, backgroundAlternate);
+	m_colorStyleAlt->setSheet(cafBackgroundColorButton, backgroundAlternate);
+	m_colorStyleAlt->setSheet(cafBackgroundColorAlternate, alternateBackground);
+	m_colorStyleAlt->setSheet(cafBackgroundColorDialogWindow, backgroundAlternate);
+	m_colorStyleAlt->setSheet(cafForegroundColorControls, foreground);
+	m_colorStyleAlt->setSheet(cafForegroundColorButton, foreground);
+	m_colorStyleAlt->setSheet(cafForegroundColorWindow, foreground);
+	m_colorStyleAlt->setSheet(cafForegroundColorDialogWindow, foreground);
 
 	if (m_externColorStyle == nullptr) {
 		m_colorStyle->setSheet(cafBackgroundColorFocus, "");
@@ -1069,9 +1074,11 @@ ak::aPropertyGridItem::aPropertyGridItem(
 	else {
 		m_widgetBool->setChecked(_value);
 	}
-	QString sheet("QCheckBox{background-color:#");
-	sheet.append(m_colorBackground.toHexString(true));
-	sheet.append(";}\n");
+	char hex[aColor::hexStringBufferSize];
+	int hexLength{ m_colorBackground.toHexString(hex, true) };
+	QString sheet;
+	sheet.reserve(31 + hexLength);
+	sheet.append("QCheckBox{background-color:#").append(QLatin1String(hex, hexLength)).append(";}\n");
 	m_widgetBool->setStyleSheet(sheet);
 
 	// Make the first cell read only
@@ -1641,7 +1648,7 @@ void ak::aPropertyGridItem::slotTableCellChanged(
 			m_ignoreCellEvent = true;
 			bool failed = false;
 			double v;
-			v = toNumber<double>(theText.toStdString(), failed);
+			v = toNumber<double>(theText, failed);
 			if (failed) {
 				QString msg("Invalid value format provided for setting ");
 				msg.append(m_name);
@@ -1672,7 +1679,7 @@ void ak::aPropertyGridItem::slotTableCellChanged(
 			m_ignoreCellEvent = true;
 			bool failed = false;
 			int v;
-			v = toNumber<int>(theText.toStdString(), failed);
+			v = toNumber<int>(theText, failed);
 			if (failed) {
 				QString msg("Invalid value format provided for setting ");
 				msg.append(m_name);
@@ -1747,10 +1754,6 @@ void ak::aPropertyGridItem::repaint(void) {
 			assert(m_widgetBool != nullptr); // Something went wrong
 			QString sheet = m_globalColorStyle->toStyleSheet(cafBackgroundColorControls | cafForegroundColorControls, "QCheckBox{", "}");
 			m_widgetBool->setStyleSheet(sheet);
-			/*QString sheet("QCheckBox{background-color:#");
-			sheet.append(m_colorBackground.toHexString(true));
-			sheet.append(";}\n");
-			m_widgetBool->setStyleSheet(sheet);*/
 		}
 			break;
 		case vtColor:
@@ -1758,18 +1761,6 @@ void ak::aPropertyGridItem::repaint(void) {
 			assert(m_widgetColor != nullptr); // Something went wrong
 			m_widgetColor->setColorStyle(m_globalColorStyle);
 			m_widgetColor->fillBackground(m_colorBackground);
-			/*QString sheet("QPushButton{background-color: #");
-			sheet.append(m_colorBackground.toHexString(true));
-			sheet.append("; color: #");
-			sheet.append(m_colorNormalForeground.toHexString(true));
-			sheet.append("; }");
-
-			if (m_globalColorStyle != nullptr) {
-				sheet.append(m_globalColorStyle->toStyleSheet(cafBackgroundColorFocus | cafForegroundColorFocus, "QPushButton:hover{", "}"));
-				sheet.append(m_globalColorStyle->toStyleSheet(cafBackgroundColorSelected | cafForegroundColorSelected, "QPushButton:pressed{", "}"));
-			}
-
-			m_widgetColor->setPushButtonStyleSheet(sheet);*/
 		}
 			break;
 		case vtDate:
@@ -1784,25 +1775,6 @@ void ak::aPropertyGridItem::repaint(void) {
 		{
 			assert(m_widgetSelection != nullptr); // Something went wrong
 			m_widgetSelection->setColorStyle(m_globalColorStyle);
-			/*QString sheet("QPushButton{color: #");
-			aColor fore(m_colorNormalForeground);
-			aColor back(m_colorBackground);
-			sheet.append(fore.toHexString(true));
-			sheet.append("; background-color: #");
-			sheet.append(back.toHexString(true));
-			sheet.append(";} QPushButton QMenu{color: #");
-			sheet.append(fore.toHexString(true));
-			sheet.append("; background-color: #");
-			sheet.append(back.toHexString(true));
-			sheet.append("; alternate-background-color: red; border 1px solid black; }");
-
-			if (m_globalColorStyle != nullptr) {
-				sheet.append(m_globalColorStyle->toStyleSheet(cafBackgroundColorFocus | cafForegroundColorFocus, "QPushButton:hover{", "}"));
-				sheet.append(m_globalColorStyle->toStyleSheet(cafBackgroundColorSelected | cafForegroundColorSelected, "QPushButton:pressed{", "}"));
-			}
-			
-			m_widgetSelection->setStyleSheet(sheet);
-			*/
 		}
 			break;
 		default:
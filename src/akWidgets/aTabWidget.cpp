@@ -16,14 +16,27 @@
 
 // Qt header
 #include <qwidget.h>				// QWidget
+#include <qtabbar.h>				// QTabBar
+#include <qlayout.h>				// QVBoxLayout
 
 ak::aTabWidget::aTabWidget(
 	aColorStyle *			_colorStyle,
 	QWidget *				_parent
-) : QTabWidget(_parent), ak::aWidget(otTabView, _colorStyle)
-{}
+) : QTabWidget(_parent), ak::aWidget(otTabView, _colorStyle), m_textIndexIsDirty(false),
+	m_activationCounter(0), m_maximumLoadedLazyTabs(0)
+{
+	connect(tabBar(), &QTabBar::tabMoved, this, &aTabWidget::slotTabMoved);
+	connect(this, &QTabWidget::currentChanged, this, &aTabWidget::slotCurrentChanged);
+}
 
-ak::aTabWidget::~aTabWidget() { A_OBJECT_DESTROYING }
+ak::aTabWidget::~aTabWidget() {
+	A_OBJECT_DESTROYING
+	// The placeholders are destroyed with the base class, the map is not available anymore at that time
+	for (auto itm : m_lazyTabs) {
+		disconnect(itm.first, nullptr, this, nullptr);
+		if (itm.second.content != nullptr) { disconnect(itm.second.content, nullptr, this, nullptr); }
+	}
+}
 
 // #######################################################################################################
 
@@ -46,8 +59,7 @@ void ak::aTabWidget::setColorStyle(
 	sheet.append(m_colorStyle->toStyleSheet(cafBackgroundColorHeader | cafForegroundColorHeader,
 		"QTabWidget::pane{", "border: 1px solid #"));
 	if (!sheet.isEmpty()) {
-		QString Color(m_colorStyle->getHeaderBackgroundColor().toHexString(true));
-		sheet.append(Color);
+		sheet.append(m_colorStyle->getPaletteHexString(aColorStyle::crHeaderBackground, true));
 		sheet.append(";}\n");
 	}
 	sheet.append(m_colorStyle->toStyleSheet(cafBackgroundColorHeader | cafForegroundColorHeader,
@@ -83,7 +95,91 @@ void ak::aTabWidget::setTabLocation(
 
 void ak::aTabWidget::setCustomTabBar(
 	QTabBar *			_tabBar
-) { setTabBar(_tabBar); }
+) {
+	setTabBar(_tabBar);
+	connect(tabBar(), &QTabBar::tabMoved, this, &aTabWidget::slotTabMoved);
+	m_textIndexIsDirty = true;
+}
+
+void ak::aTabWidget::setTabText(
+	int					_index,
+	const QString &		_text
+) {
+	if (!m_textIndexIsDirty && _index >= 0 && _index < static_cast<int>(m_indexedTexts.size())) {
+		m_textIndex.rename(m_indexedTexts[_index], _text, _index);
+		m_indexedTexts[_index] = _text;
+	}
+	QTabWidget::setTabText(_index, _text);
+}
+
+void ak::aTabWidget::setTextLookupCaseSensitivity(
+	Qt::CaseSensitivity	_caseSensitivity
+) {
+	m_textIndex.setCaseSensitivity(_caseSensitivity);
+	m_textIndexIsDirty = true;
+}
+
+// #######################################################################################################
+
+// Lazy tabs
+
+ak::ID ak::aTabWidget::addLazyTab(
+	const tabFactory &	_factory,
+	const QString &		_title,
+	const QIcon &		_icon,
+	const tabDestroyer &	_destroyer
+) {
+	assert(_factory);	// No factory provided
+	QWidget * placeholder = new QWidget;
+	QVBoxLayout * layout = new QVBoxLayout(placeholder);
+	layout->setContentsMargins(0, 0, 0, 0);
+
+	lazyTab tab;
+	tab.factory = _factory;
+	tab.destroyer = _destroyer;
+	tab.content = nullptr;
+	tab.lastActivation = 0;
+	m_lazyTabs.insert_or_assign(placeholder, tab);
+	connect(placeholder, &QObject::destroyed, this, [this](QObject * _obj) { m_lazyTabs.erase(static_cast<QWidget *>(_obj)); });
+
+	// Adding the first tab changes the current tab, the entry must exist at this point
+	return addTab(placeholder, _icon, _title);
+}
+
+bool ak::aTabWidget::isLazyTabLoaded(
+	int					_index
+) const {
+	auto itm = m_lazyTabs.find(QTabWidget::widget(_index));
+	return (itm != m_lazyTabs.end() && itm->second.content != nullptr);
+}
+
+void ak::aTabWidget::loadLazyTab(
+	int					_index
+) {
+	QWidget * placeholder = QTabWidget::widget(_index);
+	auto itm = m_lazyTabs.find(placeholder);
+	if (itm == m_lazyTabs.end()) { return; }
+	if (itm->second.content == nullptr) {
+		loadLazyTab(placeholder, itm->second);
+		emit lazyTabLoaded(_index);
+	}
+}
+
+void ak::aTabWidget::unloadLazyTab(
+	int					_index
+) {
+	auto itm = m_lazyTabs.find(QTabWidget::widget(_index));
+	if (itm == m_lazyTabs.end()) { return; }
+	unloadLazyTab(itm->second);
+}
+
+void ak::aTabWidget::setMaximumLoadedLazyTabs(
+	int					_count
+) {
+	assert(_count >= 0);	// Invalid count
+	m_maximumLoadedLazyTabs = _count;
+	applyLazyTabLimit();
+}
 
 // #######################################################################################################
 
@@ -96,9 +192,116 @@ QStringList ak::aTabWidget::tabTitles(void) const {
 	return ret;
 }
 
-bool ak::aTabWidget::hasTab(const QString & _tabText) {
+bool ak::aTabWidget::hasTab(const QString & _tabText) { return findTabByText(_tabText) != invalidID; }
+
+ak::ID ak::aTabWidget::findTabByText(const QString & _tabText) {
+	refreshTextIndex();
+	return m_textIndex.find(_tabText);
+}
+
+// #######################################################################################################
+
+// Protected functions
+
+void ak::aTabWidget::tabInserted(int _index) {
+	QTabWidget::tabInserted(_index);
+	m_textIndexIsDirty = true;
+}
+
+void ak::aTabWidget::tabRemoved(int _index) {
+	QTabWidget::tabRemoved(_index);
+	m_textIndexIsDirty = true;
+
+	// The removed widget is not known anymore, forget every lazy tab whose placeholder is not a tab anymore
+	for (auto itm = m_lazyTabs.begin(); itm != m_lazyTabs.end();) {
+		if (indexOf(itm->first) >= 0) { itm++; continue; }
+		disconnect(itm->first, nullptr, this, nullptr);
+		if (itm->second.content != nullptr) { disconnect(itm->second.content, nullptr, this, nullptr); }
+		itm = m_lazyTabs.erase(itm);
+	}
+}
+
+// #######################################################################################################
+
+// Private slots
+
+void ak::aTabWidget::slotTabMoved(int _from, int _to) { m_textIndexIsDirty = true; }
+
+void ak::aTabWidget::slotCurrentChanged(int _index) {
+	if (_index < 0) { return; }
+	QWidget * placeholder = QTabWidget::widget(_index);
+	auto itm = m_lazyTabs.find(placeholder);
+	if (itm == m_lazyTabs.end()) { return; }
+	itm->second.lastActivation = ++m_activationCounter;
+	if (itm->second.content == nullptr) {
+		loadLazyTab(placeholder, itm->second);
+		applyLazyTabLimit();
+		emit lazyTabLoaded(_index);
+	}
+}
+
+// #######################################################################################################
+
+// Private functions
+
+void ak::aTabWidget::refreshTextIndex(void) {
+	// QTabWidget::setTabText and QTabBar::setTabText are not virtual, renames through them are only visible here
+	if (!m_textIndexIsDirty && static_cast<int>(m_indexedTexts.size()) == count()) {
+		bool isCurrent{ true };
+		for (int i = 0; i < count() && isCurrent; i++) { isCurrent = (tabText(i) == m_indexedTexts[i]); }
+		if (isCurrent) { return; }
+	}
+	m_textIndex.clear();
+	m_indexedTexts.clear();
+	m_indexedTexts.reserve(count());
 	for (int i = 0; i < count(); i++) {
-		if (tabText(i) == _tabText) { return true; }
+		m_indexedTexts.push_back(tabText(i));
+		m_textIndex.add(m_indexedTexts.back(), i);
+	}
+	m_textIndexIsDirty = false;
+}
+
+void ak::aTabWidget::loadLazyTab(QWidget * _placeholder, lazyTab & _tab) {
+	assert(_tab.content == nullptr);	// Already loaded
+	_tab.content = _tab.factory();
+	assert(_tab.content != nullptr);	// Factory failed
+	if (_tab.content == nullptr) { return; }
+
+	// Apply the current color style to the content
+	aWidget * akWidget = dynamic_cast<aWidget *>(_tab.content);
+	if (akWidget != nullptr && m_colorStyle != nullptr) { akWidget->setColorStyle(m_colorStyle); }
+
+	// The content may be destroyed by its owner
+	connect(_tab.content, &QObject::destroyed, this, [this, _placeholder]() {
+		auto itm = m_lazyTabs.find(_placeholder);
+		if (itm != m_lazyTabs.end()) { itm->second.content = nullptr; }
+	});
+
+	_placeholder->layout()->addWidget(_tab.content);
+}
+
+void ak::aTabWidget::unloadLazyTab(lazyTab & _tab) {
+	if (_tab.content == nullptr || !_tab.destroyer) { return; }
+	QWidget * content = _tab.content;
+	_tab.content = nullptr;
+	disconnect(content, nullptr, this, nullptr);
+	_tab.destroyer(content);
+}
+
+void ak::aTabWidget::applyLazyTabLimit(void) {
+	if (m_maximumLoadedLazyTabs <= 0) { return; }
+	QWidget * current = currentWidget();
+	for (;;) {
+		// Find the least recently visited unloadable tab
+		int loaded = 0;
+		lazyTab * oldest = nullptr;
+		for (auto & itm : m_lazyTabs) {
+			if (itm.second.content == nullptr || !itm.second.destroyer) { continue; }
+			loaded++;
+			if (itm.first == current) { continue; }
+			if (oldest == nullptr || itm.second.lastActivation < oldest->lastActivation) { oldest = &itm.second; }
+		}
+		if (loaded <= m_maximumLoadedLazyTabs || oldest == nullptr) { return; }
+		unloadLazyTab(*oldest);
 	}
-	return false;
 }
@@ -0,0 +1,423 @@
+/*
+ *	File:		aTableViewWidget.cpp
+ *	Package:	akWidgets
+ *
+ *  Created on: October 19, 2026
+ *	Author: Alexander Kuester
+ *  Copyright (c) 2020 Alexander Kuester
+ *	This file is part of the uiCore component.
+ *	This file is subject to the terms and conditions defined in
+ *	file 'LICENSE', which is part of this source code package.
+ */
+
+// AK header
+#include <akGui/aColorStyle.h>
+#include <akWidgets/aTableViewWidget.h>
+
+#include <qevent.h>
+
+// C++ header
+#include <algorithm>
+
+ak::aTableModel::aTableModel(QObject * _parent)
+	: QAbstractTableModel(_parent), m_rowCount(0), m_cellsEditable(true)
+{}
+
+ak::aTableModel::~aTableModel() {}
+
+// #######################################################################################################
+
+// Base class functions
+
+int ak::aTableModel::rowCount(const QModelIndex & _parent) const { return (_parent.isValid() ? 0 : m_rowCount); }
+
+int ak::aTableModel::columnCount(const QModelIndex & _parent) const { return (_parent.isValid() ? 0 : static_cast<int>(m_columns.size())); }
+
+QVariant ak::aTableModel::data(const QModelIndex & _index, int _role) const {
+	if (!_index.isValid()) { return QVariant(); }
+	switch (_role)
+	{
+	case Qt::DisplayRole:
+	case Qt::EditRole:
+		return m_columns[_index.column()][_index.row()];
+	case Qt::ForegroundRole:
+	{
+		const cellAttributes * attr = attributes(_index.row(), _index.column());
+		if (attr != nullptr && attr->foreground.isValid()) { return attr->foreground; }
+		return QVariant();
+	}
+	case Qt::BackgroundRole:
+	{
+		const cellAttributes * attr = attributes(_index.row(), _index.column());
+		if (attr != nullptr && attr->background.isValid()) { return attr->background; }
+		return QVariant();
+	}
+	default:
+		return QVariant();
+	}
+}
+
+bool ak::aTableModel::setData(const QModelIndex & _index, const QVariant & _value, int _role) {
+	if (!_index.isValid() || _role != Qt::EditRole) { return false; }
+	m_columns[_index.column()][_index.row()] = _value.toString();
+	emit dataChanged(_index, _index, { Qt::DisplayRole, Qt::EditRole });
+	emit cellChanged(_index.row(), _index.column());
+	return true;
+}
+
+QVariant ak::aTableModel::headerData(int _section, Qt::Orientation _orientation, int _role) const {
+	if (_role != Qt::DisplayRole) { return QVariant(); }
+	if (_orientation == Qt::Vertical) { return _section + 1; }
+	if (_section < 0 || _section >= static_cast<int>(m_headers.size()) || m_headers[_section].isNull()) { return _section + 1; }
+	return m_headers[_section];
+}
+
+Qt::ItemFlags ak::aTableModel::flags(const QModelIndex & _index) const {
+	if (!_index.isValid()) { return Qt::NoItemFlags; }
+	Qt::ItemFlags f{ Qt::ItemIsEnabled };
+	const cellAttributes * attr = attributes(_index.row(), _index.column());
+	if (attr != nullptr && attr->hasFlags) {
+		if (attr->editable) { f |= Qt::ItemIsEditable; }
+		if (attr->selectable) { f |= Qt::ItemIsSelectable; }
+	}
+	else {
+		f |= Qt::ItemIsSelectable;
+		if (m_cellsEditable) { f |= Qt::ItemIsEditable; }
+	}
+	return f;
+}
+
+// #######################################################################################################
+
+// Bulk data
+
+void ak::aTableModel::setDimensions(
+	int										_rows,
+	int										_columns
+) {
+	assert(_rows >= 0 && _columns >= 0);	// Invalid dimensions
+	beginResetModel();
+	m_rowCount = _rows;
+	m_columns.clear();
+	m_columns.resize(_columns, std::vector<QString>(_rows));
+	m_headers.resize(_columns);
+	m_attributes.clear();
+	endResetModel();
+}
+
+void ak::aTableModel::setRowCount(
+	int										_rows
+) {
+	assert(_rows >= 0);	// Invalid row count
+	if (_rows > m_rowCount) { ensureRowCount(_rows); }
+	else if (_rows < m_rowCount) {
+		beginRemoveRows(QModelIndex(), _rows, m_rowCount - 1);
+		for (auto & column : m_columns) { column.resize(_rows); }
+		for (auto itm = m_attributes.begin(); itm != m_attributes.end();) {
+			if (static_cast<int>(itm->first >> 32) >= _rows) { itm = m_attributes.erase(itm); }
+			else { itm++; }
+		}
+		m_rowCount = _rows;
+		endRemoveRows();
+	}
+}
+
+void ak::aTableModel::setColumnCount(
+	int										_columns
+) {
+	assert(_columns >= 0);	// Invalid column count
+	int current = static_cast<int>(m_columns.size());
+	if (_columns > current) {
+		beginInsertColumns(QModelIndex(), current, _columns - 1);
+		m_columns.resize(_columns, std::vector<QString>(m_rowCount));
+		m_headers.resize(_columns);
+		endInsertColumns();
+	}
+	else if (_columns < current) {
+		beginRemoveColumns(QModelIndex(), _columns, current - 1);
+		m_columns.resize(_columns);
+		m_headers.resize(_columns);
+		for (auto itm = m_attributes.begin(); itm != m_attributes.end();) {
+			if (static_cast<int>(itm->first & 0xFFFFFFFF) >= _columns) { itm = m_attributes.erase(itm); }
+			else { itm++; }
+		}
+		endRemoveColumns();
+	}
+}
+
+void ak::aTableModel::setColumn(
+	int										_column,
+	const QString *							_values,
+	int										_count,
+	int										_firstRow
+) {
+	assert(_column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	assert(_firstRow >= 0 && _count >= 0);	// Invalid range
+	if (_count == 0) { return; }
+	ensureRowCount(_firstRow + _count);
+	std::copy(_values, _values + _count, m_columns[_column].begin() + _firstRow);
+	emit dataChanged(index(_firstRow, _column), index(_firstRow + _count - 1, _column), { Qt::DisplayRole, Qt::EditRole });
+}
+
+void ak::aTableModel::setRows(
+	int										_firstRow,
+	const QString *							_values,
+	int										_rowCount,
+	int										_columnCount
+) {
+	assert(_columnCount >= 0 && _columnCount <= static_cast<int>(m_columns.size()));	// Too many columns
+	assert(_firstRow >= 0 && _rowCount >= 0);	// Invalid range
+	if (_rowCount == 0 || _columnCount == 0) { return; }
+	ensureRowCount(_firstRow + _rowCount);
+
+	// Write column by column to stay in the contiguous column storage
+	for (int c = 0; c < _columnCount; c++) {
+		std::vector<QString> & column = m_columns[c];
+		const QString * src = _values + c;
+		for (int r = 0; r < _rowCount; r++, src += _columnCount) { column[_firstRow + r] = *src; }
+	}
+	emit dataChanged(index(_firstRow, 0), index(_firstRow + _rowCount - 1, _columnCount - 1), { Qt::DisplayRole, Qt::EditRole });
+}
+
+void ak::aTableModel::clearRows(void) {
+	beginResetModel();
+	for (auto & column : m_columns) {
+		column.clear();
+		column.shrink_to_fit();
+	}
+	m_attributes.clear();
+	m_rowCount = 0;
+	endResetModel();
+}
+
+// #######################################################################################################
+
+// Cells
+
+void ak::aTableModel::setCellText(
+	int										_row,
+	int										_column,
+	const QString &							_text
+) {
+	assert(_row >= 0 && _row < m_rowCount && _column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	m_columns[_column][_row] = _text;
+	QModelIndex idx{ index(_row, _column) };
+	emit dataChanged(idx, idx, { Qt::DisplayRole, Qt::EditRole });
+}
+
+const QString & ak::aTableModel::cellText(
+	int										_row,
+	int										_column
+) const {
+	assert(_row >= 0 && _row < m_rowCount && _column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	return m_columns[_column][_row];
+}
+
+void ak::aTableModel::setCellForecolor(
+	int										_row,
+	int										_column,
+	const QColor &							_color
+) {
+	assert(_row >= 0 && _row < m_rowCount && _column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	m_attributes[cellKey(_row, _column)].foreground = _color;
+	QModelIndex idx{ index(_row, _column) };
+	emit dataChanged(idx, idx, { Qt::ForegroundRole });
+}
+
+void ak::aTableModel::setCellBackcolor(
+	int										_row,
+	int										_column,
+	const QColor &							_color
+) {
+	assert(_row >= 0 && _row < m_rowCount && _column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	m_attributes[cellKey(_row, _column)].background = _color;
+	QModelIndex idx{ index(_row, _column) };
+	emit dataChanged(idx, idx, { Qt::BackgroundRole });
+}
+
+void ak::aTableModel::setCellEditable(
+	int										_row,
+	int										_column,
+	bool									_editable
+) {
+	assert(_row >= 0 && _row < m_rowCount && _column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	cellAttributes & attr = m_attributes[cellKey(_row, _column)];
+	if (!attr.hasFlags) {
+		attr.hasFlags = true;
+		attr.editable = m_cellsEditable;
+		attr.selectable = true;
+	}
+	attr.editable = _editable;
+	QModelIndex idx{ index(_row, _column) };
+	emit dataChanged(idx, idx);
+}
+
+bool ak::aTableModel::isCellEditable(
+	int										_row,
+	int										_column
+) const {
+	const cellAttributes * attr = attributes(_row, _column);
+	return (attr != nullptr && attr->hasFlags ? attr->editable : m_cellsEditable);
+}
+
+void ak::aTableModel::setCellSelectable(
+	int										_row,
+	int										_column,
+	bool									_selectable
+) {
+	assert(_row >= 0 && _row < m_rowCount && _column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	cellAttributes & attr = m_attributes[cellKey(_row, _column)];
+	if (!attr.hasFlags) {
+		attr.hasFlags = true;
+		attr.editable = m_cellsEditable;
+		attr.selectable = true;
+	}
+	attr.selectable = _selectable;
+	QModelIndex idx{ index(_row, _column) };
+	emit dataChanged(idx, idx);
+}
+
+bool ak::aTableModel::isCellSelectable(
+	int										_row,
+	int										_column
+) const {
+	const cellAttributes * attr = attributes(_row, _column);
+	return (attr != nullptr && attr->hasFlags ? attr->selectable : true);
+}
+
+void ak::aTableModel::setCellsEditable(
+	bool									_editable
+) {
+	if (m_cellsEditable == _editable) { return; }
+	m_cellsEditable = _editable;
+	if (m_rowCount > 0 && !m_columns.empty()) {
+		emit dataChanged(index(0, 0), index(m_rowCount - 1, static_cast<int>(m_columns.size()) - 1));
+	}
+}
+
+void ak::aTableModel::setColumnHeader(
+	int										_column,
+	const QString &							_text
+) {
+	assert(_column >= 0 && _column < static_cast<int>(m_columns.size()));	// Index out of range
+	m_headers[_column] = _text;
+	emit headerDataChanged(Qt::Horizontal, _column, _column);
+}
+
+// #######################################################################################################
+
+// Private functions
+
+const ak::aTableModel::cellAttributes * ak::aTableModel::attributes(int _row, int _column) const {
+	if (m_attributes.empty()) { return nullptr; }
+	auto itm = m_attributes.find(cellKey(_row, _column));
+	return (itm == m_attributes.end() ? nullptr : &itm->second);
+}
+
+void ak::aTableModel::ensureRowCount(int _rows) {
+	if (_rows <= m_rowCount) { return; }
+	beginInsertRows(QModelIndex(), m_rowCount, _rows - 1);
+	for (auto & column : m_columns) { column.resize(_rows); }
+	m_rowCount = _rows;
+	endInsertRows();
+}
+
+// ###########################################################################################################################################
+
+// ###########################################################################################################################################
+
+// ###########################################################################################################################################
+
+ak::aTableViewWidget::aTableViewWidget(int _rows, int _columns, QWidget * _parent)
+	: QTableView(_parent), aWidget(otTableView), m_model(nullptr)
+{
+	m_model = new aTableModel(this);
+	m_model->setDimensions(_rows, _columns);
+	setModel(m_model);
+
+	// Fixed row heights, this way the view does not need to measure rows outside of the viewport
+	verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+
+	connect(m_model, &aTableModel::cellChanged, this, &aTableViewWidget::cellChanged);
+	connect(this, &QTableView::activated, this, &aTableViewWidget::slotActivated);
+	connect(this, &QTableView::clicked, this, &aTableViewWidget::slotClicked);
+	connect(this, &QTableView::doubleClicked, this, &aTableViewWidget::slotDoubleClicked);
+	connect(this, &QTableView::entered, this, &aTableViewWidget::slotEntered);
+}
+
+ak::aTableViewWidget::~aTableViewWidget() { A_OBJECT_DESTROYING }
+
+// #######################################################################################################
+// Event handling
+
+void ak::aTableViewWidget::keyPressEvent(QKeyEvent *_event)
+{
+	QTableView::keyPressEvent(_event);
+	emit keyPressed(_event);
+}
+
+void ak::aTableViewWidget::keyReleaseEvent(QKeyEvent * _event) {
+	QTableView::keyReleaseEvent(_event);
+	emit keyReleased(_event);
+}
+
+void ak::aTableViewWidget::focusOutEvent(QFocusEvent * _event) {
+	QTableView::focusOutEvent(_event);
+	emit focusLost();
+}
+
+// #######################################################################################################
+
+QWidget * ak::aTableViewWidget::widget(void) { return this; }
+
+void ak::aTableViewWidget::setColorStyle(
+	aColorStyle *			_colorStyle
+) {
+	assert(_colorStyle != nullptr); // nullptr provided
+	m_colorStyle = _colorStyle;
+
+	QString sheet{ m_colorStyle->toStyleSheet(cafForegroundColorControls |
+		cafBackgroundColorControls | cafBackgroundColorAlternate, "QTableView{", "}\n") };
+
+	sheet.append(m_colorStyle->toStyleSheet(cafForegroundColorHeader |
+		cafBackgroundColorHeader | cafBorderColorHeader,
+		"QToolTip{", "border: 1px;}"));
+
+	this->setStyleSheet(sheet);
+
+	sheet = m_colorStyle->toStyleSheet(cafForegroundColorHeader | cafBackgroundColorHeader,
+		"QHeaderView{border: none;", "}\n");
+	sheet.append(m_colorStyle->toStyleSheet(cafForegroundColorHeader |
+		cafBackgroundColorHeader |
+		cafDefaultBorderHeader | cafBorderColorHeader
+		,
+		"QHeaderView::section{", "}"));
+	this->horizontalHeader()->setStyleSheet(sheet);
+	this->verticalHeader()->setStyleSheet(sheet);
+}
+
+// #######################################################################################################
+
+void ak::aTableViewWidget::setColumnResizeMode(
+	int																_column,
+	QHeaderView::ResizeMode											_mode
+) {
+	assert(_column >= 0 && _column < m_model->columnCount());	// Index out of range
+	horizontalHeader()->setSectionResizeMode(_column, _mode);
+}
+
+void ak::aTableViewWidget::setRowHeaderIsVisible(
+	bool															_visible
+) { verticalHeader()->setVisible(_visible); }
+
+// #######################################################################################################
+
+// Private slots
+
+void ak::aTableViewWidget::slotActivated(const QModelIndex & _index) { emit cellActivated(_index.row(), _index.column()); }
+
+void ak::aTableViewWidget::slotClicked(const QModelIndex & _index) { emit cellClicked(_index.row(), _index.column()); }
+
+void ak::aTableViewWidget::slotDoubleClicked(const QModelIndex & _index) { emit cellDoubleClicked(_index.row(), _index.column()); }
+
+void ak::aTableViewWidget::slotEntered(const QModelIndex & _index) { emit cellEntered(_index.row(), _index.column()); }
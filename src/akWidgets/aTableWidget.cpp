@@ -12,16 +12,24 @@
 
 // AK header
 #include <akGui/aColorStyle.h>
+#include <akGui/aChunkedPopulator.h>
 #include <akWidgets/aTableWidget.h>
 
 #include <qevent.h>
 
+// C++ header
+#include <algorithm>
+
 ak::aTableWidget::aTableWidget(QWidget * _parent)
-: QTableWidget(_parent), aWidget(otTable) {}
+: QTableWidget(_parent), aWidget(otTable), m_populator(nullptr), m_sortingWasEnabled(false) {}
 ak::aTableWidget::aTableWidget(int _rows, int _columns, QWidget * _parent)
-: QTableWidget(_rows, _columns, _parent), aWidget(otTable) {}
+: QTableWidget(_rows, _columns, _parent), aWidget(otTable), m_populator(nullptr), m_sortingWasEnabled(false) {}
 
-ak::aTableWidget::~aTableWidget() { A_OBJECT_DESTROYING }
+ak::aTableWidget::~aTableWidget() {
+	A_OBJECT_DESTROYING
+	// Deleting the populator stops a running population without notifications
+	if (m_populator != nullptr) { delete m_populator; }
+}
 
 // #######################################################################################################
 // Event handling
@@ -226,11 +234,49 @@ void ak::aTableWidget::setCellIsSelected(
 }
 
 void ak::aTableWidget::clearRows(void) {
+	cancelPopulation();
 	setRowCount(0);
 }
 
 // ##############################################################################################################
 
+// Population
+
+void ak::aTableWidget::populate(
+	const rowProducer &												_producer,
+	int																_expectedRowCount
+) {
+	assert(_producer);	// No producer provided
+	cancelPopulation();
+
+	m_sortingWasEnabled = isSortingEnabled();
+	setSortingEnabled(false);
+
+	QStringList cells;
+	rowProducer producer{ _producer };
+	populator()->start([this, producer, cells](int _index) mutable {
+		cells.clear();
+		if (!producer(_index, cells)) { return false; }
+		int r = rowCount();
+		insertRow(r);
+		int columns = std::min(cells.count(), columnCount());
+		for (int c = 0; c < columns; c++) { setItem(r, c, new QTableWidgetItem(cells.at(c))); }
+		return true;
+	}, _expectedRowCount);
+}
+
+void ak::aTableWidget::cancelPopulation(void) {
+	if (m_populator != nullptr) { m_populator->cancel(); }
+}
+
+bool ak::aTableWidget::isPopulating(void) const { return (m_populator != nullptr && m_populator->isRunning()); }
+
+void ak::aTableWidget::setPopulationTimeBudget(
+	int																_milliseconds
+) { populator()->setTimeBudget(_milliseconds); }
+
+// ##############################################################################################################
+
 // Information
 
 bool ak::aTableWidget::isRowHeaderVisible(void) const { return verticalHeader()->isVisible(); }
@@ -294,6 +340,23 @@ bool ak::aTableWidget::isCellSelectable(
 
 // ##############################################################################################################
 
+// Private slots
+
+void ak::aTableWidget::slotPopulationChunkStarted(void) { setUpdatesEnabled(false); }
+
+void ak::aTableWidget::slotPopulationProgress(int _rowCount, int _expectedRowCount) {
+	setUpdatesEnabled(true);
+	emit populationProgress(_rowCount, _expectedRowCount);
+}
+
+void ak::aTableWidget::slotPopulationFinished(int _rowCount, bool _cancelled) {
+	setUpdatesEnabled(true);
+	setSortingEnabled(m_sortingWasEnabled);
+	emit populationFinished(_rowCount, _cancelled);
+}
+
+// ##############################################################################################################
+
 // Private functions
 
 void ak::aTableWidget::checkIndex(
@@ -314,3 +377,13 @@ QTableWidgetItem * ak::aTableWidget::getCell(
 	// Return the aTableWidget item
 	return item(_row, _column);
 }
+
+ak::aChunkedPopulator * ak::aTableWidget::populator(void) {
+	if (m_populator == nullptr) {
+		m_populator = new aChunkedPopulator(this);
+		connect(m_populator, &aChunkedPopulator::chunkStarted, this, &aTableWidget::slotPopulationChunkStarted);
+		connect(m_populator, &aChunkedPopulator::progress, this, &aTableWidget::slotPopulationProgress);
+		connect(m_populator, &aChunkedPopulator::finished, this, &aTableWidget::slotPopulationFinished);
+	}
+	return m_populator;
+}
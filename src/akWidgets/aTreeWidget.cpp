@@ -141,11 +141,7 @@ ak::ID ak::aTreeWidget::add(
 	ak::aTreeWidgetItem * currentItem = nullptr;
 
 	// Search for the root element
-	for (auto itm = m_items.begin(); itm != m_items.end(); itm++) {
-		if (itm->second != nullptr) {
-			if (itm->second->text(0) == items.at(0)) { currentItem = itm->second; break; }
-		}
-	}
+	currentItem = m_tree->topLevelItem(items.at(0));
 
 	// Create a new root item
 	if (currentItem == nullptr) {
@@ -463,13 +459,10 @@ ak::ID ak::aTreeWidget::getItemID(
 	assert(_itemPath.length() != 0); // No item path provided
 	QStringList lst = _itemPath.split(_delimiter);
 	assert(lst.count() > 0); // split error
-	for (auto itm = m_items.begin(); itm != m_items.end(); itm++) {
-		if (itm->second->text(0) == lst.at(0)) {
-			if (lst.count() == 1) { return itm->second->id(); }
-			return itm->second->getItemID(lst, 1);
-		}
-	}
-	return ak::invalidID;
+	aTreeWidgetItem * root = m_tree->topLevelItem(lst.at(0));
+	if (root == nullptr) { return ak::invalidID; }
+	if (lst.count() == 1) { return root->id(); }
+	return root->getItemID(lst, 1);
 }
 
 QString ak::aTreeWidget::getItemText(
@@ -548,6 +541,7 @@ void ak::aTreeWidget::slotTreeItemChanged(QTreeWidgetItem * _item, int _column)
 	itm = dynamic_cast<aTreeWidgetItem *>(_item);
 	assert(itm != nullptr);		// Cast failed
 	if (itm->text(0) != itm->storedText()) {
+		if (itm->parentId() == ak::invalidID) { m_tree->topLevelItemTextChanged(itm, itm->storedText()); }
 		itm->setStoredText(itm->text(0));
 		if (m_ignoreEvents) { return; }
 		emit itemTextChanged(_item, _column);
@@ -779,45 +773,37 @@ void ak::aTreeWidgetBase::setColorStyle(
 void ak::aTreeWidgetBase::AddTopLevelItem(
 	aTreeWidgetItem *						_item
 ) {
-	try {
+	A_TRY {
 		if (_item == nullptr) { throw aException("Is nullptr", "Check aTreeWidgetItem"); }
 		if (_item->id() == ak::invalidID) { throw aException("Is invalid ID", "Check item ID"); }
 		if (topLevelItem(_item->text(0)) != nullptr) { throw aException("Item does already exist", "Check for duplicates"); }
 		addTopLevelItem(_item);
 		m_topLevelItems.insert_or_assign(_item->id(), _item);
+		m_topLevelIndex.add(_item->text(0), _item->id());
 	}
-	catch (const aException & e) { throw aException(e, "ak::aTreeWidgetBase::AddTopLevelItem()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aTreeWidgetBase::AddTopLevelItem()"); }
-	catch (...) { throw aException("Unknown error", "ak::aTreeWidgetBase::AddTopLevelItem()"); }
+	A_CATCH_FORWARD("ak::aTreeWidgetBase::AddTopLevelItem()")
 }
 
 ak::aTreeWidgetItem * ak::aTreeWidgetBase::topLevelItem(
 	const QString &					_text
 ) {
-	try {
-		for (auto itm{ m_topLevelItems.begin() }; itm != m_topLevelItems.end(); itm++) {
-			assert(itm->second != nullptr); // That should not happen..
-			if (itm->second->text(0) == _text) { return itm->second; }
-		}
-		return nullptr;
+	A_TRY {
+		ID id = m_topLevelIndex.find(_text);
+		if (id == ak::invalidID) { return nullptr; }
+		return topLevelItem(id);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aTreeWidgetBase::topLevelItem(QString)"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aTreeWidgetBase::topLevelItem(QString)"); }
-	catch (...) { throw aException("Unknown error", "ak::aTreeWidgetBase::topLevelItem(QString)"); }
+	A_CATCH_FORWARD("ak::aTreeWidgetBase::topLevelItem(QString)")
 }
 
 ak::aTreeWidgetItem * ak::aTreeWidgetBase::topLevelItem(
 	ak::ID							_id
 ) {
-	try {
-		for (auto itm{ m_topLevelItems.begin() }; itm != m_topLevelItems.end(); itm++) {
-			if (itm->second->id() == _id) { return itm->second; }
-		}
-		return nullptr;
+	A_TRY {
+		auto itm = m_topLevelItems.find(_id);
+		if (itm == m_topLevelItems.end()) { return nullptr; }
+		return itm->second;
 	}
-	catch (const aException & e) { throw aException(e, "ak::aTreeWidgetBase::topLevelItem(ID)"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aTreeWidgetBase::topLevelItem(ID)"); }
-	catch (...) { throw aException("Unknown error", "ak::aTreeWidgetBase::topLevelItem(ID)"); }
+	A_CATCH_FORWARD("ak::aTreeWidgetBase::topLevelItem(ID)")
 }
 
 std::vector<QString> ak::aTreeWidgetBase::topLevelItemsText(void) {
@@ -830,13 +816,26 @@ std::vector<QString> ak::aTreeWidgetBase::topLevelItemsText(void) {
 
 void ak::aTreeWidgetBase::Clear(void) {
 	m_topLevelItems.clear();
+	m_topLevelIndex.clear();
 	clear();
 }
 
 void ak::aTreeWidgetBase::removeTopLevelItem(
 	ak::ID							_id
 ) {
-	m_topLevelItems.erase(_id);
+	auto itm = m_topLevelItems.find(_id);
+	if (itm == m_topLevelItems.end()) { return; }
+	m_topLevelIndex.remove(itm->second->storedText(), _id);
+	m_topLevelItems.erase(itm);
+}
+
+void ak::aTreeWidgetBase::topLevelItemTextChanged(
+	aTreeWidgetItem *				_item,
+	const QString &					_oldText
+) {
+	assert(_item != nullptr);	// nullptr provided
+	if (m_topLevelItems.count(_item->id()) == 0) { return; }
+	m_topLevelIndex.rename(_oldText, _item->text(0), _item->id());
 }
 
 // ####################################################################################################################################
@@ -903,16 +902,14 @@ ak::aTreeWidgetItem::~aTreeWidgetItem() {
 void ak::aTreeWidgetItem::AddChild(
 	aTreeWidgetItem *						_child
 ) {
-	try {
+	A_TRY {
 		if (findChild(_child->text(0)) != nullptr) { throw aException("Item does already exist", "Check duplicate"); }
 		if (_child == nullptr) { throw aException("Is nullptr", "Check child"); }
 		_child->setParentItem(this);
 		m_childs.push_back(_child);
 		addChild(_child);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aTreeWidgetItem::AddChild(aTreeWidgetItem)"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aTreeWidgetItem::AddChild(aTreeWidgetItem)"); }
-	catch (...) { throw aException("Unknown error", "ak::aTreeWidgetItem::AddChild(aTreeWidgetItem)"); }
+	A_CATCH_FORWARD("ak::aTreeWidgetItem::AddChild(aTreeWidgetItem)")
 }
 
 void ak::aTreeWidgetItem::setParentItem(
@@ -1003,16 +1000,14 @@ ak::ID ak::aTreeWidgetItem::getItemID(
 	const QStringList &						_itemPath,
 	int										_currentIndex
 ) {
-	try {
+	A_TRY {
 		assert(_currentIndex < _itemPath.count()); // Invalid index provided
 		ak::aTreeWidgetItem * child = findChild(_itemPath.at(_currentIndex));
 		if (child == nullptr) { return ak::invalidID; }
 		if (_currentIndex == _itemPath.count() - 1) { return child->id(); }
 		return child->getItemID(_itemPath, _currentIndex + 1);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aTreeWidgetItem::getItemID()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aTreeWidgetItem::getItemID()"); }
-	catch (...) { throw aException("Unknown error", "ak::aTreeWidgetItem::getItemID()"); }
+	A_CATCH_FORWARD("ak::aTreeWidgetItem::getItemID()")
 }
 
 void ak::aTreeWidgetItem::eraseChild(
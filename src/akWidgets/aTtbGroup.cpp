@@ -30,16 +30,42 @@
  // TTB header (TabToolbar library)
 #include <TabToolbar/Group.h>			// tt::Group
 
+// Qt header
+#include <qevent.h>
+#include <qstyle.h>
+
+// C++ header
+#include <functional>
+
+namespace {
+	//! @brief Calls the handler whenever the style of the watched widget changed
+	class styleChangeFilter : public QObject {
+	public:
+		styleChangeFilter(QObject * _parent, std::function<void(void)> _handler) : QObject(_parent), m_handler(_handler) {}
+
+		virtual bool eventFilter(QObject * _watched, QEvent * _event) override {
+			if (_event->type() == QEvent::StyleChange) { m_handler(); }
+			return QObject::eventFilter(_watched, _event);
+		}
+
+	private:
+		std::function<void(void)>	m_handler;
+	};
+}
+
 ak::aTtbGroup::aTtbGroup(
 	aMessenger *				_messenger,
 	tt::Group *					_group,
 	const QString &				_text
 ) : aTtbContainer(_messenger, otTabToolbarGroup),
-	m_group(_group)
+	m_group(_group), m_iconSize(0)
 {
 	assert(m_group != nullptr); // Nullptr provided
 	assert(_messenger != nullptr); // Nullptr provided
 	m_text = _text;
+	refreshIconSize();
+	// The filter is owned by the group widget
+	m_group->installEventFilter(new styleChangeFilter(m_group, [this]() { refreshIconSize(); }));
 }
 
 ak::aTtbGroup::~aTtbGroup() {
@@ -66,9 +92,9 @@ void ak::aTtbGroup::addChild(
 		w = dynamic_cast<aToolButtonWidget *>(_child);
 		assert(w != nullptr); // Cast failed
 		// Setup widget
-		const int iconSize = QApplication::style()->pixelMetric(QStyle::PM_LargeIconSize);
+		// The style metric is the same for every button of the group, it is queried when the style changes
 		w->setAutoRaise(true);
-		w->setIconSize(QSize(iconSize, iconSize));
+		w->setIconSize(QSize(m_iconSize, m_iconSize));
 		w->setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Minimum);
 		w->setToolButtonStyle(Qt::ToolButtonTextUnderIcon);
 		// Place widget
@@ -150,4 +176,17 @@ void ak::aTtbGroup::setEnabled(
 ) {
 	aTtbContainer::setEnabled(_enabled);
 	m_group->setEnabled(m_isEnabled);
+}
+
+void ak::aTtbGroup::refreshIconSize(void) {
+	int iconSize{ m_group->style()->pixelMetric(QStyle::PM_LargeIconSize, nullptr, m_group) };
+	if (iconSize == m_iconSize) { return; }
+	m_iconSize = iconSize;
+	for (auto child : m_childObjects) {
+		if (child.second->type() != otToolButton) { continue; }
+		aToolButtonWidget * w = nullptr;
+		w = dynamic_cast<aToolButtonWidget *>(child.second);
+		assert(w != nullptr); // Cast failed
+		w->setIconSize(QSize(m_iconSize, m_iconSize));
+	}
 }
\ No newline at end of file
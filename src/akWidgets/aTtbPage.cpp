@@ -109,4 +109,23 @@ void ak::aTtbPage::setEnabled(
 ) {
 	aTtbContainer::setEnabled(_enabled);
 	m_page->setEnabled(m_isEnabled);
-}
\ No newline at end of file
+}
+
+void ak::aTtbPage::setDeferredBuild(
+	const std::function<void()> &	_build
+) {
+	assert(_build);	// No build function provided
+	if (m_deferredBuild) {
+		std::function<void()> pending{ m_deferredBuild };
+		m_deferredBuild = [pending, _build]() { pending(); _build(); };
+	}
+	else { m_deferredBuild = _build; }
+}
+
+void ak::aTtbPage::runDeferredBuild(void) {
+	if (!m_deferredBuild) { return; }
+	// Reset first, the build may show the page again
+	std::function<void()> build{ std::move(m_deferredBuild) };
+	m_deferredBuild = nullptr;
+	build();
+}
@@ -13,7 +13,10 @@
 // AK header
 #include <akCore/aException.h>
 #include <akCore/aMessenger.h>
+#include <akCore/aProgressTask.h>
+#include <akCore/aStateSnapshot.h>
 #include <akCore/aUidMangager.h>
+#include <akCore/rJSONStream.h>
 
 #include <akGui/aColorStyle.h>
 #include <akGui/aIconManager.h>
@@ -39,6 +42,11 @@
 #include <qmessagebox.h>						// QMessageBox
 #include <qbytearray.h>							// QByteArray
 #include <qmovie.h>
+#include <qguiapplication.h>					// QGuiApplication
+#include <qscreen.h>							// QScreen
+
+// C++ header
+#include <algorithm>
 
 // m_window->resizeDocks({ dock }, { 0 }, Qt::Horizontal); // This is the hack
 
@@ -51,6 +59,8 @@ m_window(nullptr),
 m_messenger(nullptr),
 m_uidManager(nullptr),
 m_tabToolBar(nullptr),
+m_tabToolBarUpdateDepth(0),
+m_tabToolBarStylePending(false),
 m_statusLabel(nullptr),
 m_progressBar(nullptr),
 m_timerLabelHide(nullptr),
@@ -58,7 +68,11 @@ m_timerLabelShow(nullptr),
 m_timerProgressHide(nullptr),
 m_timerProgressShow(nullptr),
 m_timerSignalLinker(nullptr),
-m_timerShowMainWindow(nullptr)
+m_timerShowMainWindow(nullptr),
+m_timerProgressSample(nullptr),
+m_progressBarContinuous(false),
+m_progressTasksShown(false),
+m_statusStateBeforeTasks{ false, false, false, 0, QString() }
 {
 	// Check parameter
 	assert(_messenger != nullptr); // Nullptr provided
@@ -115,6 +129,13 @@ m_timerShowMainWindow(nullptr)
 	m_timerShowMainWindow->setInterval(1);
 	m_timerShowMainWindow->setSingleShot(true);
 
+	// Sample the progress tasks once per frame of the primary screen
+	m_timerProgressSample = new QTimer(this);
+	m_timerProgressSample->setTimerType(Qt::PreciseTimer);
+	QScreen * screen = QGuiApplication::primaryScreen();
+	qreal refreshRate = (screen != nullptr ? screen->refreshRate() : 0.);
+	m_timerProgressSample->setInterval(refreshRate >= 1. ? qMax(1, qRound(1000. / refreshRate)) : 16);
+
 	// Create timer signal linker
 	m_timerSignalLinker = new aWindowManagerTimerSignalLinker(this);
 	
@@ -124,6 +145,7 @@ m_timerShowMainWindow(nullptr)
 	m_timerSignalLinker->addLink(m_timerProgressHide, ak::aWindowManagerTimerSignalLinker::timerType::progressHide);
 	m_timerSignalLinker->addLink(m_timerProgressShow, ak::aWindowManagerTimerSignalLinker::timerType::progressShow);
 	m_timerSignalLinker->addLink(m_timerShowMainWindow, ak::aWindowManagerTimerSignalLinker::timerType::showWindow);
+	m_timerSignalLinker->addLink(m_timerProgressSample, ak::aWindowManagerTimerSignalLinker::timerType::progressSample);
 
 	if (m_colorStyle != nullptr) { setColorStyle(m_colorStyle); }
 
@@ -256,6 +278,41 @@ void ak::aWindowManager::addObjectSettingsToValue(
 	_array.PushBack(root, _allocator);
 }
 
+void ak::aWindowManager::writeObjectSettings(
+	rJSONStreamWriter &						_writer
+) {
+	_writer.startObject();
+	_writer.member(RESTORABLE_NAME_ALIAS, m_alias.toStdString());
+	_writer.member(RESTORABLE_NAME_TYPE, ak::toQString(m_objectType).toStdString());
+
+	// Write settings
+	_writer.key(RESTORABLE_NAME_SETTINGS);
+	_writer.startObject();
+
+	QByteArray lastConfig(m_window->saveState());
+	_writer.key(RESTORABLE_CFG_STATE);
+	_writer.startArray();
+	for (char itm : lastConfig) { _writer.value(static_cast<int>(itm)); }
+	_writer.endArray();
+
+	_writer.endObject();
+	_writer.endObject();
+}
+
+void ak::aWindowManager::writeObjectSettings(
+	aStateSnapshot &						_snapshot
+) {
+	QByteArray lastConfig(m_window->saveState());
+	_snapshot.addEntry(m_alias.toStdString(), ak::toQString(m_objectType).toStdString(), [&lastConfig](aStateSnapshot::settingsWriter & _writer) {
+		_writer.StartObject();
+		_writer.Key(RESTORABLE_CFG_STATE, static_cast<rapidjson::SizeType>(sizeof(RESTORABLE_CFG_STATE) - 1));
+		_writer.StartArray();
+		for (char itm : lastConfig) { _writer.Int(static_cast<int>(itm)); }
+		_writer.EndArray(static_cast<rapidjson::SizeType>(lastConfig.size()));
+		_writer.EndObject(1);
+	});
+}
+
 void ak::aWindowManager::restoreSettings(
 	const rapidjson::Value &				_settings
 ) {
@@ -293,7 +350,7 @@ void ak::aWindowManager::addDock(
 	aDockWidget *										_dock,
 	dockLocation								_dockLocation
 ) {
-	try {
+	A_TRY {
 		if (_dock == nullptr) { throw aException("Is nullptr", "Check dock"); }
 		switch (_dockLocation)
 		{
@@ -314,9 +371,7 @@ void ak::aWindowManager::addDock(
 		m_window->resizeDocks({ _dock }, { 0 }, Qt::Orientation::Horizontal);
 		//_dock->resize(200, 200);
 	}
-	catch (const aException & e) { throw aException(e, "ak::aWindowManager::addDock()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aWindowManager::addDock()"); }
-	catch (...) { throw aException("Unknown error", "ak::aWindowManager::addDock()"); }
+	A_CATCH_FORWARD("ak::aWindowManager::addDock()")
 }
 
 void ak::aWindowManager::tabifyDock(
@@ -338,7 +393,7 @@ void ak::aWindowManager::tabifyDock(
 void ak::aWindowManager::setDockPriorityBottomLeft(
 	dockLocation						_dockLocation
 ) {
-	try {
+	A_TRY {
 		switch (_dockLocation)
 		{
 		case dockLeft:
@@ -349,15 +404,13 @@ void ak::aWindowManager::setDockPriorityBottomLeft(
 			throw aException("Invalid dock location", "Check dock location");
 		}
 	}
-	catch (const aException & e) { throw aException(e, "ak::aWindowManager::setDockPriorityBottomLeft()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aWindowManager::setDockPriorityBottomLeft()"); }
-	catch (...) { throw aException("Unknown error", "ak::aWindowManager::setDockPriorityBottomLeft()"); }
+	A_CATCH_FORWARD("ak::aWindowManager::setDockPriorityBottomLeft()")
 }
 
 void ak::aWindowManager::setDockPriorityBottomRight(
 	dockLocation						_dockLocation
 ) {
-	try {
+	A_TRY {
 		switch (_dockLocation)
 		{
 		case dockRight:
@@ -368,9 +421,7 @@ void ak::aWindowManager::setDockPriorityBottomRight(
 			throw aException("Invalid dock location", "Check dock location");
 		}
 	}
-	catch (const aException & e) { throw aException(e, "ak::aWindowManager::setDockPriorityBottomLeft()"); }
-	catch (const std::exception & e) { throw aException(e.what(), "ak::aWindowManager::setDockPriorityBottomLeft()"); }
-	catch (...) { throw aException("Unknown error", "ak::aWindowManager::setDockPriorityBottomLeft()"); }
+	A_CATCH_FORWARD("ak::aWindowManager::setDockPriorityBottomLeft()")
 }
 
 // #############################################################################################################
@@ -381,8 +432,8 @@ void ak::aWindowManager::setStatusBarProgress(
 	int											_progress
 ) {
 	if (_progress < 0 || _progress > 100) { throw aException("Progress out of range", "ak::aWindowManager::setStatusProgress()"); }
-	setStatusBarContinuous(false);
-	m_progressBar->setValue(_progress);
+	if (m_progressBarContinuous) { setStatusBarContinuous(false); }
+	if (m_progressBar->value() != _progress) { m_progressBar->setValue(_progress); }
 }
 
 void ak::aWindowManager::setStatusBarVisible(
@@ -468,6 +519,95 @@ void ak::aWindowManager::setStatusLabelVisible(
 	}
 }
 
+// #############################################################################################################
+
+// Progress tasks
+
+std::shared_ptr<ak::aProgressTask> ak::aWindowManager::createProgressTask(
+	const QString &								_label,
+	long long									_total
+) {
+	std::shared_ptr<aProgressTask> task = std::make_shared<aProgressTask>(_label, _total);
+	{
+		std::lock_guard<std::mutex> lock(m_progressTasksMutex);
+		m_progressTasks.push_back(task);
+	}
+	// The timer lives in the GUI thread, start it from there
+	QMetaObject::invokeMethod(m_timerProgressSample, "start", Qt::QueuedConnection);
+	return task;
+}
+
+void ak::aWindowManager::setProgressSampleInterval(
+	int											_interval
+) {
+	assert(_interval > 0);	// Invalid interval
+	m_timerProgressSample->setInterval(_interval);
+}
+
+int ak::aWindowManager::getProgressSampleInterval(void) const { return m_timerProgressSample->interval(); }
+
+void ak::aWindowManager::sampleProgressTasks(void) {
+	std::vector<std::shared_ptr<aProgressTask>> tasks;
+	{
+		std::lock_guard<std::mutex> lock(m_progressTasksMutex);
+		tasks.reserve(m_progressTasks.size());
+		auto keep = m_progressTasks.begin();
+		for (auto it = m_progressTasks.begin(); it != m_progressTasks.end(); it++) {
+			std::shared_ptr<aProgressTask> task{ it->lock() };
+			if (task == nullptr || task->isFinished()) { continue; }
+			tasks.push_back(std::move(task));
+			if (keep != it) { *keep = std::move(*it); }
+			keep++;
+		}
+		m_progressTasks.erase(keep, m_progressTasks.end());
+	}
+
+	if (tasks.empty()) {
+		m_timerProgressSample->stop();
+		if (m_progressTasksShown) {
+			m_progressTasksShown = false;
+			const statusState & state = m_statusStateBeforeTasks;
+			// Only hide what was shown for the tasks
+			if (!state.progressBarVisible) { setStatusBarVisible(false); }
+			if (!state.labelVisible) { setStatusLabelVisible(false); }
+			if (state.progressBarContinuous != m_progressBarContinuous) { setStatusBarContinuous(state.progressBarContinuous); }
+			if (!state.progressBarContinuous) { m_progressBar->setValue(state.progress); }
+			if (m_statusLabel->text() != state.labelText) { m_statusLabel->setText(state.labelText); }
+		}
+		return;
+	}
+	if (!m_progressTasksShown) {
+		m_progressTasksShown = true;
+		// A running delay timer tells the state the application requested last
+		statusState & state = m_statusStateBeforeTasks;
+		state.progressBarVisible = m_timerProgressShow->isActive() || (!m_progressBar->isHidden() && !m_timerProgressHide->isActive());
+		state.labelVisible = m_timerLabelShow->isActive() || (!m_statusLabel->isHidden() && !m_timerLabelHide->isActive());
+		state.progressBarContinuous = m_progressBarContinuous;
+		state.progress = m_progressBar->value();
+		state.labelText = m_statusLabel->text();
+		if (!state.progressBarVisible) { setStatusBarVisible(true); }
+		if (!state.labelVisible) { setStatusLabelVisible(true); }
+	}
+
+	// Aggregate the tasks with a known total, tasks without a total only count if there is no other task
+	long long progress{ 0 };
+	long long total{ 0 };
+	for (auto const & task : tasks) {
+		long long t{ task->total() };
+		if (t <= 0) { continue; }
+		progress += qBound(0LL, task->progress(), t);
+		total += t;
+	}
+	if (total == 0) {
+		if (!m_progressBarContinuous) { setStatusBarContinuous(true); }
+	}
+	else { setStatusBarProgress(static_cast<int>(progress * 100 / total)); }
+
+	QString label{ tasks.front()->label() };
+	if (tasks.size() > 1) { label.append(QString(" (+%1)").arg(tasks.size() - 1)); }
+	if (m_statusLabel->text() != label) { m_statusLabel->setText(label); }
+}
+
 void ak::aWindowManager::showMaximized(void) { m_window->showMaximized(); }
 
 void ak::aWindowManager::showMinimized(void) { m_window->showMinimized(); }
@@ -538,11 +678,40 @@ ak::aTtbPage * ak::aWindowManager::createTabToolbarSubContainer(
 ) {
 	tt::Page * page = m_tabToolBar->AddPage(_text);
 	ak::aTtbPage * p = new ak::aTtbPage(m_messenger, page, _text);
-	if (m_colorStyle != nullptr) { p->setColorStyle(m_colorStyle); setColorStyle(m_colorStyle); }
+	if (m_colorStyle != nullptr) {
+		p->setColorStyle(m_colorStyle);
+		// Restyling the whole window is expensive, only do it once per tab toolbar update
+		if (m_tabToolBarUpdateDepth > 0) { m_tabToolBarStylePending = true; }
+		else { setColorStyle(m_colorStyle); }
+	}
 	m_tabToolBarContainer.push_back(p);
 	return p;
 }
 
+ak::aTtbPage * ak::aWindowManager::getTabToolBarPage(
+	int							_index
+) {
+	for (auto itm : m_tabToolBarContainer) {
+		aTtbPage * page = dynamic_cast<aTtbPage *>(itm);
+		if (page != nullptr && page->index() == _index) { return page; }
+	}
+	return nullptr;
+}
+
+void ak::aWindowManager::beginTabToolBarUpdate(void) {
+	if (m_tabToolBarUpdateDepth++ == 0) { m_tabToolBar->setUpdatesEnabled(false); }
+}
+
+void ak::aWindowManager::endTabToolBarUpdate(void) {
+	assert(m_tabToolBarUpdateDepth > 0);	// No update started
+	if (--m_tabToolBarUpdateDepth > 0) { return; }
+	if (m_tabToolBarStylePending) {
+		m_tabToolBarStylePending = false;
+		if (m_colorStyle != nullptr) { setColorStyle(m_colorStyle); }
+	}
+	m_tabToolBar->setUpdatesEnabled(true);
+}
+
 ak::aTtbContainer * ak::aWindowManager::getTabToolBarSubContainer(
 	const QString &				_text
 ) {
@@ -626,5 +795,12 @@ void ak::aWindowManager::slotTabToolbarTabClicked(int _index) {
 	m_messenger->sendMessage(m_uid, etTabToolbarClicked, _index);
 }
 void ak::aWindowManager::slotTabToolbarTabCurrentTabChanged(int _index) {
+	// Build the page content if it was deferred
+	aTtbPage * page = getTabToolBarPage(_index);
+	if (page != nullptr && page->hasDeferredBuild()) {
+		beginTabToolBarUpdate();
+		page->runDeferredBuild();
+		endTabToolBarUpdate();
+	}
 	m_messenger->sendMessage(m_uid, etTabToolbarChanged, _index);
 }
\ No newline at end of file
@@ -44,6 +44,9 @@ ak::aWindowManagerTimerSignalLinker::~aWindowManagerTimerSignalLinker() {
 		case timerType::showWindow:
 			disconnect(m_links.at(i).timer, &QTimer::timeout, this, &aWindowManagerTimerSignalLinker::timerTimeoutShowWindow);
 			break;
+		case progressSample:
+			disconnect(m_links.at(i).timer, &QTimer::timeout, this, &aWindowManagerTimerSignalLinker::timerTimeoutProgressSample);
+			break;
 		default:
 			assert(0); // not implemented timer type
 			break;
@@ -67,6 +70,8 @@ void ak::aWindowManagerTimerSignalLinker::addLink(
 		connect(_timer, &QTimer::timeout, this, &aWindowManagerTimerSignalLinker::timerTimeoutLabelHide); break;
 	case showWindow:
 		connect(_timer, &QTimer::timeout, this, &aWindowManagerTimerSignalLinker::timerTimeoutShowWindow); break;
+	case progressSample:
+		connect(_timer, &QTimer::timeout, this, &aWindowManagerTimerSignalLinker::timerTimeoutProgressSample); break;
 	default:
 		assert(0); // not implemented timer type
 		break;
@@ -83,3 +88,5 @@ void ak::aWindowManagerTimerSignalLinker::timerTimeoutProgressHide() { m_uiManag
 void ak::aWindowManagerTimerSignalLinker::timerTimeoutProgressShow() { m_uiManager->setStatusBarVisible(true, false); }
 
 void ak::aWindowManagerTimerSignalLinker::timerTimeoutShowWindow() { m_uiManager->showMaximized(); }
+
+void ak::aWindowManagerTimerSignalLinker::timerTimeoutProgressSample() { m_uiManager->sampleProgressTasks(); }